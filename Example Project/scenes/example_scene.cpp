@@ -73,7 +73,7 @@ namespace Scenes {
         g_ecs.AddComponent<RigidBody>(floor_entity, floor_rigidbody);
         g_ecs.AddComponent<Collider2D>(floor_entity, floor_collider);
         g_ecs.AddComponent<Shape>(floor_entity, floor_shape);
-        g_ecs.AddComponent<Texture>(floor_entity, floor_texture);
+        g_ecs.AddComponent<Texture>(floor_entity, std::move(floor_texture));
 
         std::random_device rd;
         std::mt19937 gen(rd());
@@ -83,28 +83,20 @@ namespace Scenes {
         std::uniform_int_distribution<> dist_size(5, 30);
         std::uniform_int_distribution<> dist_color(0, 255);
 
-        for (int i = 0; i < 400; i++) {
-            int box_entity = g_ecs.CreateEntity();
-
-            Transform2D box_transform;
+        // Boxes are spawned as one batch, so the systems and listeners match them once instead of once per box
+        g_ecs.SpawnBatch<Transform2D, RigidBody, Collider2D, Shape, Texture>(400, [&](EntityID box_entity, size_t) {
+            Transform2D &box_transform = g_ecs.GetComponent<Transform2D>(box_entity);
             box_transform.m_local_position = {dist_x(gen), dist_y(gen)};
             box_transform.m_local_rotation = (float)dist_angle(gen);
             box_transform.m_layer = 10;
-            RigidBody box_rigidbody;
-            box_rigidbody.m_type = b2_dynamicBody;
-            Collider2D box_collider;
+            g_ecs.GetComponent<RigidBody>(box_entity).m_type = b2_dynamicBody;
+            Collider2D &box_collider = g_ecs.GetComponent<Collider2D>(box_entity);
             box_collider.m_size = {dist_size(gen), dist_size(gen)};
-            Shape box_shape;
+            Shape &box_shape = g_ecs.GetComponent<Shape>(box_entity);
             box_shape.m_size = box_collider.m_size;
             box_shape.m_color = {(Uint8)dist_color(gen), (Uint8)dist_color(gen), (Uint8)dist_color(gen), 255};
-            Texture box_texture;
-            box_texture.m_size = box_collider.m_size;
-            g_ecs.AddComponent<Transform2D>(box_entity, box_transform);
-            g_ecs.AddComponent<RigidBody>(box_entity, box_rigidbody);
-            g_ecs.AddComponent<Collider2D>(box_entity, box_collider);
-            g_ecs.AddComponent<Shape>(box_entity, box_shape);
-            g_ecs.AddComponent<Texture>(box_entity, box_texture);
-        }
+            g_ecs.GetComponent<Texture>(box_entity).m_size = box_collider.m_size;
+        });
 
         int button_entity = g_ecs.CreateEntity();
         Transform2D button_transform;
@@ -120,35 +112,32 @@ namespace Scenes {
         button_text.m_size = 24;
         g_ecs.AddComponent<Transform2D>(button_entity, button_transform);
         g_ecs.AddComponent<Interactive>(button_entity, interactive);
-        g_ecs.AddComponent<Texture>(button_entity, button_texture);
+        g_ecs.AddComponent<Texture>(button_entity, std::move(button_texture));
         g_ecs.AddComponent<Name>(button_entity, button_name);
         g_ecs.AddComponent<Text>(button_entity, button_text);
 
         m_event_subscription_handles.push_back(
             g_app.GetEventManager().Subscribe<OnEnterEvent>([button_entity](const OnEnterEvent &evt) {
-                if (evt.entity_id == button_entity) {
+                if (evt.entity_id == button_entity && g_ecs.IsEntityValid(evt.entity_handle)) {
                     LOG(LoggingType::INFO, "Test Button entered!");
                     auto &text = g_ecs.GetComponent<Text>(button_entity);
                     text.m_background_color = {255, 255, 255, 255};
-                    text.MarkDirty();
                 }
             }));
         m_event_subscription_handles.push_back(
             g_app.GetEventManager().Subscribe<OnExitEvent>([button_entity](const OnExitEvent &evt) {
-                if (evt.entity_id == button_entity) {
+                if (evt.entity_id == button_entity && g_ecs.IsEntityValid(evt.entity_handle)) {
                     LOG(LoggingType::INFO, "Test Button exited!");
                     auto &text = g_ecs.GetComponent<Text>(button_entity);
                     text.m_background_color = {0, 0, 0, 255};
-                    text.MarkDirty();
                 }
             }));
         m_event_subscription_handles.push_back(
             g_app.GetEventManager().Subscribe<OnClickEvent>([button_entity](const OnClickEvent &evt) {
-                if (evt.entity_id == button_entity) {
+                if (evt.entity_id == button_entity && g_ecs.IsEntityValid(evt.entity_handle)) {
                     LOG(LoggingType::INFO, "Test Button clicked!");
                     auto &text = g_ecs.GetComponent<Text>(button_entity);
                     text.m_background_color = {255, 0, 0, 255};
-                    text.MarkDirty();
                 }
             }));
     }
@@ -19,6 +19,8 @@
 #include <HotBeanEngine/application/managers/camera_manager.hpp>
 #include <HotBeanEngine/application/managers/ecs_manager.hpp>
 #include <HotBeanEngine/application/managers/event_manager.hpp>
+#include <HotBeanEngine/application/managers/job_manager.hpp>
+#include <HotBeanEngine/application/managers/prefab_manager.hpp>
 #include <HotBeanEngine/application/managers/render_manager.hpp>
 #include <HotBeanEngine/application/managers/scene_manager.hpp>
 #include <HotBeanEngine/application/managers/serialization_manager.hpp>
@@ -51,6 +53,7 @@ namespace HBE::Application {
         SDL_Event event;                                 /// SDL event used for polling in the event loop
 
     protected:
+        std::shared_ptr<Managers::JobManager> m_job_manager;               /// Runs jobs on the worker thread pool
         std::shared_ptr<Managers::ECSManager> m_ecs_manager;               /// Manages entity-component-system
         std::shared_ptr<Managers::LoggingManager> m_logging_manager;       /// Manages application logging
         std::unique_ptr<Managers::SceneManager> m_scene_manager;           /// Manages scene loading/switching
@@ -62,6 +65,7 @@ namespace HBE::Application {
         std::shared_ptr<Managers::EventManager> m_event_manager;           /// Manages event distribution and dispatch
         std::shared_ptr<Managers::SerializationManager>
             m_serialization_manager; /// Manages serialization and deserialization of scenes
+        std::shared_ptr<Managers::PrefabManager> m_prefab_manager;         /// Cooks, caches and instantiates prefabs
         std::shared_ptr<Factories::IComponentFactory> m_component_factory; /// Factory for component creation
         std::shared_ptr<Factories::ISystemFactory> m_system_factory;       /// Factory for system creation
         std::shared_ptr<Factories::ISceneFactory> m_scene_factory; /// Factory for scene creation and registration
@@ -199,6 +203,18 @@ namespace HBE::Application {
          */
         Managers::SerializationManager &GetSerializationManager() const;
 
+        /**
+         * @brief Access the prefab manager.
+         * @return Reference to the prefab manager.
+         */
+        Managers::PrefabManager &GetPrefabManager() const;
+
+        /**
+         * @brief Access the job manager shared by the engine's managers and systems.
+         * @return Reference to the job manager.
+         */
+        Managers::JobManager &GetJobManager() const;
+
         /**
          * @brief Access the logging manager.
          * @return Reference to the logging manager.
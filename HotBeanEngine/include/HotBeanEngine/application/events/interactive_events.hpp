@@ -13,6 +13,7 @@
 #include <HotBeanEngine/core/entity.hpp>
 
 namespace HBE::Application::Events {
+    using Core::EntityHandle;
     using Core::EntityID;
 
     /**
@@ -21,6 +22,7 @@ namespace HBE::Application::Events {
      */
     struct OnEnterEvent {
         EntityID entity_id;
+        EntityHandle entity_handle; // Events are dispatched at frame end, check this is still valid before use
     };
 
     /**
@@ -29,6 +31,7 @@ namespace HBE::Application::Events {
      */
     struct OnExitEvent {
         EntityID entity_id;
+        EntityHandle entity_handle; // Events are dispatched at frame end, check this is still valid before use
     };
 
     /**
@@ -37,5 +40,6 @@ namespace HBE::Application::Events {
      */
     struct OnClickEvent {
         EntityID entity_id;
+        EntityHandle entity_handle; // Events are dispatched at frame end, check this is still valid before use
     };
 } // namespace HBE::Application::Events
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <HotBeanEngine/core/all_core.hpp>
+#include <span>
 #include <unordered_set>
 
 namespace HBE::Application::Listeners {
@@ -18,13 +19,17 @@ namespace HBE::Application::Listeners {
      * @brief Base class for listening to component changes on entities.
      *
      * Implement this base class to receive notifications when entities gain or lose components.
-     * Register with ECSManager via RegisterComponentListener.
+     * Call ListenForComponents() first, then register with ECSManager via RegisterComponentListener. The ECSManager
+     * files the listener under each listened component, so it's only called about those components.
      */
     class ComponentListener {
     private:
         std::unordered_set<Core::ComponentID> m_listened_components =
             {}; /// Set of component IDs this listener is interested in
 
+        // The listened components as a signature, an entity matches the listener if its signature contains this one
+        Core::Signature m_listened_signature;
+
     public:
         ~ComponentListener() = default;
 
@@ -34,20 +39,66 @@ namespace HBE::Application::Listeners {
          */
         void ListenForComponents(const std::unordered_set<Core::ComponentID> &component_ids) {
             m_listened_components = component_ids;
+
+            m_listened_signature.reset();
+            for (Core::ComponentID component_id : component_ids) {
+                m_listened_signature.set(component_id);
+            }
         }
 
         const std::unordered_set<Core::ComponentID> &GetListenedComponents() const { return m_listened_components; }
+        const Core::Signature &GetListenedSignature() const { return m_listened_signature; }
 
         /**
          * @brief Called when an entity's component signature changes to match the listener's interest.
+         * @param component The component that was added.
          * @param entity The entity ID that gained a component.
          */
         virtual void OnComponentAdded(Core::IComponent *component, Core::EntityID entity) = 0;
 
         /**
-         * @brief Called when an entity's component signature changes to no longer match the listener's interest.
+         * @brief Called once for a batch of entities that all gained a component and now match the listener's
+         * interest, like spawned entities or entities restored from a snapshot.
+         * Override to handle the whole batch at once, by default calls OnComponentAdded for each entity.
+         * @param component_id The component that was added.
+         * @param components The added component of each entity, in the same order as entities.
+         * @param entities The entity IDs that gained the component.
+         */
+        virtual void OnComponentsAdded([[maybe_unused]] Core::ComponentID component_id,
+                                       std::span<Core::IComponent *const> components,
+                                       std::span<const Core::EntityID> entities) {
+            for (size_t i = 0; i < entities.size(); i++) {
+                OnComponentAdded(components[i], entities[i]);
+            }
+        }
+
+        /**
+         * @brief Called when an entity that matched the listener's interest loses one of the listened components.
+         * @param component_id The component that was removed.
          * @param entity The entity ID that lost a component.
          */
-        virtual void OnComponentRemoved(Core::EntityID entity) = 0;
+        virtual void OnComponentRemoved(Core::ComponentID component_id, Core::EntityID entity) = 0;
+
+        /**
+         * @brief Called once for a batch of destroyed entities that matched the listener's interest.
+         * Override to handle the whole batch at once, by default calls OnComponentRemoved for each entity.
+         * @param component_id The lowest of the listened components.
+         * @param entities The entity IDs that were destroyed.
+         */
+        virtual void OnComponentsRemoved(Core::ComponentID component_id, std::span<const Core::EntityID> entities) {
+            for (Core::EntityID entity : entities) {
+                OnComponentRemoved(component_id, entity);
+            }
+        }
+
+        /**
+         * @brief Called when every entity is destroyed at once, like when a scene is unloaded.
+         * Override to drop everything in one go instead of entity by entity, by default calls OnComponentsRemoved.
+         * @param component_id The lowest of the listened components.
+         * @param entities Every entity that matched the listener's interest.
+         */
+        virtual void OnAllComponentsRemoved(Core::ComponentID component_id, std::span<const Core::EntityID> entities) {
+            OnComponentsRemoved(component_id, entities);
+        }
     };
-} // namespace HBE::Application::Listeners
+} // namespace HBE::Application::Listeners
\ No newline at end of file
@@ -10,6 +10,10 @@
 
 #pragma once
 
+#include <memory>
+
+#include <HotBeanEngine/application/managers/ecs_manager.hpp>
+
 namespace HBE {
     namespace Application {
         class Application;
@@ -31,13 +35,19 @@ namespace HBE::Application::Managers {
      *
      * This class encapsulates the state machine logic for the application, providing
      * a clean interface for starting, pausing, stopping, and resuming the game.
-     * It handles scene reloading when transitioning from Stopped to Playing state.
+     * Pressing Play takes a snapshot of the world and pressing Stop restores it, so the scene is back to how it was
+     * before playing without being loaded from file again.
      */
     class ApplicationStateManager {
     private:
         ApplicationState m_state = ApplicationState::Stopped;
         ApplicationState m_queued_state = ApplicationState::Stopped;
-        bool m_needs_scene_reload = false;
+
+        // World as it was when Play was pressed, restored when Stop is pressed
+        std::unique_ptr<WorldSnapshot> m_play_snapshot;
+
+        // Scene that was loaded when the snapshot was taken, the snapshot is dropped if another scene is loaded
+        std::shared_ptr<Core::IScene> m_play_scene;
 
     public:
         ApplicationStateManager() = default;
@@ -51,9 +61,6 @@ namespace HBE::Application::Managers {
          */
         void QueueStateChange(ApplicationState new_state);
 
-        /// @brief Clears the scene reload flag after reloading is complete.
-        void ClearReloadFlag();
-
         /**
          * @brief Gets the previous application state.
          * @return The previous ApplicationState
@@ -76,12 +83,10 @@ namespace HBE::Application::Managers {
          */
         void UpdateGameLoopState();
 
-        /**
-         * @brief Checks if the scene needs to be reloaded.
-         * This happens when transitioning from Stopped to Playing.
-         *
-         * @return true if scene reload is needed, false otherwise
-         */
-        bool ShouldReloadScene() const;
+        /// @brief Keeps a snapshot of the world to restore when playing stops.
+        void CapturePlaySnapshot();
+
+        /// @brief Restores the world to how it was when playing started.
+        void RestorePlaySnapshot();
     };
 } // namespace HBE::Application::Managers
@@ -10,6 +10,8 @@ namespace HBE::Application::Managers {
     using Components::Transform2D;
     using Core::EntityID;
 
+    class ECSManager;
+
     /**
      * @class CameraManager
      * @brief Manages cameras within the application.
@@ -26,6 +28,14 @@ namespace HBE::Application::Managers {
         ~CameraManager() = default;
 
         std::vector<EntityID> GetAllActiveCameras();
+
+        /**
+         * @brief Get the active cameras of one world, sorted by entity
+         * @param world World to look for cameras in, systems pass GetWorld()
+         * @return Entities of the world's active cameras
+         */
+        std::vector<EntityID> GetAllActiveCameras(ECSManager &world);
+
         float GetZoom(const Camera &camera);
         SDL_FRect GetViewport(const Camera &camera);
         glm::vec2 GetViewportCenter(const Camera &camera);
@@ -0,0 +1,122 @@
+/**
+ * @file command_buffer.hpp
+ * @author Daniel Parker (DParker13)
+ * @brief Records structural ECS changes so they can be applied together later.
+ *
+ * @details Adding or removing a component right away updates the entity's signature, rematches it against every
+ * system and notifies listeners. A CommandBuffer records those changes instead. ECSManager::Flush() applies them
+ * sorted by entity, so each entity's signature is rematched once per flush and listeners are notified after all
+ * changes have been applied.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include <HotBeanEngine/application/managers/component_manager.hpp>
+#include <HotBeanEngine/application/managers/entity_manager.hpp>
+
+namespace HBE::Application::Managers {
+    /**
+     * @brief Queue of entity and component changes applied at a sync point.
+     *
+     * Entity IDs are reserved as soon as CreateEntity() is called so later commands can refer to them. The entity has
+     * no components and isn't in any system until the buffer is flushed.
+     */
+    class CommandBuffer {
+    public:
+        enum class CommandType { AddComponent, RemoveComponent, DestroyEntity };
+
+        /**
+         * @brief A single recorded change.
+         */
+        struct Command {
+            CommandType type;
+            EntityID entity;
+
+            // Changes the component storage and returns the ComponentID touched, MAX_COMPONENTS if nothing changed
+            std::function<ComponentID(ComponentManager &)> apply;
+        };
+
+    private:
+        EntityManager *m_entity_manager;
+        std::vector<Command> m_commands;
+
+    public:
+        explicit CommandBuffer(EntityManager *entity_manager) : m_entity_manager(entity_manager) {}
+
+        /**
+         * @brief Reserves a new entity ID
+         * @return EntityID of the new entity, the entity limit if no more entities can be created
+         */
+        EntityID CreateEntity() { return m_entity_manager->CreateEntity(); }
+
+        /**
+         * @brief Records destroying an entity. Commands recorded after this for the same entity are dropped.
+         * @param entity EntityID to destroy
+         */
+        void DestroyEntity(EntityID entity) { m_commands.push_back({CommandType::DestroyEntity, entity, nullptr}); }
+
+        /**
+         * @brief Records adding a default constructed component of type T to an entity
+         * @tparam T Component type
+         * @param entity EntityID to add component to
+         */
+        template <typename T>
+        void AddComponent(EntityID entity) {
+            m_commands.push_back({CommandType::AddComponent, entity, [entity](ComponentManager &component_manager) {
+                                      return component_manager.AddComponent<T>(entity);
+                                  }});
+        }
+
+        /**
+         * @brief Records adding a component of type T to an entity
+         * @tparam T Component type
+         * @param entity EntityID to add component to
+         * @param component Component to add
+         */
+        template <typename T>
+        void AddComponent(EntityID entity, T component) {
+            // Held through a shared_ptr so the command stays copyable even when T is move-only
+            auto shared_component = std::make_shared<T>(std::move(component));
+            auto apply = [entity, shared_component](ComponentManager &component_manager) {
+                return component_manager.EmplaceComponent<T>(entity, std::move(*shared_component));
+            };
+
+            m_commands.push_back({CommandType::AddComponent, entity, std::move(apply)});
+        }
+
+        /**
+         * @brief Records removing a component of type T from an entity
+         * @tparam T Component type
+         * @param entity EntityID to remove component from
+         */
+        template <typename T>
+        void RemoveComponent(EntityID entity) {
+            m_commands.push_back({CommandType::RemoveComponent, entity, [entity](ComponentManager &component_manager) {
+                                      if (!component_manager.HasComponent<T>(entity)) {
+                                          return MAX_COMPONENTS;
+                                      }
+
+                                      ComponentID component_id = component_manager.GetComponentID<T>();
+                                      component_manager.RemoveComponent<T>(entity);
+                                      return component_id;
+                                  }});
+        }
+
+        size_t Size() const { return m_commands.size(); }
+        bool Empty() const { return m_commands.empty(); }
+        void Clear() { m_commands.clear(); }
+
+        /**
+         * @brief Moves the recorded commands out of the buffer, leaving it empty
+         * @return Commands in the order they were recorded
+         */
+        std::vector<Command> TakeCommands() { return std::exchange(m_commands, {}); }
+    };
+} // namespace HBE::Application::Managers
\ No newline at end of file
@@ -11,6 +11,8 @@
 #pragma once
 
 #include <memory>
+#include <span>
+#include <utility>
 
 #include <HotBeanEngine/application/managers/logging_manager.hpp>
 
@@ -18,18 +20,25 @@ namespace HBE::Application::Managers {
     using Core::ComponentID;
     using Core::ComponentNameNotDefinedException;
     using Core::ComponentNotRegisteredException;
+    using Core::ComponentTypeIndex;
     using Core::EntityID;
     using Core::IComponent;
     using Core::ISparseSet;
     using Core::MAX_COMPONENTS;
     using Core::MAX_ENTITIES;
     using Core::MaxNumberOfComponentsRegisteredException;
+    using Core::OwningGroup;
     using Core::Signature;
     using Core::SparseSet;
+    using Core::Tick;
 
     /**
      * @brief Manages component registration, addition, removal, and retrieval.
      * Uses sparse sets for efficient component storage and lookup.
+     *
+     * A registered component type keeps its ID and its sparse set until it is explicitly unregistered, even when no
+     * entity has it, so removing the last instance and adding one again reuses the set's pages instead of allocating.
+     * Call Compact() to hand memory that isn't holding components back.
      */
     class ComponentManager {
     private:
@@ -38,6 +47,9 @@ namespace HBE::Application::Managers {
         // Keeps track of the number of component types registered
         ComponentID m_registered_components;
 
+        // Limit on entity IDs passed on to every component sparse set
+        EntityID m_entity_limit;
+
         // Maps ComponentID id to Component Object Type name
         std::unordered_map<ComponentID, std::string> m_component_id_to_name;
 
@@ -48,7 +60,44 @@ namespace HBE::Application::Managers {
         // Direct O(1) access eliminates hash lookup overhead
         std::vector<std::shared_ptr<ISparseSet>> m_component_id_to_data;
 
+        // Vector indexed by ComponentID storing the type index the component was registered with
+        std::vector<ComponentTypeIndex> m_component_id_to_type_index;
+
+        /// @brief Typed lookup entry for a registered component type.
+        struct TypedComponentSet {
+            ISparseSet *sparse_set = nullptr; // Non-owning, the set is owned by m_component_id_to_data
+            ComponentID component_id = 0;
+        };
+
+        // Vector indexed by COMPONENT_TYPE_INDEX<T> so typed lookups skip the name hash and shared_ptr copy
+        std::vector<TypedComponentSet> m_type_index_to_set;
+
+        // Tick every sparse set stamps added and changed components with, moved forward after each system runs
+        Tick m_change_tick = 1;
+
+        // Owning groups, a group lives until the component manager is destroyed
+        std::vector<std::unique_ptr<OwningGroup>> m_groups;
+
+        // Vector indexed by COMPONENT_TYPE_INDEX<T> storing the group that owns T's set, nullptr if it isn't owned
+        std::vector<OwningGroup *> m_type_index_to_group;
+
+        // Scratch list of a group's sets, reused so keeping groups sorted doesn't allocate
+        std::vector<ISparseSet *> m_group_sets;
+
     public:
+        /**
+         * @brief Copy of every component set and the registration they were stored under, taken by CaptureSnapshot().
+         */
+        struct Snapshot {
+            ComponentID registered_components = 0;
+            EntityID entity_limit = 0;
+            std::unordered_map<ComponentID, std::string> component_id_to_name;
+
+            // Indexed by ComponentID, nullptr where no component was registered
+            std::vector<std::unique_ptr<ISparseSet>> component_sets;
+            std::vector<ComponentTypeIndex> component_id_to_type_index;
+        };
+
         ComponentManager(std::shared_ptr<LoggingManager> logging_manager);
         ~ComponentManager() = default;
 
@@ -68,10 +117,57 @@ namespace HBE::Application::Managers {
         IComponent *GetComponent(EntityID entity, ComponentID component_id);
 
         /**
-         * @brief Remove all component instances and reset registration data.
+         * @brief Stamp a component as changed at the current tick.
+         * Needed after writing through GetComponent(entity, component_id), typed access stamps components itself.
+         * @param entity Entity identifier.
+         * @param component_id Registered component ID.
+         */
+        void MarkChanged(EntityID entity, ComponentID component_id);
+
+        /**
+         * @brief Get the tick added and changed components are stamped with right now.
+         * @return Current change tick.
+         */
+        Tick GetChangeTick() const;
+
+        /**
+         * @brief Move the change tick forward so later changes are newer than everything stamped so far.
+         */
+        void AdvanceChangeTick();
+
+        /**
+         * @brief Remove every component instance, component types stay registered and keep their storage.
          */
         void ClearAllComponents();
 
+        /**
+         * @brief Frees the storage every component set isn't using, see ISparseSet::ShrinkToFit().
+         * Components don't move, so references to them stay valid.
+         */
+        void Compact();
+
+        /**
+         * @brief Copy every component set along with the registered component IDs.
+         * Components are copied with their copy constructor or Clone() hook, components that can't be copied are
+         * default constructed in the snapshot.
+         * @return Snapshot that RestoreSnapshot() can bring back.
+         */
+        Snapshot CaptureSnapshot() const;
+
+        /**
+         * @brief Replace every component set and registration with copies of a snapshot's.
+         * Restored components are stamped as added and changed at the current tick, and owning groups are sorted
+         * again. The snapshot is left untouched so it can be restored again.
+         * @param snapshot Snapshot taken by CaptureSnapshot().
+         */
+        void RestoreSnapshot(const Snapshot &snapshot);
+
+        /**
+         * @brief Change the limit on entity IDs for every component sparse set.
+         * @param entity_limit New limit, entity IDs must be below this value.
+         */
+        void SetEntityLimit(EntityID entity_limit);
+
         /**
          * @brief Registers a component type to the Component Manager
          *
@@ -93,7 +189,7 @@ namespace HBE::Application::Managers {
 
             LOG_CORE(LoggingType::DEBUG, "Registering Component \"" + component_name + "\"");
 
-            ComponentID component_id = m_registered_components;
+            ComponentID component_id = GetFreeComponentID();
 
             LOG_CORE(LoggingType::DEBUG, "\tComponentID \"" + std::to_string(component_id) + "\"");
 
@@ -106,10 +202,22 @@ namespace HBE::Application::Managers {
             // Ensure vector capacity for direct O(1) access
             if (m_component_id_to_data.size() <= component_id) {
                 m_component_id_to_data.resize(component_id + 1);
+                m_component_id_to_type_index.resize(component_id + 1);
             }
 
             // Create new sparse set for component data indexed by ComponentID
             m_component_id_to_data[component_id] = std::make_shared<SparseSet<T, MAX_ENTITIES>>();
+            m_component_id_to_data[component_id]->SetMaxItems(m_entity_limit);
+            m_component_id_to_data[component_id]->SetTickSource(&m_change_tick);
+
+            // Cache the set under the type's index for typed lookups
+            const ComponentTypeIndex type_index = Core::COMPONENT_TYPE_INDEX<T>;
+            if (m_type_index_to_set.size() <= type_index) {
+                m_type_index_to_set.resize(type_index + 1);
+            }
+
+            m_type_index_to_set[type_index] = {m_component_id_to_data[component_id].get(), component_id};
+            m_component_id_to_type_index[component_id] = type_index;
 
             m_registered_components++;
 
@@ -141,34 +249,89 @@ namespace HBE::Application::Managers {
                                              std::to_string(entity) + "\"");
 
             // Register component type if it's not already registered
-            if (!IsComponentRegistered(component_name)) {
+            if (!IsComponentRegistered<T>()) {
                 LOG_CORE(LoggingType::DEBUG,
                          "\tEmpty Component \"" + component_name + "\" not registered... Attempting to Register");
 
                 RegisterComponentID<T>();
             }
 
-            std::shared_ptr<SparseSet<T, MAX_ENTITIES>> sparse_set = GetComponentSet<T>();
+            SparseSet<T, MAX_ENTITIES> *sparse_set = GetComponentSet<T>();
 
             if (sparse_set->HasElement(entity)) {
                 LOG_CORE(LoggingType::WARNING, "Component already added to entity!");
-                return m_component_name_to_type[component_name];
+                return GetComponentID<T>();
             }
 
             sparse_set->InsertEmpty(entity);
-            return m_component_name_to_type[component_name];
+            AddToOwningGroup(Core::COMPONENT_TYPE_INDEX<T>, entity);
+            return GetComponentID<T>();
         }
 
+        /**
+         * @brief Adds a default constructed component to every entity in a batch.
+         * Room for the whole batch is allocated up front and only one line is logged.
+         *
+         * @param component_id Registered component to add
+         * @param entities Entities to add the component to, entities that already have it are skipped
+         * @throw ComponentNotRegisteredException
+         */
+        void AddComponents(ComponentID component_id, std::span<const EntityID> entities);
+
+        /**
+         * @brief Removes a component from every entity in a batch.
+         * Only one line is logged for the whole batch.
+         *
+         * @param component_id Registered component to remove
+         * @param entities Entities to remove the component from, entities that don't have it are skipped
+         */
+        void RemoveComponents(ComponentID component_id, std::span<const EntityID> entities);
+
+        /**
+         * @brief Copies every component of one entity to every entity in a batch.
+         * Each of the source's sparse sets is grown once and copies the component straight into its new slots.
+         * Components are copied with their copy constructor or Clone() hook, components that can't be copied are
+         * default constructed, see Core::IS_COMPONENT_COPYABLE.
+         *
+         * @param source Entity to copy the components of
+         * @param entities Entities to copy the components to, components they already have are kept
+         */
+        void CloneComponents(EntityID source, std::span<const EntityID> entities);
+
+        /**
+         * @brief Copies one component that lives outside the world, like a cooked prefab component, to a batch.
+         * The component's sparse set is grown once and copies the component straight into its new slots.
+         *
+         * @param component_id Registered component to add, the source must be of its type
+         * @param source Component to copy
+         * @param entities Entities to copy the component to, entities that already have it are skipped
+         * @throw ComponentNotRegisteredException
+         */
+        void CopyComponents(ComponentID component_id, const IComponent &source, std::span<const EntityID> entities);
+
         /**
          * @brief Adds a component of type T to a given entity.
          *
          * @tparam T Component type
          * @param entity EntityID to add component to
-         * @param component_data Component data
+         * @param component_data Component data, moved into storage
          * @return ComponentID
          */
         template <typename T>
-        ComponentID AddComponent(EntityID entity, T &component_data) {
+        ComponentID AddComponent(EntityID entity, T component_data) {
+            return EmplaceComponent<T>(entity, std::move(component_data));
+        }
+
+        /**
+         * @brief Constructs a component of type T in place on a given entity.
+         *
+         * @tparam T Component type
+         * @param entity EntityID to add component to
+         * @param args Arguments passed to T's constructor
+         * @return ComponentID
+         */
+        template <typename T, typename... Args>
+        ComponentID EmplaceComponent(EntityID entity, Args &&...args) {
             static_assert(std::is_base_of_v<IComponent, T>, "T must inherit from Component");
 
             std::string component_name = std::string(GetComponentName<T>());
@@ -179,22 +342,23 @@ namespace HBE::Application::Managers {
                                              std::to_string(entity) + "\"");
 
             // Register the component type if it's not already registered
-            if (!IsComponentRegistered(component_name)) {
+            if (!IsComponentRegistered<T>()) {
                 LOG_CORE(LoggingType::DEBUG,
                          "\tComponent \"" + component_name + "\" not registered... Attempting to Register");
 
                 RegisterComponentID<T>();
             }
 
-            std::shared_ptr<SparseSet<T, MAX_ENTITIES>> sparse_set = GetComponentSet<T>();
+            SparseSet<T, MAX_ENTITIES> *sparse_set = GetComponentSet<T>();
 
             if (sparse_set->HasElement(entity)) {
                 LOG_CORE(LoggingType::WARNING, "Component already added to entity!");
-                return m_component_name_to_type[component_name];
+                return GetComponentID<T>();
             }
 
-            sparse_set->Insert(entity, component_data);
-            return m_component_name_to_type[component_name];
+            sparse_set->Emplace(entity, std::forward<Args>(args)...);
+            AddToOwningGroup(Core::COMPONENT_TYPE_INDEX<T>, entity);
+            return GetComponentID<T>();
         }
 
         /**
@@ -214,7 +378,7 @@ namespace HBE::Application::Managers {
                                              " EntityID \"" +
                                              std::to_string(entity) + "\"");
 
-            std::shared_ptr<SparseSet<T, MAX_ENTITIES>> sparse_set = GetComponentSet<T>();
+            SparseSet<T, MAX_ENTITIES> *sparse_set = GetComponentSet<T>();
 
             // Check if entity has component
             if (!sparse_set->HasElement(entity)) {
@@ -222,24 +386,13 @@ namespace HBE::Application::Managers {
                 return;
             }
 
-            // Removes entity from component sparse set
+            // Removes entity from component sparse set, leaving its group first so the group stays packed
+            RemoveFromOwningGroup(Core::COMPONENT_TYPE_INDEX<T>, entity);
             sparse_set->Remove(entity);
-
-            // If the last component is removed, the component array must be destroyed and unregistered
-            if (sparse_set->Size() == 0) {
-                LOG_CORE(LoggingType::DEBUG,
-                         "\tAll \"" + component_name + "\" Components removed... Destroying Component Array");
-
-                ComponentID component_id = m_component_name_to_type[component_name];
-                m_component_id_to_name.erase(component_id);
-                m_component_name_to_type.erase(component_name);
-                m_component_id_to_data[component_id] = nullptr;
-                m_registered_components--;
-            }
         }
 
         /**
-         * @brief Get the Component object data
+         * @brief Get the Component object data, stamps the component as changed
          *
          * @tparam T The type of component
          * @param entity EntityID to get component data from
@@ -250,9 +403,37 @@ namespace HBE::Application::Managers {
             return GetComponentSet<T>()->GetElementAsRef(entity);
         }
 
+        /**
+         * @brief Get the Component object data for reading, doesn't stamp the component as changed
+         *
+         * @tparam T The type of component
+         * @param entity EntityID to get component data from
+         * @return const T& The component data
+         */
+        template <typename T>
+        const T &GetComponentData(EntityID entity) const {
+            return std::as_const(*GetComponentSet<T>()).GetElementAsRef(entity);
+        }
+
+        /**
+         * @brief Get when an entity's component of type T was added and last changed
+         *
+         * @tparam T The type of component
+         * @param entity EntityID to get the ticks of
+         * @return Pointer to the ticks, or nullptr if the entity doesn't have the component
+         */
+        template <typename T>
+        const Core::ComponentTicks *GetComponentTicks(EntityID entity) const noexcept {
+            const SparseSet<T, MAX_ENTITIES> *sparse_set = TryGetComponentSet<T>();
+            if (!sparse_set) {
+                return nullptr;
+            }
+            return sparse_set->GetTicks(entity);
+        }
+
         template <typename T>
         T *TryGetComponentData(EntityID entity) noexcept {
-            auto sparse_set = TryGetComponentSet<T>();
+            SparseSet<T, MAX_ENTITIES> *sparse_set = TryGetComponentSet<T>();
 
             if (!sparse_set) {
                 return nullptr;
@@ -271,14 +452,15 @@ namespace HBE::Application::Managers {
         ComponentID GetComponentID() {
             static_assert(std::is_base_of_v<IComponent, T>, "T must inherit from Component");
 
-            if (!IsComponentRegistered<T>()) {
+            const TypedComponentSet *typed_set = TryGetTypedComponentSet<T>();
+
+            if (!typed_set) {
                 auto ex = ComponentNotRegisteredException(std::string(GetComponentName<T>()));
                 LOG_CORE(LoggingType::ERROR, ex.what());
                 throw ex;
             }
-            else {
-                return m_component_name_to_type[std::string(GetComponentName<T>())];
-            }
+
+            return typed_set->component_id;
         }
 
         /**
@@ -289,6 +471,14 @@ namespace HBE::Application::Managers {
          */
         ComponentID GetComponentID(std::string_view component_name);
 
+        /**
+         * @brief Get the function table of a registered component
+         *
+         * @param component_id The component to look up
+         * @return The component type's table, or nullptr if the component is not registered
+         */
+        const Core::ComponentOps *GetComponentOps(ComponentID component_id) const;
+
         /**
          * @brief Checks if an entity has a component of type T
          *
@@ -298,7 +488,7 @@ namespace HBE::Application::Managers {
          */
         template <typename T>
         bool HasComponent(EntityID entity) const {
-            auto sparse_set = TryGetComponentSet<T>();
+            const SparseSet<T, MAX_ENTITIES> *sparse_set = TryGetComponentSet<T>();
             if (!sparse_set) {
                 return false;
             }
@@ -341,41 +531,137 @@ namespace HBE::Application::Managers {
 
         template <typename T>
         bool IsComponentRegistered() const {
-            return IsComponentRegistered(std::string(GetComponentName<T>()));
+            return TryGetTypedComponentSet<T>() != nullptr;
+        }
+
+        /**
+         * @brief Creates a view over all entities that have every component in Components
+         *
+         * @tparam Components The types of component, const types are viewed read-only
+         * @return Core::View<Components...> Empty view if any component is not registered
+         */
+        template <typename... Components>
+        Core::View<Components...> View() const noexcept {
+            return Core::View<Components...>(TryGetComponentSet<std::remove_const_t<Components>>()...);
+        }
+
+        /**
+         * @brief Gets the owning group of Components, creating it the first time it's asked for
+         *
+         * Creating a group registers its component types and sorts the entities that already have all of them. After
+         * that the group is kept sorted as components are added and removed.
+         *
+         * @tparam Components The types of component, const types are iterated read-only
+         * @return Core::Group<Components...> Handle to the group
+         * @throw ComponentAlreadyOwnedException if another group already owns one of the components
+         */
+        template <typename... Components>
+        Core::Group<Components...> Group() {
+            (RegisterIfNeeded<std::remove_const_t<Components>>(), ...);
+
+            const OwningGroup &group =
+                GetOrCreateGroup({Core::COMPONENT_TYPE_INDEX<std::remove_const_t<Components>>...});
+            return Core::Group<Components...>(&group, GetComponentSet<std::remove_const_t<Components>>()...);
         }
 
     private:
+        template <typename T>
+        void RegisterIfNeeded() {
+            if (!IsComponentRegistered<T>()) {
+                RegisterComponentID<T>();
+            }
+        }
+
+        /**
+         * @brief Finds the lowest ComponentID no registered component type is using
+         * IDs of types that are still registered are never handed out again, so signatures, systems and cached
+         * queries built from them stay correct.
+         * @return ComponentID Free ID, below MAX_COMPONENTS when fewer than MAX_COMPONENTS types are registered
+         */
+        ComponentID GetFreeComponentID() const;
+
+        /**
+         * @brief Finds the group that owns exactly the given component types, or creates and sorts it
+         *
+         * @param owned_types Component types the group owns
+         * @return OwningGroup& The group
+         * @throw ComponentAlreadyOwnedException if a different group already owns one of the types
+         */
+        OwningGroup &GetOrCreateGroup(std::vector<ComponentTypeIndex> owned_types);
+
+        /**
+         * @brief Fills m_group_sets with the current sparse sets of a group's owned types
+         * @param group Group to look up the sets of
+         * @return std::span<ISparseSet *const> One set per owned type, nullptr for unregistered types
+         */
+        std::span<ISparseSet *const> GetGroupSets(const OwningGroup &group);
+
+        /**
+         * @brief Moves an entity into the group owning a component type, if any, after the component was added
+         * @param type_index Component type that was added
+         * @param entity Entity the component was added to
+         */
+        void AddToOwningGroup(ComponentTypeIndex type_index, EntityID entity);
+
+        /**
+         * @brief Moves an entity out of the group owning a component type, if any, before the component is removed
+         * @param type_index Component type about to be removed
+         * @param entity Entity the component is removed from
+         */
+        void RemoveFromOwningGroup(ComponentTypeIndex type_index, EntityID entity);
+
+        /**
+         * @brief Retrieves the typed lookup entry for component type T.
+         *
+         * @tparam T The type of component
+         * @return Pointer to the entry, or nullptr if T is not registered
+         */
+        template <typename T>
+        const TypedComponentSet *TryGetTypedComponentSet() const noexcept {
+            const ComponentTypeIndex type_index = Core::COMPONENT_TYPE_INDEX<T>;
+
+            if (type_index >= m_type_index_to_set.size() || !m_type_index_to_set[type_index].sparse_set) {
+                return nullptr;
+            }
+
+            return &m_type_index_to_set[type_index];
+        }
+
         /**
          * @brief Retrieves the sparse set of component data associated with the given component type.
          *
          * @tparam T The type of component data to be retrieved.
-         * @return A shared pointer to the sparse set of component data.
+         * @return A pointer to the sparse set of component data.
          * @throw ComponentNotRegisteredException
          */
         template <typename T>
-        std::shared_ptr<SparseSet<T, MAX_ENTITIES>> GetComponentSet() const {
-            const std::string component_name = std::string(GetComponentName<T>());
+        SparseSet<T, MAX_ENTITIES> *GetComponentSet() const {
+            SparseSet<T, MAX_ENTITIES> *sparse_set = TryGetComponentSet<T>();
 
-            if (!IsComponentRegistered(component_name)) {
-                auto ex = ComponentNotRegisteredException(component_name);
+            if (!sparse_set) {
+                auto ex = ComponentNotRegisteredException(GetComponentName<T>());
                 LOG_CORE(LoggingType::ERROR, ex.what());
                 throw ex;
             }
 
-            ComponentID component_id = m_component_name_to_type.find(component_name)->second;
-            return std::static_pointer_cast<SparseSet<T, MAX_ENTITIES>>(m_component_id_to_data[component_id]);
+            return sparse_set;
         }
 
+        /**
+         * @brief Retrieves the sparse set of component data associated with the given component type.
+         *
+         * @tparam T The type of component data to be retrieved.
+         * @return A pointer to the sparse set of component data, or nullptr if T is not registered.
+         */
         template <typename T>
-        std::shared_ptr<SparseSet<T, MAX_ENTITIES>> TryGetComponentSet() const noexcept {
-            const std::string component_name = std::string(GetComponentName<T>());
+        SparseSet<T, MAX_ENTITIES> *TryGetComponentSet() const noexcept {
+            const TypedComponentSet *typed_set = TryGetTypedComponentSet<T>();
 
-            if (!IsComponentRegistered(component_name)) {
+            if (!typed_set) {
                 return nullptr;
             }
 
-            ComponentID component_id = m_component_name_to_type.find(component_name)->second;
-            return std::static_pointer_cast<SparseSet<T, MAX_ENTITIES>>(m_component_id_to_data[component_id]);
+            return static_cast<SparseSet<T, MAX_ENTITIES> *>(typed_set->sparse_set);
         }
 
         /**
@@ -8,6 +8,9 @@
  * all entities, components, and systems in the game. This class handles all the backend management of the ECS framework
  * and has been further expanded by gameobject classes that act as a single class. Gameobjects follow the ECS framework
  * but are able to be manipulated by the user directly without a system.
+ *
+ * Every ECSManager is an independent world. Any number can be created next to the application's one, for example to
+ * run headless simulations, and stepped concurrently with StepWorlds().
  * @version 0.1
  * @date 2025-02-18
  *
@@ -16,18 +19,49 @@
 
 #pragma once
 
+#include <array>
+#include <functional>
+#include <set>
+#include <span>
+
 #include <HotBeanEngine/application/listeners/component_listener.hpp>
+#include <HotBeanEngine/application/managers/command_buffer.hpp>
 #include <HotBeanEngine/application/managers/component_manager.hpp>
 #include <HotBeanEngine/application/managers/entity_manager.hpp>
 #include <HotBeanEngine/application/managers/system_manager.hpp>
 
 namespace HBE::Application::Managers {
     using Core::ComponentID;
+    using Core::EntityHandle;
     using Core::EntityID;
     using Core::IArchetype;
+    using Core::QueryFilter;
     using Core::Signature;
     using Listeners::ComponentListener;
 
+    /**
+     * @brief Copy of a whole world, taken by ECSManager::CaptureSnapshot() and brought back by RestoreSnapshot().
+     *
+     * Holds a copy of every component set, the entity bookkeeping and the entities of each system, so restoring a
+     * world doesn't go through a serializer or recreate entities one at a time. A snapshot can be restored any number
+     * of times, but only into the ECSManager that took it.
+     */
+    class WorldSnapshot {
+    private:
+        friend class ECSManager;
+
+        EntityManager::Snapshot m_entities;
+        ComponentManager::Snapshot m_components;
+        SystemManager::Snapshot m_systems;
+
+    public:
+        /**
+         * @brief Get the number of entities in the snapshot.
+         * @return Count of entities that were alive when the snapshot was taken.
+         */
+        size_t EntityCount() const { return m_entities.alive_entities.size(); }
+    };
+
     /**
      * @brief Coordinates between entity, component, and system managers.
      */
@@ -36,7 +70,44 @@ namespace HBE::Application::Managers {
         std::unique_ptr<EntityManager> m_entity_manager;
         std::shared_ptr<ComponentManager> m_component_manager;
         std::unique_ptr<SystemManager> m_system_manager;
-        std::vector<Listeners::ComponentListener *> m_component_listeners;
+        std::unique_ptr<CommandBuffer> m_command_buffer;
+        std::shared_ptr<JobManager> m_job_manager;
+
+        // Listeners interested in each component, indexed by ComponentID
+        std::array<std::vector<ComponentListener *>, MAX_COMPONENTS> m_component_listeners;
+
+        std::vector<EntityID> SpawnBatch(std::span<const ComponentID> component_ids, size_t count,
+                                         const std::function<void(EntityID, size_t)> &initializer);
+
+        // Required query term, a component that isn't registered yet can't match any entity
+        template <typename T>
+        void AddQueryTerm(QueryFilter &filter, bool &satisfiable, T *) {
+            if (IsComponentRegistered<T>()) {
+                filter.with.set(GetComponentID<T>());
+            }
+            else {
+                satisfiable = false;
+            }
+        }
+
+        // Excluded components that aren't registered yet can't be on any entity, so they're left out
+        template <typename... Cs>
+        void AddQueryTerm(QueryFilter &filter, bool &, Core::Without<Cs...> *) {
+            ((IsComponentRegistered<Cs>() ? void(filter.without.set(GetComponentID<Cs>())) : void()), ...);
+        }
+
+        // Optional components don't change which entities match
+        template <typename... Cs>
+        void AddQueryTerm(QueryFilter &, bool &, Core::Optional<Cs...> *) {}
+
+        static const EntitySet &EmptyQueryResult();
+
+        void NotifyComponentsAdded(ComponentID component_id, std::span<const EntityID> entities);
+        void NotifyComponentRemoved(ComponentID component_id, EntityID entity, const Signature &signature);
+        void NotifyComponentsRemoved(EntityID entity, Signature signature, const Signature &remaining_signature);
+        void NotifyEntitiesDestroyed(std::span<const EntityID> entities, bool all_entities);
+
+        void DestroyEntities(std::span<const EntityID> entities);
 
     public:
         std::shared_ptr<LoggingManager> m_logging_manager;
@@ -45,18 +116,131 @@ namespace HBE::Application::Managers {
         // Constructor / Destructor
         // ============================================================================
 
-        ECSManager(std::shared_ptr<LoggingManager> logging_manager);
+        /**
+         * @param logging_manager Logger shared with the other managers
+         * @param job_manager Worker pool used to run systems in parallel, systems run on the calling thread without one
+         */
+        ECSManager(std::shared_ptr<LoggingManager> logging_manager, std::shared_ptr<JobManager> job_manager = nullptr);
         ~ECSManager() = default;
 
+        // Registered systems point back at their ECSManager, so it stays where it was created
+        ECSManager(const ECSManager &) = delete;
+        ECSManager &operator=(const ECSManager &) = delete;
+
         // ============================================================================
         // Entity Management
         // ============================================================================
 
         EntityID CreateEntity();
+        std::vector<EntityID> CreateEntities(size_t count);
         void DestroyEntity(EntityID entity);
         void DestroyAllEntities();
         EntityID EntityCount() const;
         std::vector<EntityID> GetAllEntities();
+        EntityID GetEntityLimit() const;
+        bool SetEntityLimit(EntityID entity_limit);
+        bool IsEntityAlive(EntityID entity) const;
+        EntityHandle GetEntityHandle(EntityID entity) const;
+        bool IsEntityValid(EntityHandle handle) const;
+
+        // ============================================================================
+        // Snapshots
+        // ============================================================================
+
+        /**
+         * @brief Copy the whole world: every component, the entity bookkeeping and the entities of each system.
+         * Components are copied with their copy constructor or Clone() hook, see Core::IS_COMPONENT_COPYABLE.
+         * @return Snapshot that RestoreSnapshot() can bring back.
+         */
+        WorldSnapshot CaptureSnapshot() const;
+
+        /**
+         * @brief Replace the whole world with a snapshot taken by this ECSManager.
+         *
+         * Systems get OnEntityRemoved() for every current entity and OnEntityAdded() for every restored one, listeners
+         * are told about removed and added components the same way, and restored components count as added and
+         * changed. Commands waiting in the command buffer belong to the replaced world and are dropped.
+         *
+         * @param snapshot Snapshot to restore, left untouched.
+         */
+        void RestoreSnapshot(const WorldSnapshot &snapshot);
+
+        // ============================================================================
+        // Batch Spawning
+        // ============================================================================
+
+        /**
+         * @brief Spawns a batch of entities that all start with the archetype's components.
+         * Pools are grown once, the signature is built once and each system and listener is matched once per batch.
+         * @param archetype Archetype listing the registered components every entity gets
+         * @param count Number of entities to spawn
+         * @param initializer Called with each entity and its index in the batch to set up its components before
+         * systems and listeners see it
+         * @return std::vector<EntityID> Spawned entities, fewer than count if the entity limit is reached
+         * @throw ComponentNotRegisteredException
+         */
+        std::vector<EntityID> SpawnBatch(IArchetype *archetype, size_t count,
+                                         const std::function<void(EntityID, size_t)> &initializer = nullptr);
+
+        /**
+         * @brief Spawns a batch of entities that all start with components Cs. Registers any unregistered components.
+         * @tparam Cs Component types every entity gets
+         * @param count Number of entities to spawn
+         * @param initializer Called with each entity and its index in the batch to set up its components before
+         * systems and listeners see it
+         * @return std::vector<EntityID> Spawned entities, fewer than count if the entity limit is reached
+         */
+        template <typename... Cs>
+        std::vector<EntityID> SpawnBatch(size_t count,
+                                         const std::function<void(EntityID, size_t)> &initializer = nullptr) {
+            std::vector<ComponentID> component_ids = {
+                (IsComponentRegistered<Cs>() ? GetComponentID<Cs>() : RegisterComponentID<Cs>())...};
+            return SpawnBatch(component_ids, count, initializer);
+        }
+
+        /**
+         * @brief Spawns copies of an entity, each with a copy of every component the source has.
+         * Components are copied straight from the source's slot into each pool, the signature is shared and each
+         * system and listener is matched once for the whole batch, like SpawnBatch(). Children aren't cloned, clones
+         * of a child have the same parent.
+         * @param source Living entity to copy
+         * @param count Number of copies to spawn
+         * @return std::vector<EntityID> Spawned copies, fewer than count if the entity limit is reached, empty if the
+         * source isn't alive
+         */
+        std::vector<EntityID> CloneEntity(EntityID source, size_t count = 1);
+
+        /**
+         * @brief Spawns instances of a cooked prefab, children included.
+         * Each of the prefab's component blobs is copied straight into its pool for every instance at once, and each
+         * system and listener is matched once per prefab node. Components with a parent link, like Transform2D, are
+         * pointed at the same instance's entities, the root's at parent.
+         * @param prefab Prefab cooked for this world, see Managers::PrefabManager
+         * @param count Number of instances to spawn
+         * @param parent Entity to place each instance's root under, -1 for none
+         * @return std::vector<EntityID> Root entity of each instance, fewer than count if the entity limit is reached
+         * @throw ComponentNotRegisteredException if a component the prefab was cooked with isn't registered anymore
+         */
+        std::vector<EntityID> InstantiatePrefab(const Core::Prefab &prefab, size_t count = 1, EntityID parent = -1);
+
+        // ============================================================================
+        // Deferred Changes
+        // ============================================================================
+
+        /**
+         * @brief Get the engine's command buffer. It is flushed once per frame after rendering.
+         * @return CommandBuffer& Buffer to record entity and component changes into
+         */
+        CommandBuffer &GetCommandBuffer();
+
+        /**
+         * @brief Create a separate command buffer, apply it with Flush(CommandBuffer &)
+         * @return CommandBuffer Empty buffer that reserves entities from this ECSManager
+         */
+        CommandBuffer CreateCommandBuffer();
+
+        void Flush();
+        void Flush(CommandBuffer &command_buffer);
 
         // ============================================================================
         // Component Management - Registration
@@ -69,11 +253,20 @@ namespace HBE::Application::Managers {
 
         template <typename T>
         void UnregisterComponentID() {
-            m_component_manager->UnregisterComponentID<T>();
+            if (IsComponentRegistered<T>()) {
+                UnregisterComponentID(GetComponentName(GetComponentID<T>()));
+            }
         }
 
         void UnregisterComponentID(std::string component_name);
 
+        /**
+         * @brief Frees component storage that isn't holding components, see ComponentManager::Compact()
+         * Component types stay registered when their last instance is removed, so their storage is reused. Call this
+         * when that memory really needs to go back, like after unloading a level, not every frame.
+         */
+        void CompactComponents();
+
         template <typename T>
         bool IsComponentRegistered() const {
             return m_component_manager->IsComponentRegistered<T>();
@@ -107,7 +300,19 @@ namespace HBE::Application::Managers {
          */
         template <typename T>
         void AddComponent(EntityID entity, T component) {
-            ComponentID component_id = m_component_manager->AddComponent<T>(entity, component);
+            Emplace<T>(entity, std::move(component));
+        }
+
+        /**
+         * @brief Constructs a component of type T in place on an entity. Registers if not already registered.
+         * Nothing is copied or moved, so this also works for components that can't be copied.
+         * @tparam T Component type
+         * @param entity EntityID to add component to
+         * @param args Arguments passed to T's constructor
+         */
+        template <typename T, typename... Args>
+        void Emplace(EntityID entity, Args &&...args) {
+            ComponentID component_id = m_component_manager->EmplaceComponent<T>(entity, std::forward<Args>(args)...);
             Signature signature = m_entity_manager->SetSignature(entity, component_id);
             m_system_manager->EntitySignatureChanged(entity, signature);
             NotifyComponentAdded(component_id, entity);
@@ -120,25 +325,88 @@ namespace HBE::Application::Managers {
          */
         template <typename T>
         void RemoveComponent(EntityID entity) {
-            Signature signature = m_entity_manager->SetSignature(entity, GetComponentID<T>(), false);
+            ComponentID component_id = GetComponentID<T>();
+            bool had_component = m_entity_manager->HasComponent(entity, component_id);
+
+            Signature signature = m_entity_manager->SetSignature(entity, component_id, false);
             m_system_manager->EntitySignatureChanged(entity, signature);
             m_component_manager->RemoveComponent<T>(entity);
-            NotifyComponentRemoved(entity);
+
+            if (had_component) {
+                NotifyComponentRemoved(component_id, entity, signature);
+            }
         }
 
         void RemoveAllComponents(EntityID entity);
 
         /**
          * @brief Get the Component object
-         * @tparam T The type of component
+         * A non-const T stamps the component as changed, ask for const T when only reading it.
+         * @tparam T The type of component, const to read it without marking it changed
          * @param entity EntityID to get component from
          * @return T& Reference to the component
          */
         template <typename T>
         T &GetComponent(EntityID entity) {
-            return m_component_manager->GetComponentData<T>(entity);
+            if constexpr (std::is_const_v<T>) {
+                const ComponentManager &component_manager = *m_component_manager;
+                return component_manager.GetComponentData<std::remove_const_t<T>>(entity);
+            }
+            else {
+                return m_component_manager->GetComponentData<T>(entity);
+            }
+        }
+
+        // ============================================================================
+        // Component Management - Change Detection
+        // ============================================================================
+
+        /**
+         * @brief Stamp an entity's component as changed without touching it
+         * @tparam T Component type
+         * @param entity EntityID whose component changed
+         */
+        template <typename T>
+        void MarkChanged(EntityID entity) {
+            if (IsComponentRegistered<T>()) {
+                m_component_manager->MarkChanged(entity, GetComponentID<T>());
+            }
         }
 
+        void MarkChanged(EntityID entity, ComponentID component_id);
+
+        /**
+         * @brief Checks if an entity's component was changed or added after a tick
+         * @tparam T Component type
+         * @param entity EntityID to check
+         * @param since Tick to compare against, usually SystemBase::GetLastRunTick()
+         * @return False if the entity doesn't have the component
+         */
+        template <typename T>
+        bool IsChanged(EntityID entity, Tick since) const {
+            const Core::ComponentTicks *ticks = m_component_manager->GetComponentTicks<T>(entity);
+            return ticks && ticks->IsChanged(since);
+        }
+
+        /**
+         * @brief Checks if an entity's component was added after a tick
+         * @tparam T Component type
+         * @param entity EntityID to check
+         * @param since Tick to compare against, usually SystemBase::GetLastRunTick()
+         * @return False if the entity doesn't have the component
+         */
+        template <typename T>
+        bool IsAdded(EntityID entity, Tick since) const {
+            const Core::ComponentTicks *ticks = m_component_manager->GetComponentTicks<T>(entity);
+            return ticks && ticks->IsAdded(since);
+        }
+
+        /**
+         * @brief Get the tick added and changed components are stamped with right now
+         * @return Current change tick
+         */
+        Tick GetChangeTick() const { return m_component_manager->GetChangeTick(); }
+
         template <typename T>
         T *TryGetComponent(EntityID entity) noexcept {
             return m_component_manager->TryGetComponentData<T>(entity);
@@ -152,19 +420,97 @@ namespace HBE::Application::Managers {
 
         /**
          * @brief Get all Entities that have all specified component types.
-         * @warning USE THIS SPARINGLY! Use Systems instead for better performance.
+         * Copies the cached result of Query<Components...>() into a std::set, use Query() to skip the copy.
          * @tparam Components
          * @return std::set<EntityID>
          */
         template <typename... Components>
         std::set<EntityID> GetEntitiesWithComponents() {
-            std::set<EntityID> result;
-            for (EntityID entity : GetAllEntities()) {
-                if ((HasComponent<Components>(entity) && ...)) {
-                    result.insert(entity);
-                }
+            const EntitySet &entities = Query<Components...>();
+            return std::set<EntityID>(entities.begin(), entities.end());
+        }
+
+        /**
+         * @brief Get every entity matching a query
+         *
+         * Plain terms are components the entity must have, Core::Without<...> lists components it must not have and
+         * Core::Optional<...> lists components it may have. Optional terms don't change the result, read them with
+         * TryGetComponent(). The first ask scans every entity. Asking again makes the query persistent, its result is
+         * then kept up to date as entities change, so every later ask is free and iterating costs O(matches):
+         * @code
+         * for (EntityID entity : g_ecs.Query<Camera, Core::Without<Hidden>, Core::Optional<Transform2D>>()) {
+         * }
+         * @endcode
+         *
+         * @warning Adding or removing components, or destroying entities, changes the set while iterating it. Don't
+         * ask for queries from systems running in parallel.
+         * @tparam Terms Component types and Core::Without / Core::Optional terms, with at least one component type
+         * @return const EntitySet& Matching entities, valid until a component the query uses is unregistered
+         */
+        template <typename... Terms>
+        const EntitySet &Query() {
+            static_assert(((!Core::IS_QUERY_MODIFIER<Terms>) || ...), "A query needs at least one required component");
+
+            QueryFilter filter;
+            bool satisfiable = true;
+            (AddQueryTerm(filter, satisfiable, static_cast<Terms *>(nullptr)), ...);
+
+            return satisfiable ? Query(filter) : EmptyQueryResult();
+        }
+
+        /**
+         * @brief Get every entity matching a query filter, see Query<Terms...>()
+         * @param filter Components matching entities must and must not have
+         * @return const EntitySet& Matching entities, valid until a component the query uses is unregistered
+         * @throw std::invalid_argument if the filter doesn't require any component
+         */
+        const EntitySet &Query(const QueryFilter &filter);
+
+        /**
+         * @brief Get a view over all Entities that have all specified component types.
+         * Walks the smallest component pool and yields the components directly, so prefer this over
+         * GetEntitiesWithComponents when the components are going to be read or written.
+         * @tparam Components Component types, const types are viewed read-only
+         * @return Core::View<Components...>
+         */
+        template <typename... Components>
+        Core::View<Components...> View() const {
+            return m_component_manager->View<Components...>();
+        }
+
+        /**
+         * @brief Calls func for every entity with all of Components, spread across the job manager's workers
+         *
+         * Runs on the calling thread when the ECSManager was created without a job manager. See parallel.hpp for what
+         * func may and may not do.
+         *
+         * @tparam Components Component types an entity must have, mark read-only components const
+         * @param func Callable taking (EntityID, Components &...)
+         */
+        template <typename... Components, typename Func>
+        void ParallelForEach(Func &&func) const {
+            if (m_job_manager) {
+                View<Components...>().ParallelForEach(*m_job_manager, std::forward<Func>(func));
+            }
+            else {
+                View<Components...>().Each(std::forward<Func>(func));
             }
-            return result;
+        }
+
+        /**
+         * @brief Gets the owning group of Components, creating it the first time it's asked for
+         *
+         * The group keeps the entities that have every component at the front of each component's storage, in the
+         * same order, so iterating them is a zipped loop over arrays. Ask for the group once up front, for example in
+         * a system's OnStart(), so entities are sorted into it as they're built.
+         *
+         * @tparam Components Component types owned by the group, mark read-only components const
+         * @return Core::Group<Components...> Handle to the group
+         * @throw ComponentAlreadyOwnedException if another group already owns one of the components
+         */
+        template <typename... Components>
+        Core::Group<Components...> Group() {
+            return m_component_manager->Group<Components...>();
         }
 
         /**
@@ -193,6 +539,7 @@ namespace HBE::Application::Managers {
 
         ComponentID GetComponentID(std::string component_name) const;
         std::string GetComponentName(ComponentID component_id) const;
+        const Core::ComponentOps *GetComponentOps(ComponentID component_id) const;
 
         // ============================================================================
         // System Management - Registration / Unregistration
@@ -208,6 +555,7 @@ namespace HBE::Application::Managers {
         template <typename T, typename... Args>
         T &RegisterSystem(Args &&...params) {
             T &system = m_system_manager->RegisterSystem<T, Args...>(std::forward<Args>(params)...);
+            system.m_world = this;
             return system;
         }
 
@@ -219,6 +567,7 @@ namespace HBE::Application::Managers {
         template <typename T>
         T &RegisterSystem() {
             T &system = m_system_manager->RegisterSystem<T>();
+            system.m_world = this;
             return system;
         }
 
@@ -304,6 +653,12 @@ namespace HBE::Application::Managers {
 
         std::vector<SystemBase *> GetAllSystems();
 
+        /**
+         * @brief Enable or disable running non-conflicting systems at the same time during updates
+         * @param enabled False runs every system sequentially in registration order
+         */
+        void SetParallelExecution(bool enabled);
+
         // ============================================================================
         // Game Loop / Iteration
         // ============================================================================
@@ -321,59 +676,70 @@ namespace HBE::Application::Managers {
          */
         void IterateSystems(SDL_Event &event, GameLoopState state);
 
+        // ============================================================================
+        // Multiple Worlds
+        // ============================================================================
+
+        /**
+         * @brief Runs a game loop method in several worlds at the same time, one job per world
+         *
+         * ECSManagers don't share any state, so separate worlds can run on separate worker threads. Their systems must
+         * reach entities through SystemBase::GetWorld() and stay away from g_ecs and other application singletons.
+         *
+         * @param job_manager Worker pool to run the worlds on, the calling thread runs some of them as well
+         * @param worlds Worlds to run, each listed at most once
+         * @param state The game loop state
+         * @throws Rethrows the first exception thrown by any world's systems
+         */
+        static void IterateWorlds(JobManager &job_manager, std::span<ECSManager *const> worlds, GameLoopState state);
+
+        /**
+         * @brief Steps several headless worlds forward at the same time, one job per world
+         *
+         * Each step runs OnFixedUpdate() and OnUpdate() then applies the world's command buffer. A world runs all of
+         * its steps in one job, so worlds don't wait for each other between steps.
+         *
+         * @param job_manager Worker pool to run the worlds on, the calling thread runs some of them as well
+         * @param worlds Worlds to step, each listed at most once
+         * @param step_count Number of steps to run in every world
+         * @throws Rethrows the first exception thrown by any world's systems
+         */
+        static void StepWorlds(JobManager &job_manager, std::span<ECSManager *const> worlds, size_t step_count = 1);
+
         // ============================================================================
         // Component Listeners
         // ============================================================================
 
         /**
          * @brief Register a listener to receive component change notifications.
+         * The listener is only called about the components it listened for before it was registered.
          * @param listener The listener to register.
          */
         void RegisterComponentListener(ComponentListener *listener);
 
         /**
-         * @brief Notify all listeners that a component was added to an entity.
-         * @param entity The entity ID that was added.
-         */
-        void NotifyComponentAdded(ComponentID component_id, EntityID entity) {
-            for (ComponentListener *listener : m_component_listeners) {
-                const auto &listened_components = listener->GetListenedComponents();
-                if (listened_components.count(component_id)) {
-                    // Check if entity now has all components the listener is interested in
-                    bool has_all_components = true;
-                    for (ComponentID id : listened_components) {
-                        if (!HasComponent(entity, id)) {
-                            has_all_components = false;
-                            break;
-                        }
-                    }
-                    if (has_all_components) {
-                        listener->OnComponentAdded(m_component_manager->GetComponent(entity, component_id), entity);
-                    }
-                }
-            }
-        }
+         * @brief Notify listeners that a batch of entities sharing one signature gained a component.
+         * Each interested listener gets one OnComponentsAdded() call for the whole batch.
+         * @param component_id The component that was added.
+         * @param entities The entities that gained the component.
+         * @param signature The signature shared by every entity in the batch.
+         */
+        void NotifyComponentsAdded(ComponentID component_id, std::span<const EntityID> entities,
+                                   const Signature &signature);
 
         /**
-         * @brief Notify all listeners that a component was removed from an entity.
-         * @param entity The entity ID that was removed.
+         * @brief Notify listeners of a component that it was added to an entity.
+         * @param component_id The component that was added.
+         * @param entity The entity ID that gained the component.
          */
-        void NotifyComponentRemoved(EntityID entity) {
-            for (ComponentListener *listener : m_component_listeners) {
-                const auto &listened_components = listener->GetListenedComponents();
-                // Check if entity still has all components the listener is interested in
-                bool has_all_components = true;
-                for (ComponentID id : listened_components) {
-                    if (!HasComponent(entity, id)) {
-                        has_all_components = false;
-                        break;
-                    }
-                }
-                // Only notify if entity no longer has all required components
-                if (!has_all_components) {
-                    listener->OnComponentRemoved(entity);
-                }
-            }
-        }
+        void NotifyComponentAdded(ComponentID component_id, EntityID entity);
+
+        /**
+         * @brief Notify listeners of a component that it was removed from an entity.
+         * Only listeners whose components the entity had until now are called.
+         * @param component_id The component that was removed.
+         * @param entity The entity ID that lost the component.
+         */
+        void NotifyComponentRemoved(ComponentID component_id, EntityID entity);
     };
 } // namespace HBE::Application::Managers
\ No newline at end of file
@@ -9,14 +9,15 @@
  */
 #pragma once
 
-#include <queue>
+#include <span>
 
 #include <HotBeanEngine/application/managers/logging_manager.hpp>
 
 namespace HBE::Application::Managers {
     using Core::ComponentID;
+    using Core::EntityGeneration;
+    using Core::EntityHandle;
     using Core::EntityID;
-    using Core::MAX_ENTITIES;
     using Core::Signature;
 
     /**
@@ -26,21 +27,59 @@ namespace HBE::Application::Managers {
      */
     class EntityManager {
     private:
+        static constexpr Uint32 NO_ENTITY = EntityHandle::INVALID_INDEX;
+
+        /**
+         * @brief Bookkeeping for one entity ID.
+         * Slots are kept after the entity is destroyed so the generation survives recycling.
+         */
+        struct EntitySlot {
+            // Bumped every time the entity using this ID is destroyed
+            EntityGeneration generation = 0;
+
+            // Position in m_alive_entities, NO_ENTITY while the ID is not in use
+            Uint32 alive_index = NO_ENTITY;
+
+            // Next ID in the free list while this ID is waiting to be recycled
+            Uint32 next_free = NO_ENTITY;
+        };
+
         // Logging manager
         std::shared_ptr<LoggingManager> m_logging_manager;
 
-        // Queue of unused entity IDs
-        std::queue<EntityID> m_available_entities;
+        // Slots where the index corresponds to the entity ID, grows as new IDs are handed out
+        std::vector<EntitySlot> m_slots;
 
-        std::unordered_map<EntityID, bool> m_alive_entities;
+        // Living entities packed together for iteration
+        std::vector<EntityID> m_alive_entities;
 
-        // Array of signatures where the index corresponds to the entity ID
-        std::array<Signature, MAX_ENTITIES> m_signatures;
+        // Intrusive FIFO list of recycled entity IDs threaded through EntitySlot::next_free
+        Uint32 m_free_head = NO_ENTITY;
+        Uint32 m_free_tail = NO_ENTITY;
 
-        // Total living entities - used to keep limits on how many exist
-        EntityID m_living_entity_count = 0;
+        // Next entity ID that has never been handed out
+        EntityID m_next_entity_id = 0;
+
+        // Soft limit on the number of entities, IDs are always below this value
+        EntityID m_entity_limit;
+
+        // Signatures where the index corresponds to the entity ID, grows as new IDs are handed out
+        std::vector<Signature> m_signatures;
 
     public:
+        /**
+         * @brief Copy of every entity's bookkeeping, taken by CaptureSnapshot().
+         */
+        struct Snapshot {
+            std::vector<EntitySlot> slots;
+            std::vector<EntityID> alive_entities;
+            Uint32 free_head = NO_ENTITY;
+            Uint32 free_tail = NO_ENTITY;
+            EntityID next_entity_id = 0;
+            EntityID entity_limit = 0;
+            std::vector<Signature> signatures;
+        };
+
         EntityManager(std::shared_ptr<LoggingManager> logging_manager);
         ~EntityManager();
 
@@ -50,12 +89,25 @@ namespace HBE::Application::Managers {
          */
         EntityID CreateEntity();
 
+        /**
+         * @brief Allocate several entity IDs at once and mark them alive.
+         * @param count Number of entities to create.
+         * @return Newly created entity identifiers, fewer than count if the entity limit was reached.
+         */
+        std::vector<EntityID> CreateEntities(size_t count);
+
         /**
          * @brief Destroy an entity and recycle its ID.
          * @param entity Entity identifier to destroy.
          */
         void DestroyEntity(EntityID entity);
 
+        /**
+         * @brief Destroy a batch of entities and recycle their IDs, logging once for the whole batch.
+         * @param entities Entity identifiers to destroy, entities that aren't alive are skipped.
+         */
+        void DestroyEntities(std::span<const EntityID> entities);
+
         /**
          * @brief Destroy every existing entity and reset bookkeeping state.
          */
@@ -70,6 +122,14 @@ namespace HBE::Application::Managers {
          */
         Signature SetSignature(EntityID entity, ComponentID component_id, bool value = true);
 
+        /**
+         * @brief Replace an entity's whole signature, used when several components changed at once.
+         * @param entity Target entity identifier.
+         * @param signature New signature.
+         * @return Updated signature for the entity.
+         */
+        Signature SetSignature(EntityID entity, const Signature &signature);
+
         /**
          * @brief Retrieve the signature for an entity.
          * @param entity Entity identifier.
@@ -93,11 +153,63 @@ namespace HBE::Application::Managers {
 
         /**
          * @brief Get a list of all active entity IDs.
-         * @return Vector of living entity identifiers.
+         * @return Vector of living entity identifiers, in no particular order.
          */
         std::vector<EntityID> GetAllEntities();
 
+        /**
+         * @brief Check whether an entity ID is currently in use.
+         * @param entity Entity identifier.
+         * @return True if the entity is alive.
+         */
+        bool IsAlive(EntityID entity) const;
+
+        /**
+         * @brief Get a handle that refers to a living entity.
+         * @param entity Entity identifier.
+         * @return Handle to the entity, or a null handle if the entity isn't alive.
+         */
+        EntityHandle GetHandle(EntityID entity) const;
+
+        /**
+         * @brief Check whether a handle still refers to a living entity.
+         * @param handle Handle to check.
+         * @return False if the entity was destroyed, even if its ID has been recycled since.
+         */
+        bool IsValid(EntityHandle handle) const;
+
+        /**
+         * @brief Get the current limit on the number of entities.
+         * @return Entity IDs are always below this value.
+         */
+        EntityID GetEntityLimit() const;
+
+        /**
+         * @brief Change the limit on the number of entities.
+         * @param entity_limit New limit.
+         * @return False if a living entity's ID is at or above the new limit.
+         */
+        bool SetEntityLimit(EntityID entity_limit);
+
+        /**
+         * @brief Copy the bookkeeping of every entity.
+         * @return Snapshot that RestoreSnapshot() can bring back.
+         */
+        Snapshot CaptureSnapshot() const;
+
+        /**
+         * @brief Bring back the entities of a snapshot, replacing every existing entity.
+         * Generations never move backwards for IDs that aren't alive in the snapshot, so handles to entities created
+         * after the snapshot stay invalid.
+         * @param snapshot Snapshot taken by CaptureSnapshot().
+         */
+        void RestoreSnapshot(const Snapshot &snapshot);
+
     private:
         void InitializeEntities();
+        EntityID AllocateEntity();
+        void PushFreeEntity(EntityID entity);
+        EntityID PopFreeEntity();
+        void ReleaseEntity(EntityID entity);
     };
 } // namespace HBE::Application::Managers
\ No newline at end of file
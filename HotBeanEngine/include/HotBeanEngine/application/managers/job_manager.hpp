@@ -0,0 +1,257 @@
+/**
+ * @file job_manager.hpp
+ * @author Daniel Parker (DParker13)
+ * @brief Runs jobs on a fixed pool of worker threads.
+ *
+ * @details Every worker owns a deque of jobs. A worker pushes and pops jobs at the back of its own deque and steals
+ * from the front of another worker's deque when it runs out. Jobs scheduled from outside the pool, such as from the
+ * main thread, go into a shared queue that every worker pulls from. Threads waiting on a job run other queued jobs
+ * until it finishes instead of blocking, so waiting from inside a job can't deadlock the pool.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace HBE::Application::Managers {
+    class JobHandle;
+    class JobManager;
+
+    /**
+     * @brief A unit of work queued on the JobManager.
+     * Only used through a JobHandle.
+     */
+    class Job {
+    private:
+        friend class JobHandle;
+        friend class JobManager;
+
+        std::function<void()> m_task;
+        std::exception_ptr m_exception;
+
+        // Dependencies that haven't finished yet, plus one held while the job is being scheduled
+        std::atomic<size_t> m_remaining_dependencies = 1;
+        std::atomic<bool> m_finished = false;
+
+        // Guards m_continuations and the finished flag while continuations are being added
+        std::mutex m_mutex;
+        std::vector<std::shared_ptr<Job>> m_continuations;
+
+    public:
+        explicit Job(std::function<void()> task) : m_task(std::move(task)) {}
+    };
+
+    /**
+     * @brief Refers to a scheduled job.
+     * Pass it to JobManager::Wait() to wait for the job, or as a dependency when scheduling another job.
+     */
+    class JobHandle {
+    private:
+        friend class JobManager;
+
+        std::shared_ptr<Job> m_job;
+
+        explicit JobHandle(std::shared_ptr<Job> job) : m_job(std::move(job)) {}
+
+    public:
+        JobHandle() = default;
+
+        /**
+         * @brief Check if the job has finished running
+         * @return True if the job finished or the handle is empty
+         */
+        bool IsComplete() const { return !m_job || m_job->m_finished.load(std::memory_order_acquire); }
+
+        bool IsValid() const { return m_job != nullptr; }
+    };
+
+    /**
+     * @brief Fixed-size worker pool with work-stealing job queues.
+     *
+     * Jobs may depend on other jobs and only start once all their dependencies have finished. Exceptions thrown by a
+     * job are rethrown by the Wait() call for that job. Jobs depending on a job that threw still run.
+     *
+     * @code
+     *   JobHandle load = g_app.GetJobManager().Schedule([]() { LoadTextures(); });
+     *   JobHandle build = g_app.GetJobManager().Then(load, []() { BuildAtlas(); });
+     *   g_app.GetJobManager().Wait(build);
+     * @endcode
+     */
+    class JobManager {
+    private:
+        /**
+         * @brief Jobs queued on one worker.
+         * The owning worker uses the back, other workers steal from the front.
+         */
+        struct WorkerQueue {
+            std::mutex mutex;
+            std::deque<std::shared_ptr<Job>> jobs;
+        };
+
+        std::vector<std::thread> m_workers;
+        std::vector<std::unique_ptr<WorkerQueue>> m_worker_queues;
+
+        // Jobs scheduled from threads outside the pool
+        WorkerQueue m_shared_queue;
+
+        // Number of jobs sitting in any queue, lets idle workers sleep
+        std::atomic<size_t> m_queued_jobs = 0;
+        std::mutex m_sleep_mutex;
+        std::condition_variable m_wake_condition;
+        std::atomic<bool> m_stopping = false;
+
+    public:
+        /**
+         * @brief Starts the worker threads
+         * @param worker_count Number of worker threads, 0 uses one less than the number of hardware threads
+         */
+        explicit JobManager(size_t worker_count = 0);
+
+        /**
+         * @brief Finishes every queued job then joins the worker threads
+         */
+        ~JobManager();
+
+        JobManager(const JobManager &) = delete;
+        JobManager &operator=(const JobManager &) = delete;
+
+        /**
+         * @brief Queue a job to run on the worker pool
+         * @param task Work to run
+         * @return JobHandle Handle to the queued job
+         */
+        JobHandle Schedule(std::function<void()> task);
+
+        /**
+         * @brief Queue a job that starts once all of its dependencies have finished
+         * @param task Work to run
+         * @param dependencies Jobs that must finish first, empty handles are ignored
+         * @return JobHandle Handle to the queued job
+         */
+        JobHandle Schedule(std::function<void()> task, const std::vector<JobHandle> &dependencies);
+
+        /**
+         * @brief Queue a job that starts once another job has finished
+         * @param dependency Job that must finish first
+         * @param task Work to run
+         * @return JobHandle Handle to the queued job
+         */
+        JobHandle Then(const JobHandle &dependency, std::function<void()> task);
+
+        /**
+         * @brief Wait for a job to finish, running other queued jobs in the meantime
+         * @param handle Job to wait for
+         * @throws Rethrows any exception thrown by the job
+         */
+        void Wait(const JobHandle &handle);
+
+        /**
+         * @brief Wait for several jobs to finish, running other queued jobs in the meantime
+         * @param handles Jobs to wait for
+         * @throws Rethrows the first exception thrown by any of the jobs
+         */
+        void Wait(const std::vector<JobHandle> &handles);
+
+        /**
+         * @brief Runs func over [begin, end) split into chunks across the worker pool and waits for it to finish
+         *
+         * The calling thread runs the first chunk itself. func either takes a single index, or a (chunk_begin,
+         * chunk_end) pair to handle a whole chunk at once.
+         *
+         * @tparam Func void(size_t) or void(size_t, size_t)
+         * @param begin First index
+         * @param end One past the last index
+         * @param func Work to run for each index or chunk
+         * @param grain_size Indices per chunk, 0 picks a size that gives each thread a few chunks
+         * @throws Rethrows the first exception thrown by any chunk
+         */
+        template <typename Func>
+        void ParallelFor(size_t begin, size_t end, Func &&func, size_t grain_size = 0) {
+            if (begin >= end) {
+                return;
+            }
+
+            const size_t count = end - begin;
+            if (grain_size == 0) {
+                grain_size = std::max<size_t>(1, count / ((GetWorkerCount() + 1) * 4));
+            }
+
+            auto run_chunk = [&func](size_t chunk_begin, size_t chunk_end) {
+                if constexpr (std::is_invocable_v<Func &, size_t, size_t>) {
+                    func(chunk_begin, chunk_end);
+                }
+                else {
+                    for (size_t i = chunk_begin; i < chunk_end; i++) {
+                        func(i);
+                    }
+                }
+            };
+
+            if (count <= grain_size || GetWorkerCount() == 0) {
+                run_chunk(begin, end);
+                return;
+            }
+
+            std::vector<JobHandle> chunks;
+            chunks.reserve((count + grain_size - 1) / grain_size);
+
+            for (size_t chunk_begin = begin + grain_size; chunk_begin < end; chunk_begin += grain_size) {
+                size_t chunk_end = std::min(end, chunk_begin + grain_size);
+                chunks.push_back(
+                    Schedule([&run_chunk, chunk_begin, chunk_end]() { run_chunk(chunk_begin, chunk_end); }));
+            }
+
+            // Still wait on the scheduled chunks if the inline chunk throws, they reference this stack frame
+            try {
+                run_chunk(begin, std::min(end, begin + grain_size));
+            }
+            catch (...) {
+                WaitIgnoringErrors(chunks);
+                throw;
+            }
+
+            Wait(chunks);
+        }
+
+        /**
+         * @brief Get the number of worker threads, not counting threads that help while waiting
+         * @return size_t Number of worker threads
+         */
+        size_t GetWorkerCount() const;
+
+        /**
+         * @brief Check if the calling thread is one of this manager's workers
+         * @return True if called from inside a worker thread
+         */
+        bool IsWorkerThread() const;
+
+    private:
+        void WorkerLoop(size_t worker_index);
+
+        void Enqueue(std::shared_ptr<Job> job);
+        std::shared_ptr<Job> Dequeue();
+
+        /**
+         * @brief Runs one queued job on the calling thread
+         * @return True if a job was run
+         */
+        bool RunPendingJob();
+        void Execute(const std::shared_ptr<Job> &job);
+
+        void WaitIgnoringErrors(const std::vector<JobHandle> &handles);
+    };
+} // namespace HBE::Application::Managers
\ No newline at end of file
@@ -13,6 +13,7 @@
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
+#include <mutex>
 #include <sstream>
 
 #include <HotBeanEngine/application/listeners/ilog_listener.hpp>
@@ -41,6 +42,9 @@ namespace HBE::Application::Managers {
         bool m_log_to_console = false;
         std::vector<ILogListener *> m_log_listeners;
 
+        // Systems can run on worker threads, so writing a message is serialized
+        std::mutex m_log_mutex;
+
         // Used for unit testing to avoid logging messages
         bool m_testing;
 
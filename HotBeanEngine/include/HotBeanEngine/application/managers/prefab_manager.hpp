@@ -0,0 +1,67 @@
+/**
+ * @file prefab_manager.hpp
+ * @author Daniel Parker (DParker13)
+ * @brief Loads, caches and instantiates prefab assets.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <HotBeanEngine/application/managers/ecs_manager.hpp>
+
+namespace HBE::Application::Managers {
+    /**
+     * @brief Cooks each prefab asset the first time it's asked for and keeps the cooked prefab.
+     * Every later Load() or Instantiate() of the same file reuses it without reading the asset again.
+     */
+    class PrefabManager {
+    private:
+        std::unique_ptr<Core::IPrefabCooker> m_cooker;
+
+        /// @brief Map of asset paths to cooked prefabs, pointers stay valid until the prefab is unloaded
+        std::unordered_map<std::string, std::unique_ptr<Core::Prefab>> m_prefabs;
+
+    public:
+        PrefabManager(std::unique_ptr<Core::IPrefabCooker> cooker);
+        ~PrefabManager() = default;
+
+        /**
+         * @brief Get a cooked prefab, cooking its asset if it hasn't been loaded yet
+         * @param filepath Path to the prefab asset
+         * @return The cooked prefab, valid until it is unloaded
+         */
+        const Core::Prefab &Load(const std::filesystem::path &filepath);
+
+        /**
+         * @brief Spawns instances of a prefab asset, see ECSManager::InstantiatePrefab()
+         * @param filepath Path to the prefab asset, cooked on first use
+         * @param count Number of instances to spawn
+         * @param parent Entity to place each instance's root under, -1 for none
+         * @return Root entity of each instance
+         */
+        std::vector<Core::EntityID> Instantiate(const std::filesystem::path &filepath, size_t count = 1,
+                                                Core::EntityID parent = -1);
+
+        bool IsLoaded(const std::filesystem::path &filepath) const;
+
+        /**
+         * @brief Forgets a cooked prefab, the next Load() cooks its asset again
+         * @param filepath Path to the prefab asset
+         */
+        void Unload(const std::filesystem::path &filepath);
+
+        /// @brief Forgets every cooked prefab, call after component types are unregistered or the assets change
+        void UnloadAll();
+
+    private:
+        static std::string GetKey(const std::filesystem::path &filepath);
+    };
+} // namespace HBE::Application::Managers
\ No newline at end of file
@@ -10,26 +10,32 @@
 #pragma once
 
 #include <map>
-#include <set>
-#include <unordered_set>
+#include <vector>
 
-#include <HotBeanEngine/application/listeners/component_listener.hpp>
 #include <HotBeanEngine/application/managers/camera_manager.hpp>
 #include <HotBeanEngine/components/miscellaneous/transform_2d.hpp>
 #include <HotBeanEngine/components/rendering/texture.hpp>
 
 namespace HBE::Application::Managers {
-    class RenderManager : public Listeners::ComponentListener {
+    class RenderManager {
     private:
         std::shared_ptr<CameraManager> m_camera_manager;
         /**
          * @brief Map of layer indices to SDL_Texture pointers for offscreen rendering.
          */
         std::map<int, SDL_Texture *> m_layers;
+
+        // Entity drawn this frame and its components
+        struct Renderable {
+            EntityID entity;
+            const Components::Transform2D *transform;
+            const Components::Texture *texture;
+        };
+
         /**
-         * @brief Cached set of entities that have Texture and Transform2D components.
+         * @brief Renderable entities of the current frame, sorted by ID so draw order within a layer stays the same.
          */
-        std::set<EntityID> m_renderable_entities;
+        std::vector<Renderable> m_renderables;
 
     public:
         RenderManager(std::shared_ptr<CameraManager> camera_manager);
@@ -61,19 +67,12 @@ namespace HBE::Application::Managers {
          */
         std::map<int, SDL_Texture *> GetAllLayers() const;
 
+    private:
         /**
-         * @brief Called when a component is added to an entity.
-         * @param entity The entity ID that gained a component.
-         */
-        void OnComponentAdded(Core::IComponent *component, Core::EntityID entity) override;
-
-        /**
-         * @brief Called when a component is removed from an entity.
-         * @param entity The entity ID that lost a component.
+         * @brief Fills m_renderables with every entity that has a Transform2D and a Texture, in entity ID order.
          */
-        void OnComponentRemoved(Core::EntityID entity) override;
+        void CollectRenderables();
 
-    private:
         /**
          * @brief Creates a texture layer for the entity's layer if it doesn't already exist.
          * @param transform Entity transform component.
@@ -11,12 +11,20 @@
 
 #pragma once
 
+#include <cstdint>
+#include <deque>
+#include <span>
+
 #include <HotBeanEngine/application/managers/component_manager.hpp>
+#include <HotBeanEngine/application/managers/job_manager.hpp>
 #include <HotBeanEngine/application/managers/logging_manager.hpp>
+#include <HotBeanEngine/core/query_cache.hpp>
 
 namespace HBE::Application::Managers {
     using Core::EntityID;
+    using Core::EntitySet;
     using Core::GameLoopState;
+    using Core::QueryCache;
     using Core::Signature;
     using Core::SystemBase;
 
@@ -30,17 +38,61 @@ namespace HBE::Application::Managers {
         std::shared_ptr<ComponentManager> m_component_manager;
         std::shared_ptr<LoggingManager> m_logging_manager;
 
-        // Map from system type name to a signature
-        std::unordered_map<std::string, Signature> m_signatures;
+        // Runs the systems of a parallel stage, without one every stage runs on the calling thread
+        std::shared_ptr<JobManager> m_job_manager;
 
         // Map from system type name to a system pointer
         std::map<std::string, SystemBase *> m_systems;
+
+        // Systems and their signatures in registration order, m_system_signatures[i] belongs to m_systems_ordered[i]
+        // Signatures are kept in their own array so matching an entity reads them back to back
         std::vector<SystemBase *> m_systems_ordered;
+        std::vector<Signature> m_system_signatures;
+
+        // An entity joining or leaving a system, recorded before OnEntityAdded() or OnEntityRemoved() runs
+        struct MembershipChange {
+            SystemBase *system;
+            EntityID entity;
+            bool added;
+        };
+
+        // Scratch space for one signature change. Callbacks can change signatures again, so every nested change gets
+        // its own, m_signature_changes[m_signature_change_depth] is the next free one
+        struct SignatureChangeScratch {
+            // 1 where the system's signature matched, see MatchSystemSignatures()
+            std::vector<uint8_t> matches;
+            std::vector<MembershipChange> changes;
+        };
+        std::deque<SignatureChangeScratch> m_signature_changes;
+        size_t m_signature_change_depth = 0;
+
+        // Cached entity queries, matched against every changed entity alongside the systems
+        QueryCache m_query_cache;
+
+        // Systems grouped for the parallel game loop phases, systems in a stage don't conflict with each other
+        std::vector<std::vector<SystemBase *>> m_system_stages;
+        bool m_system_stages_dirty = true;
+        bool m_parallel_execution = true;
 
     public:
+        /**
+         * @brief Entities of every system, taken by CaptureSnapshot().
+         */
+        struct Snapshot {
+            struct SystemEntities {
+                std::string name;
+                Signature signature;
+                EntitySet entities;
+            };
+
+            std::vector<SystemEntities> systems;
+        };
+
         SystemManager(std::shared_ptr<ComponentManager> component_manager,
-                      std::shared_ptr<LoggingManager> logging_manager)
-            : m_component_manager(component_manager), m_logging_manager(logging_manager) {}
+                      std::shared_ptr<LoggingManager> logging_manager,
+                      std::shared_ptr<JobManager> job_manager = nullptr)
+            : m_component_manager(component_manager), m_logging_manager(logging_manager),
+              m_job_manager(job_manager) {}
         /**
          * @brief Destructor. Releases all registered systems.
          */
@@ -71,13 +123,14 @@ namespace HBE::Application::Managers {
             // Extract and set the system signature from RequiredComponents
             Signature signature;
             for (auto component_name : system->GetRequiredComponents()) {
-                signature |= (1 << m_component_manager->GetComponentID(component_name));
+                signature.set(m_component_manager->GetComponentID(component_name));
             }
-            m_signatures.insert({system_name, signature});
 
             // Create a pointer to the system and return it so it can be used externally
             m_systems.insert({system_name, system});
             m_systems_ordered.push_back(system);
+            m_system_signatures.push_back(signature);
+            m_system_stages_dirty = true;
 
             return *system;
         }
@@ -105,13 +158,14 @@ namespace HBE::Application::Managers {
             // Extract and set the system signature from RequiredComponents
             Signature signature;
             for (auto component_name : system->GetRequiredComponents()) {
-                signature |= (1 << m_component_manager->GetComponentID(component_name));
+                signature.set(m_component_manager->GetComponentID(component_name));
             }
-            m_signatures.insert({system_name, signature});
 
             // Create a pointer to the system and return it so it can be used externally
             m_systems.insert({system_name, system});
             m_systems_ordered.push_back(system);
+            m_system_signatures.push_back(signature);
+            m_system_stages_dirty = true;
 
             return *system;
         }
@@ -133,14 +187,7 @@ namespace HBE::Application::Managers {
 
             T *system = GetSystem<T>();
 
-            RemoveSignature<T>();
-
-            // TODO: Can this be done better?
-            // Remove system from ordered list
-            m_systems_ordered.erase(
-                std::remove(m_systems_ordered.begin(), m_systems_ordered.end(), m_systems[system_name]),
-                m_systems_ordered.end());
-            m_systems.erase(system_name);
+            EraseSystem(system);
 
             delete system;
         }
@@ -174,7 +221,7 @@ namespace HBE::Application::Managers {
                                              signature.to_string() + "\"");
 
             // Set the signature for this system
-            m_signatures.insert({system_name, signature});
+            m_system_signatures[GetSystemIndex(m_systems[system_name])] = signature;
         }
 
         void SetSignature(SystemBase *system, Signature signature);
@@ -193,7 +240,7 @@ namespace HBE::Application::Managers {
             }
 
             // Get the signature for this system
-            return m_signatures[std::string(GetSystemName<T>())];
+            return m_system_signatures[GetSystemIndex(m_systems[std::string(GetSystemName<T>())])];
         }
 
         Signature &GetSignature(SystemBase *system);
@@ -222,6 +269,15 @@ namespace HBE::Application::Managers {
          */
         void EntityDestroyed(EntityID entity);
 
+        /**
+         * @brief Erases a batch of entities that are about to be destroyed from every system and cached query.
+         * Each system that has one of them gets OnEntityRemoved() for it, so components still have to exist when
+         * this runs. Only one line is logged for the whole batch.
+         *
+         * @param entities Entities that are about to be destroyed
+         */
+        void EntitiesDestroyed(std::span<const EntityID> entities);
+
         /**
          * Notifies each system that an entity's signature has changed.
          *
@@ -234,6 +290,43 @@ namespace HBE::Application::Managers {
          */
         void EntitySignatureChanged(EntityID entity, Signature entity_signature);
 
+        /**
+         * @brief Notifies each system that a batch of entities now share the same signature.
+         * Each system's signature is checked once for the whole batch instead of once per entity.
+         *
+         * @param entities Entities whose signature has changed
+         * @param entity_signature The new signature shared by every entity in the batch
+         */
+        void EntitiesSignatureChanged(std::span<const EntityID> entities, Signature entity_signature);
+
+        /**
+         * @brief Get the cached entity queries, they're kept up to date by the same calls as the systems
+         * @return QueryCache& Cached queries
+         */
+        QueryCache &GetQueryCache() { return m_query_cache; }
+
+        /**
+         * @brief Calls OnEntityRemoved() for every entity of every system, then empties the systems.
+         * Cached query results are emptied as well. Components still have to exist when this runs.
+         */
+        void RemoveAllEntities();
+
+        /**
+         * @brief Copy the entities of every system.
+         * @return Snapshot that RestoreSnapshot() can bring back.
+         */
+        Snapshot CaptureSnapshot() const;
+
+        /**
+         * @brief Hand every system its entities from a snapshot, calling OnEntityAdded() for each of them.
+         * Systems must be empty, see RemoveAllEntities(). A system that wasn't registered when the snapshot was taken,
+         * or whose signature changed since, is left empty.
+         *
+         * @param snapshot Snapshot taken by CaptureSnapshot().
+         * @return False if a system was left empty, its entities have to be matched with EntitySignatureChanged().
+         */
+        bool RestoreSnapshot(const Snapshot &snapshot);
+
         /**
          * @brief Iterates all systems and calls specific game loop method
          *
@@ -241,6 +334,26 @@ namespace HBE::Application::Managers {
          */
         void IterateSystems(GameLoopState state);
 
+        /**
+         * @brief Get the systems grouped into stages for the parallel game loop phases
+         *
+         * Stages run one after another. Systems in the same stage don't conflict and run at the same time. A system
+         * that conflicts with an earlier registered system always runs in a later stage, so the registration order
+         * decides the order of conflicting systems.
+         *
+         * @return Stages in execution order
+         */
+        const std::vector<std::vector<SystemBase *>> &GetSystemStages();
+
+        /**
+         * @brief Enable or disable running non-conflicting systems at the same time
+         * OnFixedUpdate and OnUpdate are the only phases run in parallel, everything else runs on the main thread.
+         *
+         * @param enabled False runs every system sequentially in registration order
+         */
+        void SetParallelExecution(bool enabled);
+        bool IsParallelExecutionEnabled() const;
+
         /**
          * @brief Iterates all systems and calls specific game loop event methods
          *
@@ -258,21 +371,15 @@ namespace HBE::Application::Managers {
     private:
         bool IsSystemRegistered(SystemBase *system);
 
-        template <typename T>
-        void RemoveSignature() {
-            if (!IsSystemRegistered<T>()) {
-                LOG_CORE(LoggingType::WARNING, "System is not registered");
-                return;
-            }
-
-            std::string system_name = std::string(GetSystemName<T>());
-
-            LOG_CORE(LoggingType::DEBUG, "System \"" + system_name + "\" Signature removed");
-
-            m_signatures.erase(system_name);
-        }
+        void BuildSystemStages();
+        void RunSystemStage(const std::vector<SystemBase *> &stage, GameLoopState state);
+        void RunSystem(SystemBase *system, GameLoopState state);
 
-        void RemoveSignature(SystemBase *system);
+        size_t GetSystemIndex(SystemBase *system) const;
+        void EraseSystem(SystemBase *system);
+        SignatureChangeScratch &AcquireSignatureChangeScratch();
+        void MatchSystemSignatures(const Signature &entity_signature, std::vector<uint8_t> &matches);
+        void DispatchMembershipChanges(std::span<const MembershipChange> changes);
 
         /**
          * @brief Retrieves the name of the component
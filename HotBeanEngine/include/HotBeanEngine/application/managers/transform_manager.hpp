@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <HotBeanEngine/application/listeners/component_listener.hpp>
 #include <HotBeanEngine/components/miscellaneous/transform_2d.hpp>
 #include <HotBeanEngine/utilities/scene_graph.hpp>
@@ -22,6 +24,9 @@ namespace HBE::Application::Managers {
     private:
         SceneGraph m_scene_graph;
 
+        // Entities of the scene graph level being propagated, kept between frames to avoid reallocating
+        std::vector<Core::EntityID> m_level_entities;
+
     public:
         TransformManager();
         ~TransformManager() = default;
@@ -35,9 +40,17 @@ namespace HBE::Application::Managers {
         /**
          * @brief Called when a Transform2D component is removed from an entity.
          * Cleans up the entity from the scene graph.
+         * @param component_id The Transform2D component ID.
          * @param entity The entity that lost a Transform2D component.
          */
-        void OnComponentRemoved(Core::EntityID entity) override;
+        void OnComponentRemoved(Core::ComponentID component_id, Core::EntityID entity) override;
+
+        /**
+         * @brief Called when every entity is destroyed, clears the scene graph in one go.
+         * @param component_id The Transform2D component ID.
+         * @param entities Every entity that had a Transform2D component.
+         */
+        void OnAllComponentsRemoved(Core::ComponentID component_id, std::span<const Core::EntityID> entities) override;
 
         void OnUpdate();
         void PropagateTransforms(Transform2D &transform, const Transform2D *parent_transform);
@@ -20,16 +20,28 @@ namespace HBE::Components {
      *
      * Stores texture data and rendering properties.
      * Supports sprite rendering with source rectangles.
+     * Owns its SDL texture, so it can be moved but not copy constructed. Clone() makes a copy with its own texture.
      */
-    struct Texture : public Core::IComponent, public Core::DirtyFlag, public GUI::IPropertyRenderable {
+    struct Texture : public Core::IComponent, public GUI::IPropertyRenderable {
         SDL_Texture *m_texture =
             nullptr; /// A pointer to the SDL texture object. Can be null if the texture has not been loaded.
         glm::vec2 m_size = {0, 0}; /// Size of the texture in pixels.
 
         DEFINE_NAME("Texture");
         Texture() = default;
+        Texture(const Texture &) = delete;
+        Texture &operator=(const Texture &) = delete;
+        Texture(Texture &&other) noexcept;
+        Texture &operator=(Texture &&other) noexcept;
         ~Texture();
 
+        /**
+         * @brief Copies the texture along with its pixels into a new SDL texture
+         * Used when the component's pool is copied, like when a world snapshot is taken.
+         * @return Texture owning a copy of m_texture, or without a texture if this one has none
+         */
+        Texture Clone() const;
+
         void Serialize(Core::ISerializationWriter &out) const override;
         void Deserialize(Core::ISerializationReader &in) override;
         void RenderProperties(int &id) override;
@@ -19,7 +19,6 @@ namespace HBE::Components {
 
         DEFINE_NAME("Interactive");
         Interactive() = default;
-        ~Interactive() = default;
 
         void Deserialize(Core::ISerializationReader &in) override;
         void Serialize(Core::ISerializationWriter &out) const override;
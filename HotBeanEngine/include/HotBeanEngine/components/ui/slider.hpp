@@ -28,7 +28,6 @@ namespace HBE::Components {
 
         DEFINE_NAME("Slider");
         Slider() = default;
-        ~Slider() = default;
 
         void Deserialize(Core::ISerializationReader &in) override;
         void Serialize(Core::ISerializationWriter &out) const override;
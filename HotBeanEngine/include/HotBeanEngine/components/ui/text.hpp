@@ -13,12 +13,11 @@
 #include <SDL3_ttf/SDL_ttf.h>
 
 #include <HotBeanEngine/core/component.hpp>
-#include <HotBeanEngine/core/dirty_flag.hpp>
 #include <HotBeanEngine/editor/iproperty_renderable.hpp>
 
 namespace HBE::Components {
 
-    struct Text : public Core::IComponent, public Core::DirtyFlag, public GUI::IPropertyRenderable {
+    struct Text : public Core::IComponent, public GUI::IPropertyRenderable {
         TTF_Font *m_font = nullptr; /// Pointer to the TTF font object. Can be null if the font has not been loaded.
         SDL_Color m_foreground_color = {255, 255, 255, 255}; /// The color of the text.
         SDL_Color m_background_color = {0, 0, 0, 255};       /// The background color of the text.
@@ -29,7 +28,6 @@ namespace HBE::Components {
 
         DEFINE_NAME("Text");
         Text() = default;
-        ~Text() = default;
 
         void Deserialize(Core::ISerializationReader &in) override;
         void Serialize(Core::ISerializationWriter &out) const override;
@@ -10,14 +10,19 @@
 
 #pragma once
 
+#include <HotBeanEngine/core/change_tick.hpp>
 #include <HotBeanEngine/core/component.hpp>
+#include <HotBeanEngine/core/component_ops.hpp>
+#include <HotBeanEngine/core/component_type_index.hpp>
 #include <HotBeanEngine/core/config.hpp>
-#include <HotBeanEngine/core/dirty_flag.hpp>
 #include <HotBeanEngine/core/entity.hpp>
+#include <HotBeanEngine/core/entity_set.hpp>
 #include <HotBeanEngine/core/exceptions.hpp>
+#include <HotBeanEngine/core/group.hpp>
 #include <HotBeanEngine/core/iarchetype.hpp>
 #include <HotBeanEngine/core/igame_loop.hpp>
 #include <HotBeanEngine/core/iname.hpp>
+#include <HotBeanEngine/core/iprefab_cooker.hpp>
 #include <HotBeanEngine/core/iscene.hpp>
 #include <HotBeanEngine/core/iserializable.hpp>
 #include <HotBeanEngine/core/iserialization_reader.hpp>
@@ -26,8 +31,12 @@
 #include <HotBeanEngine/core/logging_type.hpp>
 #include <HotBeanEngine/core/octree_2d.hpp>
 #include <HotBeanEngine/core/octree_2d_node.hpp>
+#include <HotBeanEngine/core/parallel.hpp>
+#include <HotBeanEngine/core/prefab.hpp>
 #include <HotBeanEngine/core/project.hpp>
+#include <HotBeanEngine/core/query_cache.hpp>
 #include <HotBeanEngine/core/signature.hpp>
 #include <HotBeanEngine/core/sparse_set.hpp>
 #include <HotBeanEngine/core/system.hpp>
-#include <HotBeanEngine/core/type_traits.hpp>
\ No newline at end of file
+#include <HotBeanEngine/core/type_traits.hpp>
+#include <HotBeanEngine/core/view.hpp>
\ No newline at end of file
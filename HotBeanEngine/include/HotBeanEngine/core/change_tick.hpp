@@ -0,0 +1,33 @@
+/**
+ * @file change_tick.hpp
+ * @author Daniel Parker (DParker13)
+ * @brief Ticks used to find components that were added or changed since a system last ran.
+ *
+ * @details The component manager keeps a tick counter that moves forward after every system runs. Each component slot
+ * remembers the tick it was added at and the tick it was last accessed mutably at. A system compares those against the
+ * tick it last ran at, so it only has to touch the components that something else changed in the meantime.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace HBE::Core {
+    // 64 bits so the counter never wraps, even when it moves forward many times a frame
+    using Tick = uint64_t;
+
+    /**
+     * @brief When a component slot was added and last changed.
+     */
+    struct ComponentTicks {
+        Tick added = 0;
+        Tick changed = 0;
+
+        bool IsAdded(Tick since) const { return added > since; }
+        bool IsChanged(Tick since) const { return changed > since; }
+    };
+} // namespace HBE::Core
\ No newline at end of file
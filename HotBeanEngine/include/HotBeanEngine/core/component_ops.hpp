@@ -0,0 +1,146 @@
+/**
+ * @file component_ops.hpp
+ * @author Daniel Parker (DParker13)
+ * @brief Function table for handling a component without knowing its type.
+ *
+ * @details Each component type gets one ComponentOps table holding its size, alignment and plain function pointers to
+ * construct, move, copy and destroy it in raw memory. Code that only has a ComponentID can look the table up from the
+ * component's sparse set instead of going through std::any or a virtual call per operation.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <HotBeanEngine/core/component.hpp>
+#include <HotBeanEngine/core/entity.hpp>
+
+namespace HBE::Core {
+    /**
+     * @brief A component that owns a resource, and so can't be copy constructed, can still be copied by giving itself
+     * a Clone() function that duplicates the resource:
+     * @code
+     * Texture Clone() const;
+     * @endcode
+     */
+    template <typename T>
+    concept HasCloneHook = requires(const T &component) {
+        { component.Clone() } -> std::same_as<T>;
+    };
+
+    // True if components of type T can be copied, either by their copy constructor or their Clone() hook
+    template <typename T>
+    inline constexpr bool IS_COMPONENT_COPYABLE = std::is_copy_constructible_v<T> || HasCloneHook<T>;
+
+    /**
+     * @brief A component that places its entity under a parent entity, like Transform2D, keeps the parent's ID in an
+     * m_parent member. Prefabs use it to link the children of each instance to that instance's entities.
+     */
+    template <typename T>
+    concept HasParentLink = std::same_as<std::remove_cvref_t<decltype(T::m_parent)>, EntityID>;
+
+    /**
+     * @brief Tag components only mark an entity, like an "Enemy" or "Selected" component with no members.
+     * A component that adds no data to IComponent is a tag. Sparse sets only store which entities have a tag, every
+     * entity shares one instance of it.
+     */
+    template <typename T>
+    inline constexpr bool IS_TAG_COMPONENT =
+        std::is_base_of_v<IComponent, T> && sizeof(T) == sizeof(IComponent) && std::is_default_constructible_v<T>;
+
+    /**
+     * @brief Copy constructs a component into uninitialized memory, going through its Clone() hook if it has one
+     * @param destination Uninitialized memory for one T
+     * @param source Component to copy
+     */
+    template <typename T>
+        requires IS_COMPONENT_COPYABLE<T>
+    void CopyConstructComponent(T *destination, const T &source) {
+        if constexpr (HasCloneHook<T>) {
+            std::construct_at(destination, source.Clone());
+        }
+        else {
+            std::construct_at(destination, source);
+        }
+    }
+
+    /**
+     * @brief Type-erased construct, move, copy and destroy for one component type.
+     * Every function works on raw memory of at least size bytes aligned to alignment.
+     */
+    struct ComponentOps {
+        size_t size;
+        size_t alignment;
+
+        // Default constructs a component in uninitialized memory
+        void (*construct)(void *destination);
+
+        // Move constructs a component into uninitialized memory, the source is left valid but unspecified
+        void (*move)(void *destination, void *source);
+
+        // Copy constructs a component into uninitialized memory, nullptr if the type can't be copied
+        void (*copy)(void *destination, const void *source);
+
+        // Destroys a component, leaving its memory uninitialized
+        void (*destroy)(void *component);
+
+        // Converts a pointer to the component to its IComponent base
+        IComponent *(*as_component)(void *component);
+
+        // Points a component at a parent entity, nullptr if the type has no parent link, see HasParentLink
+        void (*set_parent)(IComponent *component, EntityID parent);
+
+        // True for tag components, which have no data of their own, see IS_TAG_COMPONENT
+        bool is_tag;
+    };
+
+    /**
+     * @brief Builds the function table for component type T
+     * @tparam T Component type
+     */
+    template <typename T>
+    constexpr ComponentOps MakeComponentOps() {
+        static_assert(std::is_base_of_v<IComponent, T>, "T must inherit from IComponent");
+        static_assert(std::is_default_constructible_v<T>, "T must be default constructible");
+        static_assert(std::is_move_constructible_v<T>, "T must be move constructible");
+
+        ComponentOps ops{
+            sizeof(T),
+            alignof(T),
+            [](void *destination) { ::new (destination) T(); },
+            [](void *destination, void *source) { ::new (destination) T(std::move(*static_cast<T *>(source))); },
+            nullptr,
+            [](void *component) { static_cast<T *>(component)->~T(); },
+            [](void *component) -> IComponent * { return static_cast<T *>(component); },
+            nullptr,
+            IS_TAG_COMPONENT<T>,
+        };
+
+        if constexpr (IS_COMPONENT_COPYABLE<T>) {
+            ops.copy = [](void *destination, const void *source) {
+                CopyConstructComponent(static_cast<T *>(destination), *static_cast<const T *>(source));
+            };
+        }
+
+        if constexpr (HasParentLink<T>) {
+            ops.set_parent = [](IComponent *component, EntityID parent) {
+                static_cast<T *>(component)->m_parent = parent;
+            };
+        }
+
+        return ops;
+    }
+
+    // One shared table per component type, compare addresses to check two tables belong to the same type
+    template <typename T>
+    inline constexpr ComponentOps COMPONENT_OPS = MakeComponentOps<T>();
+} // namespace HBE::Core
\ No newline at end of file
@@ -0,0 +1,37 @@
+/**
+ * @file component_type_index.hpp
+ * @author Daniel Parker (DParker13)
+ * @brief Compile-time cached index for each component type.
+ *
+ * @details Every component type gets a process-wide index the first time the program is loaded. Managers use this index
+ * to find a component's storage with a plain array lookup instead of hashing the component's name. The index is not
+ * the same as a ComponentID. ComponentIDs are handed out per ComponentManager when a type is registered and are what
+ * signatures use.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace HBE::Core {
+    // ComponentTypeIndex is a process-wide index for a component type
+    // This is used to look up typed component storage without a name lookup
+    using ComponentTypeIndex = size_t;
+
+    namespace Detail {
+        /// @brief Hands out the next free component type index.
+        inline ComponentTypeIndex NextComponentTypeIndex() {
+            static std::atomic<ComponentTypeIndex> next_index{0};
+            return next_index.fetch_add(1, std::memory_order_relaxed);
+        }
+    } // namespace Detail
+
+    /// @brief Index of component type T, assigned once and cached for the life of the program.
+    template <typename T>
+    inline const ComponentTypeIndex COMPONENT_TYPE_INDEX = Detail::NextComponentTypeIndex();
+} // namespace HBE::Core
\ No newline at end of file
@@ -19,11 +19,24 @@
 #include <HotBeanEngine/core/entity.hpp>
 #include <HotBeanEngine/core/logging_type.hpp>
 
+// Width of entity signatures, set with the HBE_MAX_COMPONENTS CMake option
+#ifndef HBE_MAX_COMPONENTS
+    #define HBE_MAX_COMPONENTS 128
+#endif
+
 namespace HBE::Core {
     // ECS (These need to be set at compile time)
-    inline const EntityID MAX_ENTITIES = 50000;   // Maximum number of entities that can be created
-    inline const ComponentID MAX_COMPONENTS = 64; // Maximum number of components that can be registered
-    inline const float VERSION = 0.1f;            // Engine version
+    inline const EntityID MAX_ENTITIES = 50000;                   // Default limit on the number of entities
+    inline const ComponentID MAX_COMPONENTS = HBE_MAX_COMPONENTS; // Maximum number of components that can be registered
+    inline const float VERSION = 0.1f;                            // Engine version
+
+    static_assert(MAX_COMPONENTS == 64 || MAX_COMPONENTS == 128 || MAX_COMPONENTS == 256 || MAX_COMPONENTS == 512,
+                  "HBE_MAX_COMPONENTS must be 64, 128, 256 or 512");
+
+    // ECS (These can be changed at runtime)
+    // Soft limit on the number of entities that can be created (can be set in config.yaml)
+    // Storage grows with the number of entities in use, so raising this doesn't allocate anything up front.
+    inline EntityID ENTITY_LIMIT = MAX_ENTITIES;
 
     // Config
     inline const std::filesystem::path CONFIG_DIRECTORY = "./"; // Path to the config file
@@ -41,8 +54,8 @@ namespace HBE::Core {
     inline std::filesystem::path STARTUP_PROJECT_PATH = "";
 
     /**
-     * @brief Saves the current configuration to a YAML file. This includes logging settings and the startup project
-     * path.
+     * @brief Saves the current configuration to a YAML file. This includes logging settings, ECS limits and the startup
+     * project path.
      * @return Returns 0 on success, -1 on failure.
      */
     inline int SaveConfig() {
@@ -68,6 +81,13 @@ namespace HBE::Core {
         out << YAML::Key << "console" << YAML::Value << YAML::TrueFalseBool << LOG_TO_CONSOLE << YAML::Auto;
         out << YAML::EndMap;
 
+        // ECS
+        out << YAML::Key << "ECS" << YAML::Value;
+        out << YAML::BeginMap;
+        out << YAML::Key << "entity_limit" << YAML::Value << ENTITY_LIMIT
+            << YAML::Comment("Maximum number of entities that can exist at once");
+        out << YAML::EndMap;
+
         out << YAML::EndMap;
 
         // Ensure directory exists
@@ -108,6 +128,11 @@ namespace HBE::Core {
                 LOG_TO_CONSOLE = config["Logging"]["console"].as<bool>();
             }
 
+            // ECS
+            if (config["ECS"]["entity_limit"]) {
+                ENTITY_LIMIT = config["ECS"]["entity_limit"].as<EntityID>();
+            }
+
             // Project
             if (config["Project"]["startup_path"]) {
                 STARTUP_PROJECT_PATH = config["Project"]["startup_path"].as<std::string>();
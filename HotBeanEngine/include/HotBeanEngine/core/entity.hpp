@@ -1,7 +1,7 @@
 /**
  * @file entity.hpp
  * @author Daniel Parker (DParker13)
- * @brief Defines the EntityID type used in the ECS architecture.
+ * @brief Defines the EntityID and EntityHandle types used in the ECS architecture.
  * @version 0.1
  * @date 2025-02-23
  *
@@ -15,5 +15,36 @@
 namespace HBE::Core {
     // EntityID is a signed 64-bit integer
     // This is used to identify an entity
+    // IDs are recycled once an entity is destroyed, use an EntityHandle to hold on to a specific entity
     using EntityID = Sint64;
+
+    // Number of times an entity slot has been destroyed and reused
+    using EntityGeneration = Uint32;
+
+    /**
+     * @brief Refers to one specific entity, even after its ID has been recycled.
+     *
+     * The index is the entity's EntityID. The generation is bumped every time the entity with that ID is destroyed, so
+     * a handle to a destroyed entity no longer matches the live entity that reused its ID.
+     * Check a handle with ECSManager::IsEntityValid() before using its index.
+     */
+    struct EntityHandle {
+        static constexpr Uint32 INVALID_INDEX = 0xFFFFFFFF;
+
+        Uint32 index = INVALID_INDEX;
+        EntityGeneration generation = 0;
+
+        /**
+         * @brief Get the EntityID this handle refers to
+         * @return EntityID The entity's ID, only meaningful while the handle is valid
+         */
+        EntityID GetID() const { return static_cast<EntityID>(index); }
+
+        bool IsNull() const { return index == INVALID_INDEX; }
+
+        bool operator==(const EntityHandle &other) const {
+            return index == other.index && generation == other.generation;
+        }
+        bool operator!=(const EntityHandle &other) const { return !(*this == other); }
+    };
 } // namespace HBE::Core
\ No newline at end of file
@@ -0,0 +1,140 @@
+/**
+ * @file entity_set.hpp
+ * @author Daniel Parker (DParker13)
+ * @brief Packed set of entities with constant time membership.
+ *
+ * @details Entities are stored back to back in a dense vector so iterating them is a linear walk over memory. A sparse
+ * vector indexed by EntityID maps each entity to its slot in the dense vector. Insert, Remove and Contains are all
+ * O(1). Removing swaps the last entity into the removed slot, so iteration order is insertion order until something
+ * is removed.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <HotBeanEngine/core/entity.hpp>
+
+namespace HBE::Core {
+    /**
+     * @brief Sparse-indexed packed list of entities.
+     * Used by systems to track the entities matching their signature.
+     */
+    class EntitySet {
+    private:
+        static constexpr size_t NOT_PRESENT = std::numeric_limits<size_t>::max();
+
+        // Entities in insertion order, with removed slots filled from the back
+        std::vector<EntityID> m_dense;
+
+        // Map from EntityID to the entity's position in m_dense, grows to fit the largest entity inserted
+        std::vector<size_t> m_sparse;
+
+    public:
+        using const_iterator = std::vector<EntityID>::const_iterator;
+
+        /**
+         * @brief Adds an entity to the set
+         *
+         * @param entity Entity to add
+         * @return True if the entity was added, false if it was already present
+         */
+        bool Insert(EntityID entity) {
+            if (entity < 0 || Contains(entity)) {
+                return false;
+            }
+
+            size_t index = static_cast<size_t>(entity);
+            if (index >= m_sparse.size()) {
+                m_sparse.resize(index + 1, NOT_PRESENT);
+            }
+
+            m_sparse[index] = m_dense.size();
+            m_dense.push_back(entity);
+
+            return true;
+        }
+
+        /**
+         * @brief Removes an entity from the set
+         * The last entity is moved into the removed entity's slot.
+         *
+         * @param entity Entity to remove
+         * @return True if the entity was removed, false if it wasn't present
+         */
+        bool Remove(EntityID entity) {
+            if (!Contains(entity)) {
+                return false;
+            }
+
+            size_t dense_index = m_sparse[static_cast<size_t>(entity)];
+            EntityID last_entity = m_dense.back();
+
+            m_dense[dense_index] = last_entity;
+            m_sparse[static_cast<size_t>(last_entity)] = dense_index;
+
+            m_dense.pop_back();
+            m_sparse[static_cast<size_t>(entity)] = NOT_PRESENT;
+
+            return true;
+        }
+
+        /**
+         * @brief Checks if an entity is in the set
+         *
+         * @param entity Entity to check
+         * @return True if the entity is in the set
+         */
+        bool Contains(EntityID entity) const {
+            return entity >= 0 && static_cast<size_t>(entity) < m_sparse.size() &&
+                   m_sparse[static_cast<size_t>(entity)] != NOT_PRESENT;
+        }
+
+        /**
+         * @brief Allocates room for a batch of entities
+         *
+         * @param capacity Total number of entities to make room for
+         * @param largest_entity Largest EntityID that will be inserted
+         */
+        void Reserve(size_t capacity, EntityID largest_entity) {
+            m_dense.reserve(capacity);
+
+            if (largest_entity >= 0 && static_cast<size_t>(largest_entity) >= m_sparse.size()) {
+                m_sparse.resize(static_cast<size_t>(largest_entity) + 1, NOT_PRESENT);
+            }
+        }
+
+        /**
+         * @brief Removes every entity from the set
+         */
+        void Clear() {
+            m_dense.clear();
+            m_sparse.clear();
+        }
+
+        size_t Size() const { return m_dense.size(); }
+        bool Empty() const { return m_dense.empty(); }
+
+        /**
+         * @brief Get the entities as a contiguous array
+         * The pointer is invalidated when an entity is inserted or removed.
+         *
+         * @return Pointer to Size() entities
+         */
+        const EntityID *Data() const { return m_dense.data(); }
+
+        const EntityID &operator[](size_t index) const { return m_dense[index]; }
+
+        /**
+         * @warning Inserting or removing entities while iterating invalidates the iterators.
+         */
+        const_iterator begin() const { return m_dense.begin(); }
+        const_iterator end() const { return m_dense.end(); }
+    };
+} // namespace HBE::Core
\ No newline at end of file
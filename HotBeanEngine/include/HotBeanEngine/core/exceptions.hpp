@@ -30,6 +30,20 @@ namespace HBE::Core {
             : std::length_error("Maximum number of registered component types reached") {}
     };
 
+    class ComponentAlreadyOwnedException : public std::logic_error {
+    public:
+        ComponentAlreadyOwnedException(std::string_view component_name)
+            : std::logic_error(std::string("Component already owned by another group: ") +
+                               std::string(component_name)) {}
+    };
+
+    class ComponentInUseException : public std::logic_error {
+    public:
+        ComponentInUseException(std::string_view component_name, std::string_view system_name)
+            : std::logic_error(std::string("Component is still in the signature of System \"") +
+                               std::string(system_name) + "\": " + std::string(component_name)) {}
+    };
+
     class SystemNotRegisteredException : public std::runtime_error {
     public:
         SystemNotRegisteredException(std::string_view system_name)
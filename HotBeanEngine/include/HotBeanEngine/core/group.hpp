@@ -0,0 +1,249 @@
+/**
+ * @file group.hpp
+ * @author Daniel Parker (DParker13)
+ * @brief Owning groups, which keep several component sparse sets sorted together.
+ *
+ * @details A group owns the sparse sets of its components. Entities that have every owned component are kept at the
+ * front of each owned set, in the same order in every set, so the group's entities occupy dense positions
+ * [0, Size()) everywhere. Iterating a group is then a zipped loop over arrays, with no sparse lookups and no entities
+ * to skip. The component manager keeps groups sorted as components are added and removed.
+ *
+ * A sparse set can be owned by at most one group.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <HotBeanEngine/core/component_type_index.hpp>
+#include <HotBeanEngine/core/entity.hpp>
+#include <HotBeanEngine/core/parallel.hpp>
+#include <HotBeanEngine/core/sparse_set.hpp>
+#include <HotBeanEngine/core/view.hpp>
+
+namespace HBE::Core {
+    /**
+     * @brief Bookkeeping for one owning group, shared by every Group handle for the same components.
+     *
+     * Every function takes the owned sparse sets in the same order as GetOwnedTypes(), the component manager resolves
+     * them since sets are created and destroyed as component types are registered and unregistered.
+     */
+    class OwningGroup {
+    private:
+        // Component types whose sparse sets this group owns
+        std::vector<ComponentTypeIndex> m_owned_types;
+
+        // Number of entities in the group, they sit at dense positions [0, m_size) of every owned set
+        size_t m_size = 0;
+
+    public:
+        explicit OwningGroup(std::vector<ComponentTypeIndex> owned_types) : m_owned_types(std::move(owned_types)) {}
+
+        const std::vector<ComponentTypeIndex> &GetOwnedTypes() const { return m_owned_types; }
+
+        size_t Size() const { return m_size; }
+
+        /**
+         * @brief Checks if this group owns exactly the given component types, in any order
+         * @param types Component types to compare against
+         */
+        bool OwnsExactly(std::span<const ComponentTypeIndex> types) const {
+            return types.size() == m_owned_types.size() &&
+                   std::is_permutation(types.begin(), types.end(), m_owned_types.begin());
+        }
+
+        /**
+         * @brief Moves an entity into the group if it now has every owned component
+         * Call after a component owned by this group was added to the entity.
+         *
+         * @param sets Owned sparse sets, in the same order as GetOwnedTypes()
+         * @param entity Entity that was given a component
+         */
+        void Add(std::span<ISparseSet *const> sets, EntityID entity) {
+            for (ISparseSet *set : sets) {
+                if (!set || !set->HasElement(entity)) {
+                    return;
+                }
+            }
+
+            // Already in the group
+            if (static_cast<size_t>(sets.front()->GetDenseIndex(entity)) < m_size) {
+                return;
+            }
+
+            for (ISparseSet *set : sets) {
+                set->SwapDense(static_cast<size_t>(set->GetDenseIndex(entity)), m_size);
+            }
+            m_size++;
+        }
+
+        /**
+         * @brief Moves an entity out of the group if it's in it
+         * Call before a component owned by this group is removed from the entity, so the set's swap-and-pop removal
+         * happens outside the group's range.
+         *
+         * @param sets Owned sparse sets, in the same order as GetOwnedTypes()
+         * @param entity Entity that is about to lose a component
+         */
+        void Remove(std::span<ISparseSet *const> sets, EntityID entity) {
+            const int dense_index = sets.front() ? sets.front()->GetDenseIndex(entity) : -1;
+            if (dense_index < 0 || static_cast<size_t>(dense_index) >= m_size) {
+                return;
+            }
+
+            m_size--;
+            for (ISparseSet *set : sets) {
+                set->SwapDense(static_cast<size_t>(set->GetDenseIndex(entity)), m_size);
+            }
+        }
+
+        /**
+         * @brief Sorts every entity that has all owned components to the front of the owned sets
+         * @param sets Owned sparse sets, in the same order as GetOwnedTypes()
+         */
+        void Rebuild(std::span<ISparseSet *const> sets) {
+            m_size = 0;
+
+            if (std::find(sets.begin(), sets.end(), nullptr) != sets.end()) {
+                return;
+            }
+
+            // Walk the smallest set. Adding an entity only swaps it with one already visited, so nothing is skipped
+            ISparseSet *smallest = *std::min_element(
+                sets.begin(), sets.end(), [](ISparseSet *a, ISparseSet *b) { return a->Size() < b->Size(); });
+
+            const size_t *entities = smallest->GetIndices();
+            for (size_t position = 0; position < smallest->Size(); position++) {
+                Add(sets, static_cast<EntityID>(entities[position]));
+            }
+        }
+
+        // Forgets every entity, used when the owned sets are cleared
+        void Clear() { m_size = 0; }
+    };
+
+    /**
+     * @brief Iterates the entities of an owning group with their components.
+     *
+     * Every entity in the group has each component at the same dense position in every owned set, so Each() walks
+     * the sets' arrays side by side:
+     * @code
+     * g_ecs.Group<const Transform2D, const Texture>().Each([](EntityID entity, const Transform2D &, const Texture &) {
+     * });
+     * @endcode
+     *
+     * Like View, const components are handed out as const references and non-const ones are stamped as changed.
+     *
+     * @warning Adding or removing any of the grouped components while iterating reorders the group. Get a new handle
+     * after unregistering any of its component types.
+     * @tparam Components Component types owned by the group
+     */
+    template <typename... Components>
+    class Group {
+        static_assert(sizeof...(Components) > 0, "A group needs at least one component type");
+
+    private:
+        // Sparse sets for each component, in the same order as Components
+        std::tuple<ViewSet<Components> *...> m_sets;
+
+        const OwningGroup *m_group = nullptr;
+
+    public:
+        /**
+         * @brief Builds a handle to an owning group
+         * @param group Group bookkeeping, nullptr for an empty group
+         * @param sets Sparse sets in the same order as Components, nullptr if a component isn't registered
+         */
+        explicit Group(const OwningGroup *group, ViewSet<Components> *...sets) : m_sets(sets...), m_group(group) {
+            if (((sets == nullptr) || ...)) {
+                m_group = nullptr;
+            }
+        }
+
+        /**
+         * @brief Number of entities in the group
+         */
+        size_t Size() const { return m_group ? m_group->Size() : 0; }
+
+        /**
+         * @brief Checks if an entity is in the group
+         * @param entity Entity to check
+         */
+        bool Contains(EntityID entity) const {
+            if (!m_group) {
+                return false;
+            }
+
+            const int dense_index = std::get<0>(m_sets)->GetDenseIndex(entity);
+            return dense_index >= 0 && static_cast<size_t>(dense_index) < Size();
+        }
+
+        /**
+         * @brief Calls func for every entity in the group
+         *
+         * @param func Callable taking (EntityID, Components &...)
+         */
+        template <typename Func>
+        void Each(Func &&func) const {
+            EachInRange(0, Size(), func);
+        }
+
+        /**
+         * @brief Calls func for every entity in the group, split into chunks that run on the executor's worker threads
+         *
+         * Returns once every entity has been visited. See parallel.hpp for what func may and may not do.
+         *
+         * @tparam Executor Worker pool providing GetWorkerCount() and ParallelFor(begin, end, func, grain_size)
+         * @param executor Worker pool to run chunks on, the calling thread helps as well
+         * @param func Callable taking (EntityID, Components &...)
+         */
+        template <typename Executor, typename Func>
+        void ParallelForEach(Executor &executor, Func &&func) const {
+            constexpr size_t bytes_per_entity = sizeof(size_t) + (sizeof(std::remove_const_t<Components>) + ...);
+            const size_t size = Size();
+            const size_t chunk_size = ParallelChunkSize(size, bytes_per_entity, executor.GetWorkerCount() + 1);
+
+            executor.ParallelFor(
+                0, size,
+                [this, &func](size_t chunk_begin, size_t chunk_end) { EachInRange(chunk_begin, chunk_end, func); },
+                chunk_size);
+        }
+
+    private:
+        template <typename Func>
+        void EachInRange(size_t begin, size_t end, Func &func) const {
+            if (begin >= end) {
+                return;
+            }
+
+            std::apply(
+                [begin, end, &func](auto *...sets) {
+                    (MarkRangeChanged(sets, begin, end), ...);
+
+                    // Every owned set holds the group's entities in the same order, so any of them gives the IDs
+                    const size_t *entities = std::get<0>(std::tie(sets...))->GetIndices();
+                    for (size_t position = begin; position < end; position++) {
+                        func(static_cast<EntityID>(entities[position]), sets->GetDenseElement(position)...);
+                    }
+                },
+                m_sets);
+        }
+
+        template <typename Set>
+        static void MarkRangeChanged(Set *set, size_t begin, size_t end) {
+            if constexpr (!std::is_const_v<Set>) {
+                set->MarkDenseChanged(begin, end);
+            }
+        }
+    };
+} // namespace HBE::Core
\ No newline at end of file
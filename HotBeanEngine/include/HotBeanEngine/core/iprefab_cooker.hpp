@@ -0,0 +1,30 @@
+/**
+ * @file iprefab_cooker.hpp
+ * @author Daniel Parker (DParker13)
+ * @brief Abstract interface for cooking prefab assets.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <filesystem>
+
+#include <HotBeanEngine/core/iname.hpp>
+#include <HotBeanEngine/core/prefab.hpp>
+
+namespace HBE::Core {
+    /**
+     * @brief Parses a prefab asset into a Prefab whose components are ready to be copied into the world.
+     * Components are looked up by name in the ECS they're cooked for, so cook after every component is registered.
+     */
+    struct IPrefabCooker : public IName {
+        virtual ~IPrefabCooker() = default;
+
+        virtual std::string_view GetName() const override = 0;
+        virtual Prefab Cook(std::filesystem::path filepath) = 0;
+        virtual bool FileExists(std::filesystem::path filepath) { return std::filesystem::exists(filepath); }
+    };
+} // namespace HBE::Core
\ No newline at end of file
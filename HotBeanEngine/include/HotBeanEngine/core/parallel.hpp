@@ -0,0 +1,63 @@
+/**
+ * @file parallel.hpp
+ * @author Daniel Parker (DParker13)
+ * @brief Chunk sizing shared by the parallel iteration helpers.
+ *
+ * @details SparseSet::ParallelForEach() and View::ParallelForEach() split their dense arrays into chunks and hand
+ * each chunk to a worker. Chunks are sized here so they cover whole cache lines, so two workers never write to the same
+ * line, and are big enough that scheduling a chunk costs much less than running it.
+ *
+ * Safety contract for anything run through ParallelForEach():
+ * - The callback runs on several threads at once, each call gets a different entity.
+ * - Only touch the components handed to the callback. Reading other components and shared data is fine as long as
+ *   nothing writes to them during the loop.
+ * - Don't add or remove components, or create or destroy entities. Record the changes and apply them after the loop.
+ * - Don't call into SDL, the renderer, or anything else that must run on the main thread.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+namespace HBE::Core {
+    // Size of a CPU cache line in bytes, std::hardware_destructive_interference_size isn't available everywhere
+    inline constexpr size_t CACHE_LINE_SIZE = 64;
+
+    // Smallest amount of data a chunk should cover, below this scheduling costs more than it saves
+    inline constexpr size_t MIN_PARALLEL_CHUNK_BYTES = 16 * 1024;
+
+    /**
+     * @brief Number of elements of a given size that fit in one cache line
+     * @param element_size Size of one element in bytes
+     * @return At least 1
+     */
+    constexpr size_t ElementsPerCacheLine(size_t element_size) {
+        return element_size >= CACHE_LINE_SIZE ? 1 : CACHE_LINE_SIZE / element_size;
+    }
+
+    /**
+     * @brief Picks how many elements each parallel chunk should hold
+     *
+     * Gives every thread a few chunks so faster threads can steal the rest, never goes below
+     * MIN_PARALLEL_CHUNK_BYTES, and rounds up to a whole number of cache lines.
+     *
+     * @param count Number of elements to split
+     * @param element_size Bytes touched per element
+     * @param thread_count Threads that will run chunks, including the calling thread
+     * @return Elements per chunk, at least 1
+     */
+    constexpr size_t ParallelChunkSize(size_t count, size_t element_size, size_t thread_count) {
+        element_size = std::max<size_t>(1, element_size);
+
+        const size_t per_line = ElementsPerCacheLine(element_size);
+        const size_t min_chunk = std::max(per_line, MIN_PARALLEL_CHUNK_BYTES / element_size);
+        const size_t chunk = std::max(min_chunk, count / (std::max<size_t>(1, thread_count) * 4));
+
+        return (chunk + per_line - 1) / per_line * per_line;
+    }
+} // namespace HBE::Core
\ No newline at end of file
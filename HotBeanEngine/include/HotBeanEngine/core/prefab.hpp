@@ -0,0 +1,231 @@
+/**
+ * @file prefab.hpp
+ * @author Daniel Parker (DParker13)
+ * @brief Entity hierarchy that is cooked once and instantiated many times.
+ *
+ * @details A prefab is parsed from its asset once and cooked into live components, grouped by ComponentID. Every
+ * node's copy of one component type sits in a single aligned block of memory, its blob. Instantiating a prefab copies
+ * each blob straight into the component's sparse set for every instance at once, so spawning a thousand of them never
+ * goes back to the asset or its parser.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <HotBeanEngine/core/component.hpp>
+#include <HotBeanEngine/core/component_ops.hpp>
+#include <HotBeanEngine/core/entity.hpp>
+#include <HotBeanEngine/core/signature.hpp>
+
+namespace HBE::Core {
+    /**
+     * @brief Every node's copy of one component type, constructed back to back in one aligned allocation.
+     */
+    class PrefabComponentBlob {
+    private:
+        ComponentID m_component_id;
+        const ComponentOps *m_ops;
+
+        // Node that owns each component, m_nodes[i] owns the component at m_data + i * m_ops->size
+        std::vector<size_t> m_nodes;
+        std::byte *m_data = nullptr;
+        size_t m_capacity = 0;
+
+    public:
+        PrefabComponentBlob(ComponentID component_id, const ComponentOps &ops)
+            : m_component_id(component_id), m_ops(&ops) {}
+
+        PrefabComponentBlob(const PrefabComponentBlob &) = delete;
+        PrefabComponentBlob &operator=(const PrefabComponentBlob &) = delete;
+
+        PrefabComponentBlob(PrefabComponentBlob &&other) noexcept
+            : m_component_id(other.m_component_id), m_ops(other.m_ops), m_nodes(std::move(other.m_nodes)),
+              m_data(std::exchange(other.m_data, nullptr)), m_capacity(std::exchange(other.m_capacity, 0)) {
+            other.m_nodes.clear();
+        }
+
+        PrefabComponentBlob &operator=(PrefabComponentBlob &&other) noexcept {
+            if (this != &other) {
+                Release();
+                m_component_id = other.m_component_id;
+                m_ops = other.m_ops;
+                m_nodes = std::move(other.m_nodes);
+                m_data = std::exchange(other.m_data, nullptr);
+                m_capacity = std::exchange(other.m_capacity, 0);
+                other.m_nodes.clear();
+            }
+            return *this;
+        }
+
+        ~PrefabComponentBlob() { Release(); }
+
+        /**
+         * @brief Default constructs the component of another node at the end of the blob
+         * @param node Node that owns the new component
+         * @return The new component, ready to be deserialized into
+         */
+        IComponent &Add(size_t node) {
+            if (m_nodes.size() == m_capacity) {
+                Grow(std::max<size_t>(m_capacity * 2, 4));
+            }
+
+            void *slot = m_data + m_nodes.size() * m_ops->size;
+            m_ops->construct(slot);
+            m_nodes.push_back(node);
+            return *m_ops->as_component(slot);
+        }
+
+        ComponentID GetComponentID() const { return m_component_id; }
+
+        // Function table of the component type the blob was cooked with
+        const ComponentOps &GetComponentOps() const { return *m_ops; }
+
+        // Node that owns each component, in the order the components were added
+        std::span<const size_t> GetNodes() const { return m_nodes; }
+
+        size_t Size() const { return m_nodes.size(); }
+
+        /**
+         * @brief Get one of the blob's components
+         * @param position Position in the blob, below Size()
+         * @return Component owned by GetNodes()[position]
+         */
+        const IComponent &GetComponent(size_t position) const {
+            return *m_ops->as_component(m_data + position * m_ops->size);
+        }
+
+    private:
+        void Grow(size_t capacity) {
+            std::byte *data =
+                static_cast<std::byte *>(::operator new(capacity * m_ops->size, std::align_val_t{m_ops->alignment}));
+
+            for (size_t i = 0; i < m_nodes.size(); i++) {
+                m_ops->move(data + i * m_ops->size, m_data + i * m_ops->size);
+                m_ops->destroy(m_data + i * m_ops->size);
+            }
+
+            Deallocate();
+            m_data = data;
+            m_capacity = capacity;
+        }
+
+        void Release() {
+            for (size_t i = 0; i < m_nodes.size(); i++) {
+                m_ops->destroy(m_data + i * m_ops->size);
+            }
+
+            m_nodes.clear();
+            Deallocate();
+        }
+
+        void Deallocate() {
+            if (m_data) {
+                ::operator delete(m_data, std::align_val_t{m_ops->alignment});
+                m_data = nullptr;
+                m_capacity = 0;
+            }
+        }
+    };
+
+    /**
+     * @brief A cooked entity hierarchy, see ECSManager::InstantiatePrefab().
+     *
+     * Nodes are numbered in the order they are added. Node 0 is the root and every other node is added after its
+     * parent, so walking the nodes in order always reaches a parent before its children.
+     */
+    class Prefab {
+    public:
+        // One entity of the prefab
+        struct Node {
+            // Index of the parent node, -1 for the root
+            Sint64 parent;
+
+            // Components the node has
+            Signature signature;
+        };
+
+    private:
+        std::vector<Node> m_nodes;
+        std::vector<PrefabComponentBlob> m_components;
+
+    public:
+        /**
+         * @brief Adds an entity to the prefab
+         * @param parent Index of the parent node, -1 for the root
+         * @return Index of the new node
+         * @throws std::invalid_argument if the root is missing or added twice, or the parent isn't an earlier node
+         */
+        size_t AddNode(Sint64 parent = -1) {
+            if (m_nodes.empty() != (parent == -1) || parent >= static_cast<Sint64>(m_nodes.size()) || parent < -1) {
+                throw std::invalid_argument("Prefab node " + std::to_string(m_nodes.size()) + " can't have parent " +
+                                            std::to_string(parent) + ", node 0 is the only root");
+            }
+
+            m_nodes.push_back({parent, Signature()});
+            return m_nodes.size() - 1;
+        }
+
+        /**
+         * @brief Default constructs a component for a node, to be deserialized into
+         * @param node Node to add the component to
+         * @param component_id ID the component is registered with
+         * @param ops Function table of the component type
+         * @return The new component
+         * @throws std::out_of_range if the node doesn't exist or the ID is past MAX_COMPONENTS
+         * @throws std::invalid_argument if the node already has the component
+         */
+        IComponent &AddComponent(size_t node, ComponentID component_id, const ComponentOps &ops) {
+            if (node >= m_nodes.size()) {
+                throw std::out_of_range("Prefab node " + std::to_string(node) + " doesn't exist");
+            }
+
+            Signature &signature = m_nodes[node].signature;
+            if (signature.test(component_id)) {
+                throw std::invalid_argument("Prefab node " + std::to_string(node) + " already has ComponentID " +
+                                            std::to_string(component_id));
+            }
+
+            auto blob = std::find_if(m_components.begin(), m_components.end(), [&](const PrefabComponentBlob &b) {
+                return b.GetComponentID() == component_id;
+            });
+
+            if (blob == m_components.end()) {
+                blob = m_components.emplace(blob, component_id, ops);
+            }
+
+            signature.set(component_id);
+            return blob->Add(node);
+        }
+
+        /**
+         * @brief Default constructs a component for a node, to be set up directly
+         * @tparam T Component type
+         * @param node Node to add the component to
+         * @param component_id ID T is registered with
+         * @return The new component
+         */
+        template <typename T>
+        T &AddComponent(size_t node, ComponentID component_id) {
+            return static_cast<T &>(AddComponent(node, component_id, COMPONENT_OPS<T>));
+        }
+
+        const std::vector<Node> &GetNodes() const { return m_nodes; }
+
+        // One blob per component type used by any node
+        const std::vector<PrefabComponentBlob> &GetComponents() const { return m_components; }
+
+        size_t NodeCount() const { return m_nodes.size(); }
+    };
+} // namespace HBE::Core
\ No newline at end of file
@@ -0,0 +1,245 @@
+/**
+ * @file query_cache.hpp
+ * @author Daniel Parker (DParker13)
+ * @brief Cached results of entity queries, kept up to date as entity signatures change.
+ *
+ * @details A query is a filter over entity signatures: the components an entity must have and the ones it must not
+ * have. The first time a query is asked for its result is found by scanning every entity. The second time it becomes
+ * persistent, the cache keeps its matching set and updates it from the same hooks that keep systems' entities up to
+ * date, so every later ask costs nothing and iterating the result costs O(matches).
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <HotBeanEngine/core/component.hpp>
+#include <HotBeanEngine/core/entity_set.hpp>
+#include <HotBeanEngine/core/signature.hpp>
+
+namespace HBE::Core {
+    // Query term for components a matching entity must not have
+    template <typename... Components>
+    struct Without {};
+
+    // Query term for components a matching entity may have, they don't change which entities match
+    template <typename... Components>
+    struct Optional {};
+
+    // True for Without and Optional terms, every other query term is a component the entity must have
+    template <typename T>
+    inline constexpr bool IS_QUERY_MODIFIER = false;
+
+    template <typename... Components>
+    inline constexpr bool IS_QUERY_MODIFIER<Without<Components...>> = true;
+
+    template <typename... Components>
+    inline constexpr bool IS_QUERY_MODIFIER<Optional<Components...>> = true;
+
+    /**
+     * @brief Which entities a query matches.
+     * Optional terms aren't part of the filter, so queries that only differ in them share one cached result.
+     */
+    struct QueryFilter {
+        // Components a matching entity must have, at least one
+        Signature with;
+
+        // Components a matching entity must not have
+        Signature without;
+
+        bool Matches(const Signature &entity_signature) const {
+            return with.IsSubsetOf(entity_signature) && (without & entity_signature).none();
+        }
+
+        bool Uses(ComponentID component_id) const { return with[component_id] || without[component_id]; }
+
+        friend bool operator==(const QueryFilter &a, const QueryFilter &b) = default;
+    };
+
+    /**
+     * @brief Matching sets of every query asked for more than once.
+     *
+     * Persistent filters are stored back to back, like system signatures, so matching a changed entity against every
+     * query is one pass over an array. Results live behind stable pointers, a reference handed out by Find() or Add()
+     * stays valid until a component the query uses is unregistered.
+     *
+     * @warning Not thread safe. Ask for queries on the thread that changes entities, never from parallel systems.
+     */
+    class QueryCache {
+    private:
+        // Persistent queries, m_results[i] is kept matching m_filters[i]
+        std::vector<QueryFilter> m_filters;
+        std::vector<std::unique_ptr<EntitySet>> m_results;
+
+        // Queries asked for once, their results were correct when they were asked for and aren't updated
+        std::vector<QueryFilter> m_seen_filters;
+        std::vector<std::unique_ptr<EntitySet>> m_seen_results;
+
+        // Scratch space for MatchFilters(), 1 where the query's filter matched
+        std::vector<uint8_t> m_matches;
+
+    public:
+        /**
+         * @brief Get the up to date result of a persistent query
+         * @param filter Query to look up
+         * @return Matching entities, nullptr if the query hasn't been asked for twice yet
+         */
+        const EntitySet *Find(const QueryFilter &filter) const {
+            auto it = std::find(m_filters.begin(), m_filters.end(), filter);
+            return it == m_filters.end() ? nullptr : m_results[static_cast<size_t>(it - m_filters.begin())].get();
+        }
+
+        /**
+         * @brief Store the result of a query that isn't persistent yet
+         * The first time a query is added its result is kept as is. The second time the query becomes persistent and
+         * is kept up to date from then on.
+         *
+         * @param filter Query that was evaluated
+         * @param matched Every entity matching the query right now
+         * @return Stored result
+         */
+        const EntitySet &Add(const QueryFilter &filter, EntitySet matched) {
+            auto seen = std::find(m_seen_filters.begin(), m_seen_filters.end(), filter);
+            if (seen == m_seen_filters.end()) {
+                m_seen_filters.push_back(filter);
+                m_seen_results.push_back(std::make_unique<EntitySet>(std::move(matched)));
+                return *m_seen_results.back();
+            }
+
+            // Move the same EntitySet over so references from the first ask start being kept up to date
+            const size_t index = static_cast<size_t>(seen - m_seen_filters.begin());
+            std::unique_ptr<EntitySet> result = std::move(m_seen_results[index]);
+            *result = std::move(matched);
+
+            m_seen_filters.erase(seen);
+            m_seen_results.erase(m_seen_results.begin() + static_cast<std::ptrdiff_t>(index));
+
+            m_filters.push_back(filter);
+            m_results.push_back(std::move(result));
+            return *m_results.back();
+        }
+
+        /**
+         * @brief Adds the entity to every persistent query it now matches and removes it from the rest
+         * @param entity Entity whose signature changed
+         * @param entity_signature The entity's new signature
+         */
+        void EntitySignatureChanged(EntityID entity, const Signature &entity_signature) {
+            MatchFilters(entity_signature);
+
+            for (size_t i = 0; i < m_results.size(); i++) {
+                if (m_matches[i]) {
+                    m_results[i]->Insert(entity);
+                }
+                else {
+                    m_results[i]->Remove(entity);
+                }
+            }
+        }
+
+        /**
+         * @brief Matches a batch of entities sharing one signature, each filter is tested once for the whole batch
+         * @param entities Entities whose signature changed
+         * @param entity_signature The new signature shared by every entity in the batch
+         */
+        void EntitiesSignatureChanged(std::span<const EntityID> entities, const Signature &entity_signature) {
+            if (entities.empty()) {
+                return;
+            }
+
+            const EntityID largest_entity = *std::max_element(entities.begin(), entities.end());
+            MatchFilters(entity_signature);
+
+            for (size_t i = 0; i < m_results.size(); i++) {
+                EntitySet &result = *m_results[i];
+
+                if (m_matches[i]) {
+                    result.Reserve(result.Size() + entities.size(), largest_entity);
+                    for (EntityID entity : entities) {
+                        result.Insert(entity);
+                    }
+                }
+                else {
+                    for (EntityID entity : entities) {
+                        result.Remove(entity);
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Removes a destroyed entity from every query
+         * @param entity Entity that was destroyed
+         */
+        void EntityDestroyed(EntityID entity) {
+            for (const std::unique_ptr<EntitySet> &result : m_results) {
+                result->Remove(entity);
+            }
+        }
+
+        /**
+         * @brief Empties every query's result, the queries stay cached
+         * Used when every entity is replaced at once, match the new ones with EntitySignatureChanged().
+         */
+        void ClearEntities() {
+            for (const std::unique_ptr<EntitySet> &result : m_results) {
+                result->Clear();
+            }
+
+            for (const std::unique_ptr<EntitySet> &result : m_seen_results) {
+                result->Clear();
+            }
+        }
+
+        /**
+         * @brief Forgets every query that uses a component, call before the component is unregistered
+         * Its ID can be handed to another component type afterwards, which the query was never asked about.
+         *
+         * @param component_id Component that is being unregistered
+         */
+        void ForgetComponent(ComponentID component_id) {
+            EraseIf(m_filters, m_results, component_id);
+            EraseIf(m_seen_filters, m_seen_results, component_id);
+        }
+
+        // Number of persistent queries
+        size_t Size() const { return m_filters.size(); }
+
+    private:
+        void MatchFilters(const Signature &entity_signature) {
+            const size_t filter_count = m_filters.size();
+            m_matches.resize(filter_count);
+
+            const QueryFilter *filters = m_filters.data();
+            uint8_t *matches = m_matches.data();
+
+            for (size_t i = 0; i < filter_count; i++) {
+                matches[i] = static_cast<uint8_t>(filters[i].Matches(entity_signature));
+            }
+        }
+
+        static void EraseIf(std::vector<QueryFilter> &filters, std::vector<std::unique_ptr<EntitySet>> &results,
+                            ComponentID component_id) {
+            size_t kept = 0;
+            for (size_t i = 0; i < filters.size(); i++) {
+                if (!filters[i].Uses(component_id)) {
+                    filters[kept] = filters[i];
+                    results[kept] = std::move(results[i]);
+                    kept++;
+                }
+            }
+
+            filters.resize(kept);
+            results.resize(kept);
+        }
+    };
+} // namespace HBE::Core
\ No newline at end of file
@@ -2,6 +2,10 @@
  * @file signature.hpp
  * @author Daniel Parker (DParker13)
  * @brief Used to identify which components an entity has.
+ *
+ * @details A signature has one bit per ComponentID. Its width is MAX_COMPONENTS, picked at build time with the
+ * HBE_MAX_COMPONENTS CMake option. The bits live in an aligned array of 64-bit words, and every operation is a loop
+ * over a fixed number of words with no branches, so the compiler unrolls it into a few vector instructions.
  * @version 0.1
  * @date 2025-02-23
  *
@@ -10,11 +14,213 @@
 
 #pragma once
 
-#include <bitset>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
 
 #include <HotBeanEngine/core/config.hpp>
 
 namespace HBE::Core {
-    // Bitset indicates which components an entity has
-    using Signature = std::bitset<MAX_COMPONENTS>;
+    /**
+     * @brief Fixed-width set of bits, with the parts of std::bitset's interface the engine uses.
+     *
+     * Bits are numbered from 0. to_string() and the string constructor write the highest bit first, like std::bitset,
+     * so a signature saved at one width loads at any other width that fits its set bits.
+     * @tparam BITS Number of bits, a multiple of 64
+     */
+    template <size_t BITS>
+    class BasicSignature {
+        static_assert(BITS > 0 && BITS % 64 == 0, "Signature width must be a multiple of 64 bits");
+
+    public:
+        static constexpr size_t WORD_BITS = 64;
+        static constexpr size_t WORD_COUNT = BITS / WORD_BITS;
+
+    private:
+        // Aligned to its full size, up to a cache line, so wide signatures load with aligned vector instructions
+        alignas(std::min<size_t>(WORD_COUNT * sizeof(uint64_t), 64)) std::array<uint64_t, WORD_COUNT> m_words{};
+
+    public:
+        constexpr BasicSignature() = default;
+
+        /**
+         * @brief Reads a string of '0' and '1' characters, highest bit first
+         * Shorter strings fill the lowest bits. Longer strings are accepted as long as the extra bits are '0'.
+         *
+         * @param bits Characters to read
+         * @throws std::invalid_argument if a character isn't '0' or '1'
+         * @throws std::out_of_range if a bit past the signature's width is set
+         */
+        explicit BasicSignature(std::string_view bits) {
+            for (size_t pos = 0; pos < bits.size(); pos++) {
+                const char bit = bits[bits.size() - 1 - pos];
+                if (bit != '0' && bit != '1') {
+                    throw std::invalid_argument("Signature strings can only hold '0' and '1'");
+                }
+
+                if (bit == '1') {
+                    set(pos);
+                }
+            }
+        }
+
+        static constexpr size_t size() { return BITS; }
+
+        /**
+         * @brief Check a bit
+         * @param pos Bit to check
+         * @return True if the bit is set
+         * @throws std::out_of_range if pos is past the signature's width
+         */
+        constexpr bool test(size_t pos) const {
+            CheckPosition(pos);
+            return (*this)[pos];
+        }
+
+        // Unchecked test()
+        constexpr bool operator[](size_t pos) const { return (m_words[pos / WORD_BITS] >> (pos % WORD_BITS)) & 1u; }
+
+        // Sets every bit
+        constexpr BasicSignature &set() {
+            m_words.fill(~uint64_t{0});
+            return *this;
+        }
+
+        /**
+         * @brief Set or clear a bit
+         * @param pos Bit to change
+         * @param value True sets the bit, false clears it
+         * @throws std::out_of_range if pos is past the signature's width
+         */
+        constexpr BasicSignature &set(size_t pos, bool value = true) {
+            CheckPosition(pos);
+
+            const uint64_t mask = uint64_t{1} << (pos % WORD_BITS);
+            uint64_t &word = m_words[pos / WORD_BITS];
+            word = value ? word | mask : word & ~mask;
+            return *this;
+        }
+
+        // Clears every bit
+        constexpr BasicSignature &reset() {
+            m_words.fill(0);
+            return *this;
+        }
+
+        constexpr BasicSignature &reset(size_t pos) { return set(pos, false); }
+
+        /**
+         * @brief Count the set bits
+         * @return Number of bits that are set
+         */
+        constexpr size_t count() const {
+            size_t total = 0;
+            for (uint64_t word : m_words) {
+                total += static_cast<size_t>(std::popcount(word));
+            }
+            return total;
+        }
+
+        constexpr bool any() const { return !none(); }
+
+        constexpr bool none() const {
+            uint64_t combined = 0;
+            for (uint64_t word : m_words) {
+                combined |= word;
+            }
+            return combined == 0;
+        }
+
+        /**
+         * @brief Checks if every bit set here is also set in other
+         * Used to match a system's signature against an entity's. Accumulates without branching so the whole test
+         * vectorizes.
+         *
+         * @param other Signature that should contain this one
+         * @return True if this signature is a subset of other
+         */
+        constexpr bool IsSubsetOf(const BasicSignature &other) const {
+            uint64_t missing = 0;
+            for (size_t i = 0; i < WORD_COUNT; i++) {
+                missing |= m_words[i] & ~other.m_words[i];
+            }
+            return missing == 0;
+        }
+
+        /**
+         * @brief Get the bits as words, bit pos is bit (pos % 64) of word (pos / 64)
+         * @return The signature's words, lowest bits first
+         */
+        constexpr const std::array<uint64_t, WORD_COUNT> &GetWords() const { return m_words; }
+
+        /**
+         * @brief Write the bits as '0' and '1' characters, highest bit first
+         * @return String of size() characters
+         */
+        std::string to_string() const {
+            std::string bits(BITS, '0');
+            for (size_t pos = 0; pos < BITS; pos++) {
+                if ((*this)[pos]) {
+                    bits[BITS - 1 - pos] = '1';
+                }
+            }
+            return bits;
+        }
+
+        constexpr BasicSignature &operator&=(const BasicSignature &other) {
+            for (size_t i = 0; i < WORD_COUNT; i++) {
+                m_words[i] &= other.m_words[i];
+            }
+            return *this;
+        }
+
+        constexpr BasicSignature &operator|=(const BasicSignature &other) {
+            for (size_t i = 0; i < WORD_COUNT; i++) {
+                m_words[i] |= other.m_words[i];
+            }
+            return *this;
+        }
+
+        constexpr BasicSignature &operator^=(const BasicSignature &other) {
+            for (size_t i = 0; i < WORD_COUNT; i++) {
+                m_words[i] ^= other.m_words[i];
+            }
+            return *this;
+        }
+
+        constexpr BasicSignature operator~() const {
+            BasicSignature result;
+            for (size_t i = 0; i < WORD_COUNT; i++) {
+                result.m_words[i] = ~m_words[i];
+            }
+            return result;
+        }
+
+        friend constexpr BasicSignature operator&(BasicSignature a, const BasicSignature &b) { return a &= b; }
+        friend constexpr BasicSignature operator|(BasicSignature a, const BasicSignature &b) { return a |= b; }
+        friend constexpr BasicSignature operator^(BasicSignature a, const BasicSignature &b) { return a ^= b; }
+
+        friend constexpr bool operator==(const BasicSignature &a, const BasicSignature &b) {
+            uint64_t difference = 0;
+            for (size_t i = 0; i < WORD_COUNT; i++) {
+                difference |= a.m_words[i] ^ b.m_words[i];
+            }
+            return difference == 0;
+        }
+
+    private:
+        static constexpr void CheckPosition(size_t pos) {
+            if (pos >= BITS) {
+                throw std::out_of_range("Signature bit " + std::to_string(pos) + " is past the signature's width");
+            }
+        }
+    };
+
+    // Which components an entity has, one bit per ComponentID
+    using Signature = BasicSignature<MAX_COMPONENTS>;
 } // namespace HBE::Core
\ No newline at end of file
@@ -6,6 +6,14 @@
  * @details Keeps track of two arrays, dense array and sparse array.
  * The Dense array is a packed array with no gaps. This array is iterated through.
  * The Sparse array is an array that can have gaps, each element is an index in the Dense array.
+ * Both arrays are split into pages that are only allocated once an element needs them, so memory scales with the
+ * number of stored elements instead of the maximum number of items.
+ * Pages are kept when elements are removed, so a set that empties and fills again every frame reuses the same memory.
+ * ShrinkToFit() hands back the pages that are no longer used.
+ * Every dense slot also has ComponentTicks recording when it was added and last accessed mutably.
+ * Dense pages are raw storage, elements are constructed in place when inserted, moved when a removal fills the gap, and
+ * destroyed when removed, so components that own resources are never copied or left aliased.
+ * Tag components have no data, so a set of tags allocates no dense pages and every index shares one instance.
  * @version 0.1
  * @date 2025-02-23
  *
@@ -14,29 +22,161 @@
 
 #pragma once
 
-#include <any>
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
 #include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
 
+#include <HotBeanEngine/core/change_tick.hpp>
 #include <HotBeanEngine/core/component.hpp>
+#include <HotBeanEngine/core/component_ops.hpp>
+#include <HotBeanEngine/core/parallel.hpp>
 
 namespace HBE::Core {
 
     /**
      * @brief Interface for type-erased sparse set operations.
-     * Provides common operations for all sparse set implementations.
+     * Provides common operations for all component sparse sets when only the ComponentID is known.
      */
     struct ISparseSet {
         virtual ~ISparseSet() = default;
-        virtual bool Add(std::any value) = 0;
-        virtual bool Insert(size_t index, const std::any value) = 0;
+
+        /**
+         * @brief Copies a component into the set
+         * @param index Index to insert at
+         * @param component Component to copy, must be exactly the set's component type
+         * @return False if the index is taken or out of range, or the component is the wrong type
+         */
+        virtual bool InsertCopy(size_t index, const IComponent &component) = 0;
+
+        /**
+         * @brief Moves a component into the set
+         * @param index Index to insert at
+         * @param component Component to move from, must be exactly the set's component type
+         * @return False if the index is taken or out of range, or the component is the wrong type
+         */
+        virtual bool InsertMove(size_t index, IComponent &&component) = 0;
+
         virtual bool InsertEmpty(size_t index) = 0;
+
+        /**
+         * @brief Copies one element of the set to several new indices
+         * Elements that can't be copied are default constructed instead, check GetComponentOps().copy first.
+         * @param source_index Index of the element to copy
+         * @param indices Indices to insert the copies at, indices that are taken or out of range are skipped
+         * @return Number of copies inserted, 0 if there is no element at source_index
+         */
+        virtual size_t InsertCopies(size_t source_index, std::span<const size_t> indices) = 0;
+
+        /**
+         * @brief Copies a component that lives outside the set, like a cooked prefab component, to several indices
+         * @param source Component to copy, must be exactly the set's component type
+         * @param indices Indices to insert the copies at, indices that are taken or out of range are skipped
+         * @return Number of copies inserted, 0 if the component is the wrong type
+         */
+        virtual size_t InsertCopies(const IComponent &source, std::span<const size_t> indices) = 0;
         virtual bool Remove(size_t index) = 0;
-        virtual std::any GetElementPtrAsAny(size_t index) = 0;
+
+        /**
+         * @brief Allocates room for at least capacity elements so a batch of inserts doesn't allocate one at a time
+         * @param capacity Total number of elements to make room for
+         */
+        virtual void Reserve(size_t capacity) = 0;
+
+        /**
+         * @brief Removes every element, the pages holding them are kept for the next elements
+         */
+        virtual void Clear() = 0;
+
+        /**
+         * @brief Frees every page that isn't holding an element, the elements themselves don't move
+         */
+        virtual void ShrinkToFit() = 0;
+
+        /**
+         * @brief Get how many elements fit in the pages allocated right now
+         * @return Number of elements the set can hold before allocating another page
+         */
+        virtual size_t Capacity() const = 0;
+
+        /**
+         * @brief Get the component at an index through its base class
+         * @param index Index of the element
+         * @return Pointer to the component, or nullptr if there is no element at index
+         */
+        virtual IComponent *GetComponent(size_t index) = 0;
+        virtual const IComponent *GetComponent(size_t index) const = 0;
+
+        /**
+         * @brief Get the function table for the set's component type
+         * @return Table shared by every set of the same component type
+         */
+        virtual const ComponentOps &GetComponentOps() const = 0;
+
+        /**
+         * @brief Set the counter that new and changed elements are stamped with
+         * @param tick_source Counter owned by the component manager, nullptr stamps everything with tick 0
+         */
+        virtual void SetTickSource(const Tick *tick_source) = 0;
+
+        /**
+         * @brief Stamp an element as changed at the current tick
+         * Only needed for writes made through GetComponent(), typed mutable access stamps the element itself.
+         * @param index Index of the element
+         */
+        virtual void MarkChanged(size_t index) = 0;
+
+        /**
+         * @brief Get when an element was added and last changed
+         * @param index Index of the element
+         * @return Pointer to the element's ticks, or nullptr if there is no element at index
+         */
+        virtual const ComponentTicks *GetTicks(size_t index) const = 0;
+
+        /**
+         * @brief Get the dense position of the element at an index
+         * @param index Index of the element
+         * @return Dense position, or -1 if the index has no element
+         */
+        virtual int GetDenseIndex(size_t index) const = 0;
+
+        /**
+         * @brief Swaps two elements' dense positions, along with their ticks and indices
+         * Used by owning groups to keep the elements they own at the front of the dense array.
+         * @param dense_a Dense position of the first element
+         * @param dense_b Dense position of the second element
+         */
+        virtual void SwapDense(size_t dense_a, size_t dense_b) = 0;
+
+        /**
+         * @brief Get the indices stored in the set in dense order
+         * @return Pointer to Size() indices, invalidated when an element is inserted or removed
+         */
+        virtual const size_t *GetIndices() const = 0;
+
+        /**
+         * @brief Copies the whole set, elements, indices and ticks
+         * Elements that can't be copied are default constructed in the copy, check GetComponentOps().copy first.
+         * @return New set of the same component type
+         */
+        virtual std::unique_ptr<ISparseSet> Clone() const = 0;
+
+        /**
+         * @brief Stamp every element as added and changed at the current tick
+         */
+        virtual void MarkAllAdded() = 0;
+
         virtual size_t Size() const = 0;
         virtual bool HasElement(size_t index) const = 0;
+        virtual size_t GetMaxItems() const = 0;
+        virtual bool SetMaxItems(size_t max_items) = 0;
     };
 
     /**
@@ -44,43 +184,134 @@ namespace HBE::Core {
      *
      * Uses dense and sparse arrays for fast iteration and O(1) lookup.
      * Optimized for ECS component storage with minimal memory overhead.
+     *
+     * MAX_ITEMS is the default limit on the index range. The limit can be changed at runtime with SetMaxItems().
+     * Dense pages never move once allocated, so element addresses stay valid while other elements are added.
+     * Pages start on a cache line boundary so parallel chunks don't share lines.
+     *
+     * Elements only need to be move constructible. Copying elements in also needs T to be copy constructible. Copying
+     * the whole set goes through T's Clone() hook if it has one, see IS_COMPONENT_COPYABLE.
+     *
+     * Inserting an element stamps it as added and changed. Getting a non-const reference or pointer to an element,
+     * including through a non-const iterator or ParallelForEach(), stamps it as changed. Const access never does.
+     *
+     * When T is a tag component (see IS_TAG_COMPONENT) only the indices and ticks are stored. Every element access
+     * returns the same shared instance, and elements passed in when inserting are ignored.
      */
     template <typename T, size_t MAX_ITEMS>
     class SparseSet : public ISparseSet {
+        static_assert(std::is_base_of_v<IComponent, T>, "T must inherit from IComponent");
+
+    public:
+        // Number of sparse entries in one sparse page
+        static constexpr size_t SPARSE_PAGE_SIZE = 4096;
+
+        // Number of elements in one dense page
+        static constexpr size_t DENSE_PAGE_SIZE = 256;
+
+        // Tag sets track membership only and never allocate dense pages
+        static constexpr bool IS_TAG = IS_TAG_COMPONENT<T>;
+
     private:
-        // Current size of the m_dense array
+        using SparsePage = std::array<int, SPARSE_PAGE_SIZE>;
+
+        // Uninitialized storage for one page of elements, only slots below the set's size hold a constructed element
+        struct alignas(std::max(CACHE_LINE_SIZE, alignof(T))) DensePage {
+            std::byte storage[sizeof(T) * DENSE_PAGE_SIZE];
+
+            T *Slot(size_t offset) { return reinterpret_cast<T *>(storage) + offset; }
+
+            T &operator[](size_t offset) { return *std::launder(Slot(offset)); }
+
+            const T &operator[](size_t offset) const {
+                return *std::launder(reinterpret_cast<const T *>(storage) + offset);
+            }
+        };
+
+        // Current size of the dense array
         size_t m_size;
 
-        // The packed array with no gaps
-        std::array<T, MAX_ITEMS> m_dense;
+        // Indices at or above this limit are rejected
+        size_t m_max_items;
+
+        // The packed array with no gaps, split into pages that are allocated as the set grows
+        std::vector<std::unique_ptr<DensePage>> m_dense_pages;
+
+        // Sparse array that can have gaps, each element is an index in the dense array
+        // Pages are allocated the first time an index inside them is used
+        std::vector<std::unique_ptr<SparsePage>> m_sparse_pages;
 
-        // Sparse array that can have gaps, each element is an index in the m_dense array
-        std::array<int, MAX_ITEMS> m_sparse;
+        // Number of used entries in each sparse page, so ShrinkToFit() knows which pages are empty
+        std::vector<size_t> m_sparse_page_counts;
 
         // Reverse mapping: maps dense index back to sparse index for O(1) removal
-        std::array<size_t, MAX_ITEMS> m_dense_to_sparse;
+        std::vector<size_t> m_dense_to_sparse;
+
+        // Added and changed ticks for each dense slot, in the same order as the dense array
+        std::vector<ComponentTicks> m_ticks;
+
+        // Counter to stamp ticks with, owned by the component manager
+        const Tick *m_tick_source = nullptr;
 
     public:
-        SparseSet() : m_size(0) { m_sparse.fill(-1); }
+        SparseSet() : m_size(0), m_max_items(MAX_ITEMS) {}
 
         /**
-         * @brief Copy constructor
+         * @brief Copy constructor, copies every element
+         * Elements that can't be copied are default constructed instead, see IS_COMPONENT_COPYABLE.
          * @param other Other sparse set reference
          */
         SparseSet(const SparseSet &other)
-            : m_size(other.m_size), m_dense(other.m_dense), m_sparse(other.m_sparse),
-              m_dense_to_sparse(other.m_dense_to_sparse) {}
+            : m_size(0), m_max_items(other.m_max_items), m_sparse_page_counts(other.m_sparse_page_counts),
+              m_dense_to_sparse(other.m_dense_to_sparse), m_ticks(other.m_ticks), m_tick_source(other.m_tick_source) {
+            m_dense_pages.reserve(other.m_dense_pages.size());
+            for (size_t page = 0; page < other.m_dense_pages.size(); page++) {
+                m_dense_pages.push_back(AllocateDensePage());
+            }
+
+            // m_size counts constructed elements, so the destructor cleans up if a copy throws part way
+            for (; m_size < other.m_size; m_size++) {
+                if constexpr (IS_TAG) {
+                    continue;
+                }
+                else if constexpr (IS_COMPONENT_COPYABLE<T>) {
+                    CopyConstructComponent(GetDenseSlot(m_size), other.GetDenseElement(m_size));
+                }
+                else {
+                    std::construct_at(GetDenseSlot(m_size));
+                }
+            }
+
+            m_sparse_pages.reserve(other.m_sparse_pages.size());
+            for (const auto &page : other.m_sparse_pages) {
+                m_sparse_pages.push_back(page ? std::make_unique<SparsePage>(*page) : nullptr);
+            }
+        }
 
         /**
          * @brief Move constructor
          * @param other Other sparse set reference
          */
         SparseSet(SparseSet &&other) noexcept
-            : m_size(other.m_size), m_dense(std::move(other.m_dense)), m_sparse(std::move(other.m_sparse)),
-              m_dense_to_sparse(std::move(other.m_dense_to_sparse)) {
+            : m_size(other.m_size), m_max_items(other.m_max_items), m_dense_pages(std::move(other.m_dense_pages)),
+              m_sparse_pages(std::move(other.m_sparse_pages)),
+              m_sparse_page_counts(std::move(other.m_sparse_page_counts)),
+              m_dense_to_sparse(std::move(other.m_dense_to_sparse)), m_ticks(std::move(other.m_ticks)),
+              m_tick_source(other.m_tick_source) {
             other.m_size = 0;
         }
 
+        SparseSet &operator=(const SparseSet &) = delete;
+        SparseSet &operator=(SparseSet &&) = delete;
+
+        ~SparseSet() override {
+            if constexpr (!IS_TAG) {
+                for (size_t dense_index = 0; dense_index < m_size; dense_index++) {
+                    std::destroy_at(&GetDenseElement(dense_index));
+                }
+            }
+        }
+
         /**
          * @brief Subscript operator for element access
          * @param index Index of the element
@@ -90,97 +321,86 @@ namespace HBE::Core {
 
         const T &operator[](size_t index) const { return GetElementAsRef(index); }
 
-        /**
-         * @brief Adds an element sequentially to the set
-         * @param value Value to add
-         */
-        bool Add(std::any value) override {
-            // Check if the set is full
-            if (m_size >= MAX_ITEMS) {
+        // Move-only components can't be copied in, so the copy is refused like a component of the wrong type
+        bool InsertCopy(size_t index, const IComponent &component) override {
+            if constexpr (std::is_copy_constructible_v<T>) {
+                if (typeid(component) == typeid(T)) {
+                    return Insert(index, static_cast<const T &>(component));
+                }
+            }
+
+            return false;
+        }
+
+        bool InsertMove(size_t index, IComponent &&component) override {
+            if (typeid(component) != typeid(T)) {
                 return false;
             }
 
-            return this->Insert(m_size, value);
+            return Insert(index, std::move(static_cast<T &>(component)));
         }
 
         /**
-         * @brief Inserts an element into the set
+         * @brief Inserts a copy of an element into the set
          *
          * @param index Index to insert at
-         * @param value Value to insert
+         * @param value Value to copy
+         * @return True if successful
          */
-        bool Insert(size_t index, const std::any value) override {
-            if (index >= MAX_ITEMS || m_sparse[index] != -1) {
-                return false;
-            }
-
-            const T *typed_value_ptr = std::any_cast<T>(&value);
-            if (typed_value_ptr == nullptr) {
-                return false;
-            }
+        bool Insert(size_t index, const T &value) { return Emplace(index, value); }
 
-            // Maps typed value to end of m_dense array
-            m_dense[m_size] = *typed_value_ptr;
-
-            // Maps this typed value's m_dense array index (m_size) to the m_sparse array index (value)
-            m_sparse[index] = static_cast<int>(m_size);
-
-            // Store reverse mapping
-            m_dense_to_sparse[m_size] = index;
-
-            // Update m_dense array size
-            m_size++;
-
-            return true;
-        }
+        /**
+         * @brief Moves an element into the set
+         *
+         * @param index Index to insert at
+         * @param value Value to move from
+         * @return True if successful
+         */
+        bool Insert(size_t index, T &&value) { return Emplace(index, std::move(value)); }
 
         /**
-         * @brief Inserts an element into the set
+         * @brief Constructs an element in place at the end of the dense array
          *
          * @param index Index to insert at
-         * @param value Value to insert
+         * @param args Arguments passed to T's constructor
          * @return True if successful
          */
-        bool Insert(size_t index, const T &value) {
-            if (index >= MAX_ITEMS || m_sparse[index] != -1) {
+        template <typename... Args>
+        bool Emplace(size_t index, Args &&...args) {
+            if (index >= m_max_items || m_size >= m_max_items || HasElement(index)) {
                 return false;
             }
 
-            // Maps value to end of m_dense array
-            m_dense[m_size] = value;
-
-            // Maps this value's m_dense array index (m_size) to the m_sparse array index (value)
-            m_sparse[index] = static_cast<int>(m_size);
-
-            // Store reverse mapping
-            m_dense_to_sparse[m_size] = index;
-
-            // Update m_dense array size
-            m_size++;
+            PushBack(index, std::forward<Args>(args)...);
 
             return true;
         }
 
         /**
-         * @brief Inserts an element into the set
+         * @brief Inserts a value initialized element into the set
          *
          * @param index Index to insert at
          */
-        bool InsertEmpty(size_t index) override {
-            if (index >= MAX_ITEMS || m_size >= MAX_ITEMS || m_sparse[index] != -1) {
-                return false;
+        bool InsertEmpty(size_t index) override { return Emplace(index); }
+
+        size_t InsertCopies(size_t source_index, std::span<const size_t> indices) override {
+            if (!HasElement(source_index)) {
+                return 0;
             }
 
-            // Maps this typed value's m_dense array index (m_size) to the m_sparse array index (value)
-            m_sparse[index] = static_cast<int>(m_size);
+            Reserve(m_size + indices.size());
 
-            // Store reverse mapping
-            m_dense_to_sparse[m_size] = index;
+            // Dense pages never move and inserting doesn't reorder the dense array, so the source stays put
+            return PushCopies(GetDenseElement(static_cast<size_t>(GetDenseIndex(source_index))), indices);
+        }
 
-            // Set value to default
-            m_dense[m_size++] = T{};
+        size_t InsertCopies(const IComponent &source, std::span<const size_t> indices) override {
+            if (typeid(source) != typeid(T)) {
+                return 0;
+            }
 
-            return true;
+            Reserve(m_size + indices.size());
+            return PushCopies(static_cast<const T &>(source), indices);
         }
 
         /**
@@ -191,40 +411,55 @@ namespace HBE::Core {
          * @return false Element does not exist
          */
         bool HasElement(size_t index) const override {
-            if (index >= MAX_ITEMS) {
+            if (index >= m_max_items) {
                 return false;
             }
 
-            return m_sparse[index] != -1;
+            return GetDenseIndex(index) != -1;
         }
 
-        /**
-         * @brief Get the Element object
-         * @todo Find a way to do this without static_cast to Component
-         * @param index Index of the element
-         * @return std::any Element from the set
-         */
-        std::any GetElementPtrAsAny(size_t index) override {
-            static_assert(std::is_base_of_v<IComponent, T>, "T must inherit from IComponent for this function.");
-            if (index >= MAX_ITEMS || m_sparse[index] == -1) {
-                return std::any();
+        // Type-erased access is used for reading (serializing, listeners), so it doesn't stamp the element as changed
+        IComponent *GetComponent(size_t index) override {
+            return HasElement(index) ? &GetDenseElement(GetDenseIndex(index)) : nullptr;
+        }
+
+        const IComponent *GetComponent(size_t index) const override { return GetElement(index); }
+
+        void SetTickSource(const Tick *tick_source) override { m_tick_source = tick_source; }
+
+        void MarkChanged(size_t index) override {
+            if (HasElement(index)) {
+                m_ticks[GetDenseIndex(index)].changed = GetCurrentTick();
             }
+        }
 
-            return static_cast<IComponent *>(&m_dense[m_sparse[index]]);
+        const ComponentTicks *GetTicks(size_t index) const override {
+            return HasElement(index) ? &m_ticks[GetDenseIndex(index)] : nullptr;
         }
 
         /**
-         * @brief Get the Element object safely with nullptr on failure
+         * @brief Get the tick new and changed elements are stamped with right now
+         * @return The tick source's value, or 0 without one
+         */
+        Tick GetCurrentTick() const { return m_tick_source ? *m_tick_source : 0; }
+
+        const ComponentOps &GetComponentOps() const override { return COMPONENT_OPS<T>; }
+
+        /**
+         * @brief Get the Element object safely with nullptr on failure, stamps the element as changed
          *
          * @param index Index of the element
          * @return T* Pointer to element, or nullptr if not found
          */
         T *GetElement(size_t index) {
-            if (index >= MAX_ITEMS || m_sparse[index] == -1) {
+            if (!HasElement(index)) {
                 return nullptr;
             }
 
-            return &m_dense[m_sparse[index]];
+            int dense_index = GetDenseIndex(index);
+            m_ticks[dense_index].changed = GetCurrentTick();
+
+            return &GetDenseElement(dense_index);
         }
 
         /**
@@ -234,25 +469,28 @@ namespace HBE::Core {
          * @return const T* Const pointer to element, or nullptr if not found
          */
         const T *GetElement(size_t index) const {
-            if (index >= MAX_ITEMS || m_sparse[index] == -1) {
+            if (!HasElement(index)) {
                 return nullptr;
             }
 
-            return &m_dense[m_sparse[index]];
+            return &GetDenseElement(GetDenseIndex(index));
         }
 
         /**
-         * @brief Get the Element object (assumes caller validated existence)
+         * @brief Get the Element object (assumes caller validated existence), stamps the element as changed
          * Must validate existence with HasElement() before calling this function for safety.
          *
          * @param index Index of the element
          * @return T& Reference to element
          */
         T &GetElementAsRef(size_t index) {
-            assert(index < MAX_ITEMS && "Index out of range.");
-            assert(m_sparse[index] != -1 && "Element does not exist.");
+            assert(index < m_max_items && "Index out of range.");
+            assert(GetDenseIndex(index) != -1 && "Element does not exist.");
+
+            int dense_index = GetDenseIndex(index);
+            m_ticks[dense_index].changed = GetCurrentTick();
 
-            return m_dense[m_sparse[index]];
+            return GetDenseElement(dense_index);
         }
 
         /**
@@ -263,10 +501,63 @@ namespace HBE::Core {
          * @return T& Reference to element
          */
         const T &GetElementAsRef(size_t index) const {
-            assert(index < MAX_ITEMS && "Index out of range.");
-            assert(m_sparse[index] != -1 && "Element does not exist.");
+            assert(index < m_max_items && "Index out of range.");
+            assert(GetDenseIndex(index) != -1 && "Element does not exist.");
+
+            return GetDenseElement(GetDenseIndex(index));
+        }
+
+        int GetDenseIndex(size_t index) const override {
+            size_t page = index / SPARSE_PAGE_SIZE;
+            if (page >= m_sparse_pages.size() || !m_sparse_pages[page]) {
+                return -1;
+            }
+
+            return (*m_sparse_pages[page])[index % SPARSE_PAGE_SIZE];
+        }
+
+        /**
+         * @brief Get the element at a dense position, for walking several sets in lockstep
+         * Doesn't check the position or stamp the element as changed, see MarkDenseChanged().
+         *
+         * @param dense_index Dense position below Size()
+         * @return T& Reference to the element
+         */
+        T &GetDenseElement(size_t dense_index) { return DenseElementAt(m_dense_pages.data(), dense_index); }
+
+        const T &GetDenseElement(size_t dense_index) const { return DenseElementAt(m_dense_pages.data(), dense_index); }
+
+        /**
+         * @brief Stamps every element in a range of dense positions as changed
+         *
+         * @param begin First dense position
+         * @param end One past the last dense position, at most Size()
+         */
+        void MarkDenseChanged(size_t begin, size_t end) {
+            const Tick tick = GetCurrentTick();
+            for (size_t dense_index = begin; dense_index < end; dense_index++) {
+                m_ticks[dense_index].changed = tick;
+            }
+        }
+
+        void SwapDense(size_t dense_a, size_t dense_b) override {
+            if (dense_a == dense_b) {
+                return;
+            }
+
+            // Swap through move construction so T doesn't need to be move assignable
+            if constexpr (!IS_TAG) {
+                T temp(std::move(GetDenseElement(dense_a)));
+                std::destroy_at(&GetDenseElement(dense_a));
+                std::construct_at(GetDenseSlot(dense_a), std::move(GetDenseElement(dense_b)));
+                std::destroy_at(&GetDenseElement(dense_b));
+                std::construct_at(GetDenseSlot(dense_b), std::move(temp));
+            }
 
-            return m_dense[m_sparse[index]];
+            std::swap(m_ticks[dense_a], m_ticks[dense_b]);
+            std::swap(m_dense_to_sparse[dense_a], m_dense_to_sparse[dense_b]);
+            GetSparseEntry(m_dense_to_sparse[dense_a]) = static_cast<int>(dense_a);
+            GetSparseEntry(m_dense_to_sparse[dense_b]) = static_cast<int>(dense_b);
         }
 
         /**
@@ -275,45 +566,213 @@ namespace HBE::Core {
          * @param index The index of the element to remove.
          */
         bool Remove(size_t index) override {
-            if (index >= MAX_ITEMS || m_sparse[index] == -1 || m_size == 0) {
+            if (!HasElement(index) || m_size == 0) {
                 return false;
             }
 
             // Get the dense index of the element to remove
-            int dense_index = m_sparse[index];
+            int dense_index = GetDenseIndex(index);
 
-            // If this isn't the last element, swap it with the last element
+            // If this isn't the last element, move the last element into its slot
             if (static_cast<size_t>(dense_index) != m_size - 1) {
                 // Get the sparse index of the last element using reverse mapping (O(1))
                 size_t last_sparse_index = m_dense_to_sparse[m_size - 1];
 
-                // Move the last element to the removed element's position
-                m_dense[dense_index] = m_dense[m_size - 1];
+                // Destroy the removed element and move construct the last element in its place
+                if constexpr (!IS_TAG) {
+                    std::destroy_at(&GetDenseElement(dense_index));
+                    std::construct_at(GetDenseSlot(dense_index), std::move(GetDenseElement(m_size - 1)));
+                }
 
                 // Update the sparse mapping for the moved element
-                m_sparse[last_sparse_index] = dense_index;
+                GetSparseEntry(last_sparse_index) = dense_index;
 
                 // Update the reverse mapping
                 m_dense_to_sparse[dense_index] = last_sparse_index;
+                m_ticks[dense_index] = m_ticks[m_size - 1];
             }
 
             // Clear the removed element's sparse entry
-            m_sparse[index] = -1;
+            GetSparseEntry(index) = -1;
+            m_sparse_page_counts[index / SPARSE_PAGE_SIZE]--;
 
-            // Clear the last dense element and decrease size
-            m_dense[m_size - 1] = T{};
+            // Destroy the last dense element, it was either removed or moved from, and decrease size
+            if constexpr (!IS_TAG) {
+                std::destroy_at(&GetDenseElement(m_size - 1));
+            }
+            m_dense_to_sparse.pop_back();
+            m_ticks.pop_back();
             m_size--;
 
             return true;
         }
 
+        void Reserve(size_t capacity) override {
+            capacity = std::min(capacity, m_max_items);
+
+            // Pages are raw storage, so reserving never constructs elements
+            size_t pages_needed = IS_TAG ? 0 : (capacity + DENSE_PAGE_SIZE - 1) / DENSE_PAGE_SIZE;
+            while (m_dense_pages.size() < pages_needed) {
+                m_dense_pages.push_back(AllocateDensePage());
+            }
+
+            m_dense_to_sparse.reserve(capacity);
+            m_ticks.reserve(capacity);
+        }
+
+        void Clear() override {
+            if constexpr (!IS_TAG) {
+                for (size_t dense_index = 0; dense_index < m_size; dense_index++) {
+                    std::destroy_at(&GetDenseElement(dense_index));
+                }
+            }
+
+            // Only reset the sparse entries that were in use, the rest are already -1
+            for (size_t sparse_index : m_dense_to_sparse) {
+                (*m_sparse_pages[sparse_index / SPARSE_PAGE_SIZE])[sparse_index % SPARSE_PAGE_SIZE] = -1;
+            }
+
+            std::fill(m_sparse_page_counts.begin(), m_sparse_page_counts.end(), 0);
+            m_dense_to_sparse.clear();
+            m_ticks.clear();
+            m_size = 0;
+        }
+
+        void ShrinkToFit() override {
+            for (size_t page = 0; page < m_sparse_pages.size(); page++) {
+                if (m_sparse_page_counts[page] == 0) {
+                    m_sparse_pages[page] = nullptr;
+                }
+            }
+
+            // Trailing empty pages don't need a slot either
+            while (!m_sparse_pages.empty() && !m_sparse_pages.back()) {
+                m_sparse_pages.pop_back();
+                m_sparse_page_counts.pop_back();
+            }
+            m_sparse_pages.shrink_to_fit();
+            m_sparse_page_counts.shrink_to_fit();
+
+            const size_t pages_in_use = (m_size + DENSE_PAGE_SIZE - 1) / DENSE_PAGE_SIZE;
+            if (m_dense_pages.size() > pages_in_use) {
+                m_dense_pages.resize(pages_in_use);
+            }
+            m_dense_pages.shrink_to_fit();
+
+            m_dense_to_sparse.shrink_to_fit();
+            m_ticks.shrink_to_fit();
+        }
+
+        size_t Capacity() const override { return IS_TAG ? m_max_items : m_dense_pages.size() * DENSE_PAGE_SIZE; }
+
         /**
          * Returns the number of elements in the set.
          * @return The number of elements in the set.
          */
         size_t Size() const override { return m_size; }
 
-        // Forward iterator for range-based loops
+        /**
+         * @brief Get the indices stored in the set in dense order
+         * The pointer is invalidated when an element is inserted or removed.
+         *
+         * @return Pointer to Size() indices, the element at dense position i belongs to the index at position i
+         */
+        const size_t *GetIndices() const override { return m_dense_to_sparse.data(); }
+
+        std::unique_ptr<ISparseSet> Clone() const override { return std::make_unique<SparseSet>(*this); }
+
+        void MarkAllAdded() override {
+            const Tick tick = GetCurrentTick();
+            std::fill(m_ticks.begin(), m_ticks.end(), ComponentTicks{tick, tick});
+        }
+
+        /**
+         * @brief Get the ticks of every element in dense order
+         * The pointer is invalidated when an element is inserted or removed.
+         *
+         * @return Pointer to Size() ticks, in the same order as GetIndices()
+         */
+        const ComponentTicks *GetDenseTicks() const { return m_ticks.data(); }
+
+        /**
+         * @brief Calls func for every element, split into chunks that run on the executor's worker threads
+         *
+         * Returns once every element has been visited. Every element is stamped as changed. See parallel.hpp for what
+         * func may and may not do.
+         *
+         * @tparam Executor Worker pool providing GetWorkerCount() and ParallelFor(begin, end, func, grain_size)
+         * @tparam Func void(T &) or void(size_t index, T &)
+         * @param executor Worker pool to run chunks on, the calling thread helps as well
+         * @param func Work to run for each element
+         */
+        template <typename Executor, typename Func>
+        void ParallelForEach(Executor &executor, Func &&func) {
+            const size_t chunk_size = ParallelChunkSize(m_size, sizeof(T), executor.GetWorkerCount() + 1);
+            const Tick tick = GetCurrentTick();
+
+            executor.ParallelFor(
+                0, m_size,
+                [this, &func, tick](size_t chunk_begin, size_t chunk_end) {
+                    for (size_t dense_index = chunk_begin; dense_index < chunk_end; dense_index++) {
+                        m_ticks[dense_index].changed = tick;
+                    }
+
+                    if constexpr (IS_TAG) {
+                        for (size_t dense_index = chunk_begin; dense_index < chunk_end; dense_index++) {
+                            if constexpr (std::is_invocable_v<Func &, size_t, T &>) {
+                                func(m_dense_to_sparse[dense_index], TagInstance());
+                            }
+                            else {
+                                func(TagInstance());
+                            }
+                        }
+                        return;
+                    }
+
+                    // Walk page by page so the inner loop is a plain contiguous array
+                    for (size_t dense_index = chunk_begin; dense_index < chunk_end;) {
+                        DensePage &page = *m_dense_pages[dense_index / DENSE_PAGE_SIZE];
+                        const size_t page_end =
+                            std::min(chunk_end, (dense_index / DENSE_PAGE_SIZE + 1) * DENSE_PAGE_SIZE);
+
+                        for (; dense_index < page_end; dense_index++) {
+                            T &element = page[dense_index % DENSE_PAGE_SIZE];
+                            if constexpr (std::is_invocable_v<Func &, size_t, T &>) {
+                                func(m_dense_to_sparse[dense_index], element);
+                            }
+                            else {
+                                func(element);
+                            }
+                        }
+                    }
+                },
+                chunk_size);
+        }
+
+        /**
+         * @brief Get the current limit on the index range
+         * @return Indices must be below this value
+         */
+        size_t GetMaxItems() const override { return m_max_items; }
+
+        /**
+         * @brief Change the limit on the index range
+         *
+         * @param max_items New limit, indices must be below this value
+         * @return False if an existing element's index is at or above the new limit
+         */
+        bool SetMaxItems(size_t max_items) override {
+            for (size_t sparse_index : m_dense_to_sparse) {
+                if (sparse_index >= max_items) {
+                    return false;
+                }
+            }
+
+            m_max_items = max_items;
+            return true;
+        }
+
+        // Forward iterator for range-based loops, stamps each element it hands out as changed
         class Iterator {
         public:
             using value_type = T;
@@ -322,26 +781,33 @@ namespace HBE::Core {
             using reference = T &;
             using iterator_category = std::forward_iterator_tag;
 
-            Iterator(T *ptr) : ptr(ptr) {}
+            Iterator(const std::unique_ptr<DensePage> *pages, ComponentTicks *ticks, Tick tick, size_t index)
+                : pages(pages), ticks(ticks), tick(tick), index(index) {}
 
             Iterator &operator++() {
-                ++ptr;
+                ++index;
                 return *this;
             }
             Iterator operator++(int) {
                 Iterator tmp = *this;
-                ++ptr;
+                ++index;
                 return tmp;
             }
 
-            bool operator==(const Iterator &other) const { return ptr == other.ptr; }
-            bool operator!=(const Iterator &other) const { return ptr != other.ptr; }
+            bool operator==(const Iterator &other) const { return index == other.index; }
+            bool operator!=(const Iterator &other) const { return index != other.index; }
 
-            T &operator*() const { return *ptr; }
-            T *operator->() const { return ptr; }
+            T &operator*() const {
+                ticks[index].changed = tick;
+                return DenseElementAt(pages, index);
+            }
+            T *operator->() const { return &**this; }
 
         private:
-            T *ptr;
+            const std::unique_ptr<DensePage> *pages;
+            ComponentTicks *ticks;
+            Tick tick;
+            size_t index;
         };
 
         // Const iterator for range-based loops
@@ -353,35 +819,150 @@ namespace HBE::Core {
             using reference = const T &;
             using iterator_category = std::forward_iterator_tag;
 
-            ConstIterator(const T *ptr) : ptr(ptr) {}
+            ConstIterator(const std::unique_ptr<DensePage> *pages, size_t index) : pages(pages), index(index) {}
 
             ConstIterator &operator++() {
-                ++ptr;
+                ++index;
                 return *this;
             }
             ConstIterator operator++(int) {
                 ConstIterator tmp = *this;
-                ++ptr;
+                ++index;
                 return tmp;
             }
 
-            bool operator==(const ConstIterator &other) const { return ptr == other.ptr; }
-            bool operator!=(const ConstIterator &other) const { return ptr != other.ptr; }
+            bool operator==(const ConstIterator &other) const { return index == other.index; }
+            bool operator!=(const ConstIterator &other) const { return index != other.index; }
 
-            const T &operator*() const { return *ptr; }
-            const T *operator->() const { return ptr; }
+            const T &operator*() const { return DenseElementAt(pages, index); }
+            const T *operator->() const { return &**this; }
 
         private:
-            const T *ptr;
+            const std::unique_ptr<DensePage> *pages;
+            size_t index;
         };
 
-        Iterator begin() { return Iterator(m_dense.data()); }
-        Iterator end() { return Iterator(m_dense.data() + m_size); }
+        Iterator begin() { return Iterator(m_dense_pages.data(), m_ticks.data(), GetCurrentTick(), 0); }
+        Iterator end() { return Iterator(m_dense_pages.data(), m_ticks.data(), GetCurrentTick(), m_size); }
+
+        ConstIterator begin() const { return ConstIterator(m_dense_pages.data(), 0); }
+        ConstIterator end() const { return ConstIterator(m_dense_pages.data(), m_size); }
 
-        ConstIterator begin() const { return ConstIterator(m_dense.data()); }
-        ConstIterator end() const { return ConstIterator(m_dense.data() + m_size); }
+        ConstIterator cbegin() const { return ConstIterator(m_dense_pages.data(), 0); }
+        ConstIterator cend() const { return ConstIterator(m_dense_pages.data(), m_size); }
+
+    private:
+        /**
+         * @brief Get the sparse entry for an index, allocating its page if needed
+         *
+         * @param index Sparse index
+         * @return int& Reference to the dense index stored for the sparse index
+         */
+        int &GetSparseEntry(size_t index) {
+            size_t page = index / SPARSE_PAGE_SIZE;
+            if (page >= m_sparse_pages.size()) {
+                m_sparse_pages.resize(page + 1);
+                m_sparse_page_counts.resize(page + 1, 0);
+            }
+
+            if (!m_sparse_pages[page]) {
+                m_sparse_pages[page] = std::make_unique<SparsePage>();
+                m_sparse_pages[page]->fill(-1);
+            }
+
+            return (*m_sparse_pages[page])[index % SPARSE_PAGE_SIZE];
+        }
+
+        // The one instance every element of a tag set refers to, tags have no data so sharing it is safe
+        static T &TagInstance() {
+            static T instance;
+            return instance;
+        }
+
+        static T &DenseElementAt(const std::unique_ptr<DensePage> *pages, size_t dense_index) {
+            if constexpr (IS_TAG) {
+                return TagInstance();
+            }
+            else {
+                return (*pages[dense_index / DENSE_PAGE_SIZE])[dense_index % DENSE_PAGE_SIZE];
+            }
+        }
+
+        // Uninitialized memory for the element at a dense index, must not hold a constructed element
+        T *GetDenseSlot(size_t dense_index) {
+            return m_dense_pages[dense_index / DENSE_PAGE_SIZE]->Slot(dense_index % DENSE_PAGE_SIZE);
+        }
+
+        static std::unique_ptr<DensePage> AllocateDensePage() { return std::make_unique_for_overwrite<DensePage>(); }
+
+        /**
+         * @brief Constructs an element in the next dense slot and maps a sparse index to it
+         *
+         * @param index Sparse index that will own the slot
+         * @param args Arguments passed to T's constructor
+         * @return T& Reference to the new element
+         */
+        template <typename... Args>
+        T &PushBack(size_t index, Args &&...args) {
+            T *element = nullptr;
+            if constexpr (IS_TAG) {
+                element = &TagInstance();
+            }
+            else {
+                // Allocate a new dense page once the current ones are full
+                if (m_size == m_dense_pages.size() * DENSE_PAGE_SIZE) {
+                    m_dense_pages.push_back(AllocateDensePage());
+                }
+
+                // Construct first, so a constructor that throws leaves the set unchanged
+                element = std::construct_at(GetDenseSlot(m_size), std::forward<Args>(args)...);
+            }
+
+            // Maps this value's dense array index (m_size) to the sparse array index
+            GetSparseEntry(index) = static_cast<int>(m_size);
+            m_sparse_page_counts[index / SPARSE_PAGE_SIZE]++;
+
+            // Store reverse mapping
+            m_dense_to_sparse.push_back(index);
+
+            // New elements count as added and changed
+            const Tick tick = GetCurrentTick();
+            m_ticks.push_back({tick, tick});
+
+            // Update dense array size
+            m_size++;
+            return *element;
+        }
+
+        /**
+         * @brief Copies one component to every free index in a batch, call Reserve() first
+         *
+         * @param source Component to copy, tags and types that can't be copied get default constructed elements
+         * @param indices Indices to insert the copies at, indices that are taken or out of range are skipped
+         * @return Number of copies inserted
+         */
+        size_t PushCopies(const T &source, std::span<const size_t> indices) {
+            size_t inserted = 0;
+
+            for (size_t index : indices) {
+                if (index >= m_max_items || m_size >= m_max_items || HasElement(index)) {
+                    continue;
+                }
+
+                if constexpr (IS_TAG || !IS_COMPONENT_COPYABLE<T>) {
+                    PushBack(index);
+                }
+                else if constexpr (HasCloneHook<T>) {
+                    PushBack(index, source.Clone());
+                }
+                else {
+                    PushBack(index, source);
+                }
+                inserted++;
+            }
+
+            return inserted;
+        }
 
-        ConstIterator cbegin() const { return ConstIterator(m_dense.data()); }
-        ConstIterator cend() const { return ConstIterator(m_dense.data() + m_size); }
     };
 } // namespace HBE::Core
\ No newline at end of file
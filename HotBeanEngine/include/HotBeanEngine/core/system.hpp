@@ -10,26 +10,110 @@
 
 #pragma once
 
-#include <set>
+#include <array>
+#include <cassert>
+#include <string_view>
 #include <tuple>
+#include <type_traits>
+#include <vector>
 
+#include <HotBeanEngine/core/change_tick.hpp>
 #include <HotBeanEngine/core/component.hpp>
 #include <HotBeanEngine/core/entity.hpp>
+#include <HotBeanEngine/core/entity_set.hpp>
 #include <HotBeanEngine/core/igame_loop.hpp>
 #include <HotBeanEngine/core/iname.hpp>
 
+namespace HBE::Application::Managers {
+    class ECSManager;
+}
+
 namespace HBE::Core {
+    /**
+     * @brief Components a system reads and writes while it runs.
+     * The system scheduler uses this to decide which systems can run at the same time.
+     */
+    struct SystemAccess {
+        std::vector<std::string_view> reads;
+        std::vector<std::string_view> writes;
+
+        // Exclusive systems run on the main thread with no other system running. This is the default because most
+        // systems also use SDL, Box2D, events or other shared engine state.
+        bool exclusive = true;
+
+        /**
+         * @brief Checks if two systems can't run at the same time
+         * @param other Access of the other system
+         * @return True if either system is exclusive or one writes a component the other uses
+         */
+        bool ConflictsWith(const SystemAccess &other) const {
+            if (exclusive || other.exclusive) {
+                return true;
+            }
+
+            auto overlaps = [](const std::vector<std::string_view> &a, const std::vector<std::string_view> &b) {
+                for (std::string_view name : a) {
+                    for (std::string_view other_name : b) {
+                        if (name == other_name) {
+                            return true;
+                        }
+                    }
+                }
+                return false;
+            };
+
+            return overlaps(writes, other.writes) || overlaps(writes, other.reads) || overlaps(reads, other.writes);
+        }
+    };
+
     /**
      * @brief Base class for systems that process entities with specific components.
      * Systems operate on entities matching their signature.
      * Handles game logic updates and event processing.
      */
     struct SystemBase : public IGameLoop, public IName {
-        std::set<EntityID> m_entities;
+        // Entities matching the system's signature, packed for linear iteration
+        EntitySet m_entities;
 
         virtual ~SystemBase() = default;
 
+        /**
+         * @brief ECSManager the system is registered in
+         * Systems should reach entities and components through this rather than g_ecs, so the same system can run in
+         * any number of worlds. Set by ECSManager::RegisterSystem(), so it can't be used in the constructor.
+         * @return World that runs this system
+         */
+        Application::Managers::ECSManager &GetWorld() const {
+            assert(m_world && "System isn't registered in an ECSManager");
+            return *m_world;
+        }
+
+        /**
+         * @brief Tick the running game loop method last ran at, 0 the first time
+         * Pass it to View::Changed() or View::Added() to only visit components changed since then. Each game loop
+         * method keeps its own tick, inside OnRender() this is when OnRender() last ran.
+         * @return Tick the previous call of the running game loop method started at
+         */
+        Tick GetLastRunTick() const { return m_last_run_tick; }
+
+        /**
+         * @brief Called by the system manager right before it runs a game loop method
+         * @param state Game loop method about to run
+         * @param tick Current change tick
+         */
+        void BeginRun(GameLoopState state, Tick tick) {
+            Tick &state_tick = m_state_run_ticks[static_cast<size_t>(state)];
+            m_last_run_tick = state_tick;
+            state_tick = tick;
+        }
+
         virtual std::string_view GetName() const = 0;
+
+        /**
+         * @brief Components this system reads and writes
+         * @return SystemAccess Exclusive unless the system overrides this
+         */
+        virtual SystemAccess GetComponentAccess() const { return SystemAccess{}; }
         virtual void OnEntityRemoved(EntityID entity) {};
         virtual void OnEntityAdded(EntityID entity) {};
 
@@ -42,16 +126,50 @@ namespace HBE::Core {
         virtual void OnUpdate() {};
         virtual void OnRender() {};
         virtual void OnPostRender() {};
+
+    private:
+        friend class Application::Managers::ECSManager;
+
+        // World that registered this system
+        Application::Managers::ECSManager *m_world = nullptr;
+
+        // Tick each game loop method last started at, indexed by GameLoopState
+        std::array<Tick, static_cast<size_t>(GameLoopState::OnPostRender) + 1> m_state_run_ticks = {};
+
+        // Previous tick of the game loop method that is running now
+        Tick m_last_run_tick = 0;
     };
 
+    /**
+     * @brief Helper class that automatically sets the signature from its template params.
+     *
+     * A const component is only read by the system, others are also written. GameSystems are exclusive unless
+     * RunsInParallel() is overridden to return true, in which case the system may run on a worker thread at the same
+     * time as systems whose components don't conflict with its own.
+     * @tparam Components Components an entity needs for this system
+     */
     template <typename... Components>
     struct GameSystem : public SystemBase {
-        // GameSystem is a helper class that automatically sets signature from template params
         virtual std::vector<std::string_view> GetRequiredComponents() const final {
             std::vector<std::string_view> required_components;
-            (..., required_components.push_back(Components::StaticGetName()));
+            (..., required_components.push_back(std::remove_const_t<Components>::StaticGetName()));
 
             return required_components;
         }
+
+        /**
+         * @brief Whether the system only touches its declared components and thread safe engine state
+         * @return False by default
+         */
+        virtual bool RunsInParallel() const { return false; }
+
+        SystemAccess GetComponentAccess() const override {
+            SystemAccess access;
+            access.exclusive = !RunsInParallel();
+            (..., (std::is_const_v<Components> ? access.reads : access.writes)
+                      .push_back(std::remove_const_t<Components>::StaticGetName()));
+
+            return access;
+        }
     };
 } // namespace HBE::Core
\ No newline at end of file
@@ -0,0 +1,334 @@
+/**
+ * @file view.hpp
+ * @author Daniel Parker (DParker13)
+ * @brief Iterates entities that have a set of components.
+ *
+ * @details A view walks the dense array of the smallest component sparse set it was built from and checks the other
+ * sets for each entity. Matching entities are handed out together with references to their components, so there is
+ * no intermediate container and no lookup by component name.
+ *
+ * Changed() and Added() narrow a view down to entities whose component was changed or added after a given tick. A
+ * filtered view walks the filtered component's ticks, which sit in one contiguous array, so a view over components
+ * that haven't changed costs one comparison per entity.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <HotBeanEngine/core/change_tick.hpp>
+#include <HotBeanEngine/core/config.hpp>
+#include <HotBeanEngine/core/entity.hpp>
+#include <HotBeanEngine/core/parallel.hpp>
+#include <HotBeanEngine/core/sparse_set.hpp>
+
+namespace HBE::Core {
+    /**
+     * @brief Sparse set type used to store component C in a view.
+     * A const component is read from a const sparse set.
+     */
+    template <typename C>
+    using ViewSet = std::conditional_t<std::is_const_v<C>, const SparseSet<std::remove_const_t<C>, MAX_ENTITIES>,
+                                       SparseSet<std::remove_const_t<C>, MAX_ENTITIES>>;
+
+    /**
+     * @brief Iterates all entities that have every component in Components.
+     *
+     * Use Each() for the tightest loop, or a range-based for loop with structured bindings:
+     * @code
+     * for (auto [entity, transform, texture] : g_ecs.View<Transform2D, Texture>()) { ... }
+     * @endcode
+     *
+     * Components marked const are handed out as const references. Non-const components are stamped as changed when
+     * they are handed out, so view components as const unless the loop writes to them.
+     *
+     * Only visit entities whose Shape changed since the system last ran:
+     * @code
+     * g_ecs.View<const Shape, Texture>().Changed<Shape>(GetLastRunTick()).Each(...);
+     * @endcode
+     *
+     * @warning Adding or removing any of the viewed components while iterating invalidates the view.
+     * @tparam Components Component types an entity must have
+     */
+    template <typename... Components>
+    class View {
+        static_assert(sizeof...(Components) > 0, "A view needs at least one component type");
+
+    private:
+        static constexpr size_t NO_SET = std::numeric_limits<size_t>::max();
+        static constexpr size_t COMPONENT_COUNT = sizeof...(Components);
+
+        // Since tick of a component that isn't filtered
+        static constexpr Tick NO_FILTER = std::numeric_limits<Tick>::max();
+
+        // Sparse sets for each component, in the same order as Components
+        std::tuple<ViewSet<Components> *...> m_sets;
+
+        // Index into m_sets of the set iteration is driven from, NO_SET if a component isn't registered
+        // The smallest set, or the smallest filtered set once a filter is added
+        size_t m_driver = NO_SET;
+
+        // Dense index to entity mapping and ticks of the driving set
+        const size_t *m_driver_entities = nullptr;
+        const ComponentTicks *m_driver_ticks = nullptr;
+        size_t m_driver_size = 0;
+
+        // Per component Changed() and Added() filters, NO_FILTER where a component isn't filtered
+        std::array<Tick, COMPONENT_COUNT> m_changed_since;
+        std::array<Tick, COMPONENT_COUNT> m_added_since;
+        bool m_filtered = false;
+
+    public:
+        /**
+         * @brief Builds a view from the sparse sets of each component
+         * @param sets Sparse sets in the same order as Components, nullptr if a component isn't registered
+         */
+        explicit View(ViewSet<Components> *...sets) : m_sets(sets...) {
+            m_changed_since.fill(NO_FILTER);
+            m_added_since.fill(NO_FILTER);
+            SelectDriver(std::index_sequence_for<Components...>{});
+        }
+
+        /**
+         * @brief Copy of the view that only yields entities whose C was changed after a tick
+         * Adding a component counts as changing it.
+         *
+         * @tparam C One of the viewed components
+         * @param since Tick to compare against, usually SystemBase::GetLastRunTick()
+         * @return View Filtered view
+         */
+        template <typename C>
+        View Changed(Tick since) const {
+            static_assert(IndexOf<C>() < COMPONENT_COUNT, "C must be one of the viewed components");
+
+            View filtered = *this;
+            filtered.m_changed_since[IndexOf<C>()] = since;
+            filtered.m_filtered = true;
+            filtered.SelectDriver(std::index_sequence_for<Components...>{});
+            return filtered;
+        }
+
+        /**
+         * @brief Copy of the view that only yields entities whose C was added after a tick
+         *
+         * @tparam C One of the viewed components
+         * @param since Tick to compare against, usually SystemBase::GetLastRunTick()
+         * @return View Filtered view
+         */
+        template <typename C>
+        View Added(Tick since) const {
+            static_assert(IndexOf<C>() < COMPONENT_COUNT, "C must be one of the viewed components");
+
+            View filtered = *this;
+            filtered.m_added_since[IndexOf<C>()] = since;
+            filtered.m_filtered = true;
+            filtered.SelectDriver(std::index_sequence_for<Components...>{});
+            return filtered;
+        }
+
+        class Iterator {
+        public:
+            using value_type = std::tuple<EntityID, Components &...>;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::forward_iterator_tag;
+
+            Iterator(const View *view, size_t position) : view(view), position(position) { SkipUnmatched(); }
+
+            Iterator &operator++() {
+                ++position;
+                SkipUnmatched();
+                return *this;
+            }
+            Iterator operator++(int) {
+                Iterator tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            bool operator==(const Iterator &other) const { return position == other.position; }
+            bool operator!=(const Iterator &other) const { return position != other.position; }
+
+            value_type operator*() const { return view->Get(static_cast<EntityID>(view->m_driver_entities[position])); }
+
+        private:
+            const View *view;
+            size_t position;
+
+            void SkipUnmatched() {
+                while (position < view->m_driver_size && !view->Matches(position)) {
+                    ++position;
+                }
+            }
+        };
+
+        Iterator begin() const { return Iterator(this, 0); }
+        Iterator end() const { return Iterator(this, m_driver_size); }
+
+        /**
+         * @brief Calls func for every matching entity
+         *
+         * @param func Callable taking (EntityID, Components &...)
+         */
+        template <typename Func>
+        void Each(Func &&func) const {
+            for (size_t position = 0; position < m_driver_size; position++) {
+                if (Matches(position)) {
+                    std::apply(func, Get(static_cast<EntityID>(m_driver_entities[position])));
+                }
+            }
+        }
+
+        /**
+         * @brief Calls func for every matching entity, split into chunks that run on the executor's worker threads
+         *
+         * The driving set's entities are split into chunks, so every call gets a different entity. Returns once every
+         * entity has been visited. See parallel.hpp for what func may and may not do.
+         *
+         * @tparam Executor Worker pool providing GetWorkerCount() and ParallelFor(begin, end, func, grain_size)
+         * @param executor Worker pool to run chunks on, the calling thread helps as well
+         * @param func Callable taking (EntityID, Components &...)
+         */
+        template <typename Executor, typename Func>
+        void ParallelForEach(Executor &executor, Func &&func) const {
+            constexpr size_t bytes_per_entity = sizeof(size_t) + (sizeof(std::remove_const_t<Components>) + ...);
+            const size_t chunk_size = ParallelChunkSize(m_driver_size, bytes_per_entity, executor.GetWorkerCount() + 1);
+
+            executor.ParallelFor(
+                0, m_driver_size,
+                [this, &func](size_t chunk_begin, size_t chunk_end) {
+                    for (size_t position = chunk_begin; position < chunk_end; position++) {
+                        if (Matches(position)) {
+                            std::apply(func, Get(static_cast<EntityID>(m_driver_entities[position])));
+                        }
+                    }
+                },
+                chunk_size);
+        }
+
+        /**
+         * @brief Checks if an entity has every viewed component and passes every filter
+         * @param entity Entity to check
+         */
+        bool Contains(EntityID entity) const {
+            if (m_driver == NO_SET) {
+                return false;
+            }
+
+            if (!m_filtered) {
+                return std::apply([entity](auto *...sets) { return (sets->HasElement(entity) && ...); }, m_sets);
+            }
+
+            return ContainsFiltered(entity, std::index_sequence_for<Components...>{});
+        }
+
+        /**
+         * @brief Get the components of an entity (assumes Contains(entity) is true)
+         * @param entity Entity to get the components of
+         * @return Tuple of the entity and references to each component
+         */
+        std::tuple<EntityID, Components &...> Get(EntityID entity) const {
+            return std::apply(
+                [entity](auto *...sets) {
+                    return std::tuple<EntityID, Components &...>(entity, sets->GetElementAsRef(entity)...);
+                },
+                m_sets);
+        }
+
+        /**
+         * @brief Upper bound on the number of matching entities
+         * @return Number of elements in the smallest sparse set
+         */
+        size_t SizeHint() const { return m_driver_size; }
+
+    private:
+        /**
+         * @brief Position of component C in Components
+         * @tparam C Viewed component, with or without const
+         */
+        template <typename C>
+        static constexpr size_t IndexOf() {
+            constexpr bool matches[] = {std::is_same_v<std::remove_const_t<Components>, std::remove_const_t<C>>...};
+            for (size_t i = 0; i < COMPONENT_COUNT; i++) {
+                if (matches[i]) {
+                    return i;
+                }
+            }
+
+            return COMPONENT_COUNT;
+        }
+
+        bool IsFiltered(size_t component_index) const {
+            return m_changed_since[component_index] != NO_FILTER || m_added_since[component_index] != NO_FILTER;
+        }
+
+        bool PassesFilter(size_t component_index, const ComponentTicks &ticks) const {
+            const Tick changed_since = m_changed_since[component_index];
+            const Tick added_since = m_added_since[component_index];
+
+            return (changed_since == NO_FILTER || ticks.IsChanged(changed_since)) &&
+                   (added_since == NO_FILTER || ticks.IsAdded(added_since));
+        }
+
+        /**
+         * @brief Checks the entity at a position of the driving set
+         * A filtered driver is checked against its contiguous ticks first, so unchanged entities are skipped without
+         * any sparse lookup.
+         * @param position Dense position in the driving set
+         */
+        bool Matches(size_t position) const {
+            if (m_filtered && !PassesFilter(m_driver, m_driver_ticks[position])) {
+                return false;
+            }
+
+            return Contains(static_cast<EntityID>(m_driver_entities[position]));
+        }
+
+        template <size_t... I>
+        bool ContainsFiltered(EntityID entity, std::index_sequence<I...>) const {
+            auto passes = [this, entity](size_t component_index, auto *set) {
+                const ComponentTicks *ticks = set->GetTicks(entity);
+                return ticks && PassesFilter(component_index, *ticks);
+            };
+
+            return (passes(I, std::get<I>(m_sets)) && ...);
+        }
+
+        template <size_t... I>
+        void SelectDriver(std::index_sequence<I...>) {
+            m_driver = NO_SET;
+            m_driver_entities = nullptr;
+            m_driver_ticks = nullptr;
+            m_driver_size = 0;
+
+            // An unregistered component means no entity can match
+            if (((std::get<I>(m_sets) == nullptr) || ...)) {
+                return;
+            }
+
+            // Drive iteration from the smallest set so the fewest entities are checked. Once filtered, only filtered
+            // sets are considered so unchanged entities are rejected by their ticks alone.
+            auto consider = [this](size_t set_index, auto *set) {
+                if (m_filtered && !IsFiltered(set_index)) {
+                    return;
+                }
+
+                if (m_driver == NO_SET || set->Size() < m_driver_size) {
+                    m_driver = set_index;
+                    m_driver_size = set->Size();
+                    m_driver_entities = set->GetIndices();
+                    m_driver_ticks = set->GetDenseTicks();
+                }
+            };
+            (consider(I, std::get<I>(m_sets)), ...);
+        }
+    };
+} // namespace HBE::Core
\ No newline at end of file
@@ -36,7 +36,7 @@ namespace HBE::Factories {
         void AddComponent(EntityID entity, Core::ISerializationReader &reader, const Args &...args) {
             static_assert(std::is_base_of_v<Core::IComponent, T> && "T must inherit from IComponent");
 
-            m_ecs_manager->AddComponent<T>(entity, T(args...));
+            m_ecs_manager->Emplace<T>(entity, args...);
             m_ecs_manager->GetComponent<T>(entity).Deserialize(reader);
         }
     };
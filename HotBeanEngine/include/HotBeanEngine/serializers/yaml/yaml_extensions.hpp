@@ -1,7 +1,7 @@
 /**
  * @file yaml_extensions.hpp
  * @author Daniel Parker (DParker13)
- * @brief YAML conversion extensions for glm vectors and SDL_Color.
+ * @brief YAML conversion extensions for glm vectors, SDL_Color and signatures.
  * @version 0.1
  * @date 2025-05-02
  *
@@ -20,6 +20,8 @@
 #include <glm/vec3.hpp>
 #include <yaml-cpp/yaml.h>
 
+#include <HotBeanEngine/core/signature.hpp>
+
 namespace YAML {
 
     // Vec2
@@ -140,6 +142,30 @@ namespace YAML {
             return true;
         }
     };
+
+    // Signature, written highest bit first so it loads at any width that fits its set bits
+    template <size_t BITS>
+    struct convert<HBE::Core::BasicSignature<BITS>> {
+        static Node encode(const HBE::Core::BasicSignature<BITS> &signature) {
+            Node node;
+            node = signature.to_string();
+            return node;
+        }
+
+        static bool decode(const Node &node, HBE::Core::BasicSignature<BITS> &signature) {
+            if (!node.IsScalar()) {
+                return false;
+            }
+
+            try {
+                signature = HBE::Core::BasicSignature<BITS>(node.Scalar());
+            }
+            catch (const std::exception &) {
+                return false;
+            }
+            return true;
+        }
+    };
 } // namespace YAML
 
 // Vec2
@@ -168,4 +194,11 @@ inline YAML::Emitter &operator<<(YAML::Emitter &out, const SDL_Color &color) {
     out << YAML::Flow;
     out << YAML::BeginSeq << (int)color.r << (int)color.g << (int)color.b << (int)color.a << YAML::EndSeq;
     return out;
+}
+
+// Signature
+template <size_t BITS>
+inline YAML::Emitter &operator<<(YAML::Emitter &out, const HBE::Core::BasicSignature<BITS> &signature) {
+    out << signature.to_string();
+    return out;
 }
\ No newline at end of file
@@ -0,0 +1,38 @@
+/**
+ * @file yaml_prefab_cooker.hpp
+ * @author Daniel Parker (DParker13)
+ * @brief Default prefab cooker. Cooks prefab assets written in the same YAML format as scene entities.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#pragma once
+
+#include <filesystem>
+
+#include <yaml-cpp/yaml.h>
+
+#include <HotBeanEngine/core/all_core.hpp>
+
+namespace HBE::Serializers {
+    /**
+     * @brief Cooks a YAML prefab asset, one root "Entity" map laid out like an entity in a scene file:
+     * @code
+     * Entity:
+     *   Transform2D: {...}
+     *   Entities:
+     *     - Entity: {...}
+     * @endcode
+     */
+    class YamlPrefabCooker : public Core::IPrefabCooker {
+    public:
+        DEFINE_NAME("YamlPrefabCooker");
+
+        Core::Prefab Cook(std::filesystem::path filepath) override;
+
+    private:
+        void CookEntity(const YAML::Node &node, Sint64 parent_node, Core::Prefab &prefab);
+    };
+} // namespace HBE::Serializers
\ No newline at end of file
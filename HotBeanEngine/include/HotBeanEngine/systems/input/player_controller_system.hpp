@@ -21,13 +21,16 @@ namespace HBE::Systems {
     /**
      * @brief System for player input to control entities.
      */
-    class PlayerControllerSystem : public Core::GameSystem<Transform2D, Controller> {
+    class PlayerControllerSystem : public Core::GameSystem<Transform2D, const Controller> {
     public:
         DEFINE_NAME("Player Controller System")
 
         PlayerControllerSystem() = default;
         ~PlayerControllerSystem() = default;
 
+        // Only reads input state and moves its own entities
+        bool RunsInParallel() const override { return true; }
+
         void OnUpdate() override;
         void Move(EntityID entity, float speed);
     };
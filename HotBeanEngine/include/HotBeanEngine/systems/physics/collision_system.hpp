@@ -23,13 +23,16 @@ namespace HBE::Systems {
     /**
      * @brief System for 2D collision detection.
      */
-    class CollisionSystem : public Core::GameSystem<Transform2D, RigidBody, Collider2D> {
+    class CollisionSystem : public Core::GameSystem<const Transform2D, const RigidBody, const Collider2D> {
     public:
         DEFINE_NAME("Collision System")
 
         CollisionSystem() = default;
         ~CollisionSystem() = default;
 
+        // Colliders are created when entities are added, which always happens on the main thread
+        bool RunsInParallel() const override { return true; }
+
         void OnUpdate() override;
         void OnEntityAdded(EntityID entity) override;
     };
@@ -30,7 +30,7 @@ namespace HBE::Systems {
      * Draws rectangles, circles, and lines to screen.
      * Processes entities with Transform2D and Shape components.
      */
-    class ShapeSystem : public Core::GameSystem<Transform2D, Texture, Shape> {
+    class ShapeSystem : public Core::GameSystem<const Transform2D, Texture, Shape> {
     public:
         DEFINE_NAME("Shape System")
 
@@ -42,6 +42,6 @@ namespace HBE::Systems {
 
     private:
         void CreateTextureForEntity(EntityID entity);
-        bool CompareTextureAndShape(Texture &texture, Shape &shape);
+        bool CompareTextureAndShape(const Texture &texture, const Shape &shape);
     };
 } // namespace HBE::Systems
\ No newline at end of file
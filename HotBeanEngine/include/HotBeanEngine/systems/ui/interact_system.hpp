@@ -26,7 +26,7 @@ namespace HBE::Systems {
      * @brief Manages UI elements (Interactive, Checkboxes, etc).
      * Renders element to their texture and handles user interaction.
      */
-    class InteractSystem : public Core::GameSystem<Transform2D, Texture, Interactive> {
+    class InteractSystem : public Core::GameSystem<const Transform2D, const Texture, Interactive> {
     public:
         DEFINE_NAME("Interact System")
 
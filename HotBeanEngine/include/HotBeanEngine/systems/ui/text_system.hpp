@@ -11,6 +11,7 @@
 #pragma once
 
 #include <unordered_set>
+#include <vector>
 
 #include <SDL3/SDL.h>
 #include <SDL3_ttf/SDL_ttf.h>
@@ -30,13 +31,16 @@ namespace HBE::Systems {
      * @brief Manages UI elements (Buttons, Checkboxes, etc).
      * Renders element to their texture and handles user interaction.
      */
-    class TextSystem : public Core::GameSystem<Transform2D, Texture, Text> {
+    class TextSystem : public Core::GameSystem<const Transform2D, Texture, Text> {
     public:
         DEFINE_NAME("Text System")
 
     private:
         const std::string m_font_path;
 
+        // Entities whose text failed to render, marked changed again on the next frame so they're retried
+        std::vector<EntityID> m_failed_entities;
+
     public:
         TTF_Font *m_font = nullptr; // TODO: Find a better way to manage font resources
 
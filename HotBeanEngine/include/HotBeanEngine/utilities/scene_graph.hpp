@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <set>
+
 #include <HotBeanEngine/core/all_core.hpp>
 
 namespace HBE::Utilities {
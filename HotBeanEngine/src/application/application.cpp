@@ -12,6 +12,7 @@
 #include <HotBeanEngine/application/application.hpp>
 #include <HotBeanEngine/editor/editor_gui.hpp>
 #include <HotBeanEngine/editor/noop_editor_gui.hpp>
+#include <HotBeanEngine/serializers/yaml/yaml_prefab_cooker.hpp>
 #include <HotBeanEngine/serializers/yaml/yaml_scene_serializer.hpp>
 
 namespace HBE::Application {
@@ -71,6 +72,9 @@ namespace HBE::Application {
         m_input_event_listener.reset();
         m_editor_gui.reset();
 
+        // Joined last so no job outlives the managers it uses
+        m_job_manager.reset();
+
         CleanUpSDL();
         s_instance = nullptr;
     }
@@ -103,7 +107,8 @@ namespace HBE::Application {
     }
 
     void Application::InitManagers() {
-        m_ecs_manager = std::make_shared<ECSManager>(m_logging_manager);
+        m_job_manager = std::make_shared<JobManager>();
+        m_ecs_manager = std::make_shared<ECSManager>(m_logging_manager, m_job_manager);
 
         // Setup component and system factories
         m_component_factory->SetECSManager(m_ecs_manager);
@@ -116,6 +121,8 @@ namespace HBE::Application {
         GetSerializationManager().RegisterSerializer(
             std::make_unique<Serializers::YamlSceneSerializer>(m_component_factory));
 
+        m_prefab_manager = std::make_shared<PrefabManager>(std::make_unique<Serializers::YamlPrefabCooker>());
+
         m_scene_manager = std::make_unique<SceneManager>();
         m_loop_manager = std::make_unique<ApplicationStateManager>();
         m_camera_manager = std::make_shared<CameraManager>();
@@ -166,7 +173,6 @@ namespace HBE::Application {
     }
 
     void Application::RegisterComponentListeners() {
-        GetECSManager().RegisterComponentListener(&GetRenderManager());
         GetECSManager().RegisterComponentListener(&GetTransformManager());
     }
 
@@ -221,8 +227,12 @@ namespace HBE::Application {
 
     EventManager &Application::GetEventManager() const { return *m_event_manager; }
 
+    JobManager &Application::GetJobManager() const { return *m_job_manager; }
+
     SerializationManager &Application::GetSerializationManager() const { return *m_serialization_manager; }
 
+    PrefabManager &Application::GetPrefabManager() const { return *m_prefab_manager; }
+
     LoggingManager &Application::GetLoggingManager() { return *m_logging_manager; }
 
     std::shared_ptr<IComponentFactory> Application::GetComponentFactory() const { return m_component_factory; }
@@ -259,13 +269,6 @@ namespace HBE::Application {
         while (!m_quit) {
             GetStateManager().UpdateGameLoopState();
 
-            if (GetStateManager().IsState(ApplicationState::Playing) && GetStateManager().ShouldReloadScene()) {
-                std::shared_ptr<IScene> current_scene = GetSceneManager().GetCurrentScene();
-                GetSceneManager().UnloadScene(false);
-                GetSceneManager().LoadScene(current_scene);
-                GetStateManager().ClearReloadFlag();
-            }
-
             UpdateDeltaTime();
             UpdateDeltaTimeHiRes();
 
@@ -442,6 +445,9 @@ namespace HBE::Application {
 
         GetRenderManager().OnPostRender();
 
+        // Apply entity and component changes recorded during the frame
+        GetECSManager().Flush();
+
         // Dispatch all queued events at the end of the frame
         GetEventManager().DispatchAll();
     }
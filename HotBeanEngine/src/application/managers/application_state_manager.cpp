@@ -15,8 +15,6 @@ namespace HBE::Application::Managers {
 
     void ApplicationStateManager::QueueStateChange(ApplicationState new_state) { m_queued_state = new_state; }
 
-    void ApplicationStateManager::ClearReloadFlag() { m_needs_scene_reload = false; }
-
     ApplicationState ApplicationStateManager::GetState() const { return m_state; }
 
     bool ApplicationStateManager::IsState(ApplicationState state) const { return m_state == state; }
@@ -25,9 +23,12 @@ namespace HBE::Application::Managers {
         ApplicationState previous_state = m_state;
         m_state = m_queued_state;
 
-        // Handle transitions to Playing state
+        // Playing always starts from, and stops back at, the world as it was when Play was pressed
         if (m_state == ApplicationState::Playing && previous_state == ApplicationState::Stopped) {
-            m_needs_scene_reload = true;
+            CapturePlaySnapshot();
+        }
+        else if (m_state == ApplicationState::Stopped && previous_state != ApplicationState::Stopped) {
+            RestorePlaySnapshot();
         }
 
         // Log state transition
@@ -43,6 +44,31 @@ namespace HBE::Application::Managers {
         }
     }
 
-    bool ApplicationStateManager::ShouldReloadScene() const { return m_needs_scene_reload; }
+    void ApplicationStateManager::CapturePlaySnapshot() {
+        m_play_snapshot = std::make_unique<WorldSnapshot>(g_ecs.CaptureSnapshot());
+        m_play_scene = g_app.GetSceneManager().GetCurrentScene();
+
+        LOG(LoggingType::INFO, "Captured world snapshot of " + std::to_string(m_play_snapshot->EntityCount()) +
+                                   " entities");
+    }
+
+    void ApplicationStateManager::RestorePlaySnapshot() {
+        std::unique_ptr<WorldSnapshot> snapshot = std::move(m_play_snapshot);
+        std::shared_ptr<IScene> scene = std::move(m_play_scene);
+
+        if (!snapshot) {
+            return;
+        }
+
+        // The snapshot belongs to the scene that was loaded when playing started
+        if (scene != g_app.GetSceneManager().GetCurrentScene()) {
+            LOG(LoggingType::WARNING, "Scene changed while playing, keeping the current world");
+            return;
+        }
+
+        g_ecs.RestoreSnapshot(*snapshot);
+
+        LOG(LoggingType::INFO, "Restored world snapshot of " + std::to_string(snapshot->EntityCount()) + " entities");
+    }
 
 } // namespace HBE::Application::Managers
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include <HotBeanEngine/application/application.hpp>
 #include <HotBeanEngine/application/managers/camera_manager.hpp>
 
@@ -23,16 +25,19 @@ namespace HBE::Application::Managers {
         return glm::vec2(viewport.x + viewport.w * 0.5f, viewport.y + viewport.h * 0.5f);
     }
 
-    std::vector<EntityID> CameraManager::GetAllActiveCameras() {
-        std::vector<EntityID> active_cameras;
+    std::vector<EntityID> CameraManager::GetAllActiveCameras() { return GetAllActiveCameras(g_ecs); }
 
-        for (EntityID entity : g_ecs.GetEntitiesWithComponents<Camera>()) {
-            const auto &camera = g_ecs.GetComponent<Camera>(entity);
+    std::vector<EntityID> CameraManager::GetAllActiveCameras(ECSManager &world) {
+        std::vector<EntityID> active_cameras;
 
+        world.View<const Camera>().Each([&active_cameras](EntityID entity, const Camera &camera) {
             if (camera.m_active) {
                 active_cameras.push_back(entity);
             }
-        }
+        });
+
+        // Cameras are rendered in this order, keep it by entity like before
+        std::sort(active_cameras.begin(), active_cameras.end());
 
         return active_cameras;
     }
@@ -12,7 +12,7 @@
 
 namespace HBE::Application::Managers {
     ComponentManager::ComponentManager(std::shared_ptr<LoggingManager> logging_manager)
-        : m_logging_manager(logging_manager), m_registered_components(0) {}
+        : m_logging_manager(logging_manager), m_registered_components(0), m_entity_limit(Core::ENTITY_LIMIT) {}
 
     /**
      * @brief Unregisters a component type from the Component Manager
@@ -25,7 +25,17 @@ namespace HBE::Application::Managers {
         ComponentID component_id = m_component_name_to_type[component_name];
         m_component_id_to_name.erase(component_id);
         m_component_name_to_type.erase(component_name);
-        m_component_id_to_data[component_id] = nullptr;
+
+        // Drop the typed lookup entry before the set it points to is released
+        if (component_id < m_component_id_to_data.size()) {
+            ComponentTypeIndex type_index = m_component_id_to_type_index[component_id];
+            if (type_index < m_type_index_to_set.size() &&
+                m_type_index_to_set[type_index].sparse_set == m_component_id_to_data[component_id].get()) {
+                m_type_index_to_set[type_index] = {};
+            }
+
+            m_component_id_to_data[component_id] = nullptr;
+        }
 
         m_registered_components--;
 
@@ -66,25 +76,170 @@ namespace HBE::Application::Managers {
         return m_component_name_to_type[std::string(component_name)];
     }
 
+    /**
+     * @brief Get the function table of a registered component
+     *
+     * @param component_id The component to look up
+     * @return The component type's table, or nullptr if the component is not registered
+     */
+    const Core::ComponentOps *ComponentManager::GetComponentOps(ComponentID component_id) const {
+        if (component_id >= m_component_id_to_data.size() || !m_component_id_to_data[component_id]) {
+            return nullptr;
+        }
+
+        return &m_component_id_to_data[component_id]->GetComponentOps();
+    }
+
     /**
      * @brief Retrieves a component from an entity
      *
      * @param entity EntityID to retrieve component from
      * @param component_id Type of component to retrieve
-     * @return Component& Component data
+     * @return IComponent* Component data, or nullptr if the component isn't registered or the entity doesn't have it
      */
     IComponent *ComponentManager::GetComponent(EntityID entity, ComponentID component_id) {
-        if (!IsComponentRegistered(component_id)) {
+        // Unregistered IDs have no sparse set, so this skips the name map lookup
+        if (component_id >= m_component_id_to_data.size() || !m_component_id_to_data[component_id]) {
             return nullptr;
         }
 
-        try {
-            std::shared_ptr<ISparseSet> sparse_set = m_component_id_to_data[component_id];
-            return std::any_cast<IComponent *>(sparse_set->GetElementPtrAsAny(entity));
-        } catch (const std::bad_any_cast &) {
-            LOG_CORE(LoggingType::ERROR, "Failed to cast component for EntityID " + std::to_string(entity) +
-                                             ", Component ID " + std::to_string(component_id) + ".");
-            return nullptr;
+        return m_component_id_to_data[component_id]->GetComponent(entity);
+    }
+
+    /**
+     * @brief Stamp a component as changed at the current tick
+     *
+     * @param entity Entity identifier
+     * @param component_id Registered component ID
+     */
+    void ComponentManager::MarkChanged(EntityID entity, ComponentID component_id) {
+        if (component_id < m_component_id_to_data.size() && m_component_id_to_data[component_id]) {
+            m_component_id_to_data[component_id]->MarkChanged(entity);
+        }
+    }
+
+    Tick ComponentManager::GetChangeTick() const { return m_change_tick; }
+
+    void ComponentManager::AdvanceChangeTick() { m_change_tick++; }
+
+    /**
+     * @brief Adds a default constructed component to every entity in a batch
+     *
+     * @param component_id Registered component to add
+     * @param entities Entities to add the component to
+     * @throw ComponentNotRegisteredException
+     */
+    void ComponentManager::AddComponents(ComponentID component_id, std::span<const EntityID> entities) {
+        if (component_id >= m_component_id_to_data.size() || !m_component_id_to_data[component_id]) {
+            auto ex = ComponentNotRegisteredException("ComponentID " + std::to_string(component_id));
+            LOG_CORE(LoggingType::ERROR, ex.what());
+            throw ex;
+        }
+
+        LOG_CORE(LoggingType::DEBUG, "Adding Empty Component \"" + m_component_id_to_name[component_id] + "\" to " +
+                                         std::to_string(entities.size()) + " entities");
+
+        ISparseSet *sparse_set = m_component_id_to_data[component_id].get();
+        sparse_set->Reserve(sparse_set->Size() + entities.size());
+
+        for (EntityID entity : entities) {
+            sparse_set->InsertEmpty(entity);
+        }
+
+        const ComponentTypeIndex type_index = m_component_id_to_type_index[component_id];
+        if (type_index < m_type_index_to_group.size() && m_type_index_to_group[type_index]) {
+            for (EntityID entity : entities) {
+                AddToOwningGroup(type_index, entity);
+            }
+        }
+    }
+
+    /**
+     * @brief Copies every component of one entity to every entity in a batch
+     *
+     * @param source Entity to copy the components of
+     * @param entities Entities to copy the components to
+     */
+    void ComponentManager::CloneComponents(EntityID source, std::span<const EntityID> entities) {
+        LOG_CORE(LoggingType::DEBUG, "Cloning the components of EntityID \"" + std::to_string(source) + "\" to " +
+                                         std::to_string(entities.size()) + " entities");
+
+        const std::vector<size_t> indices(entities.begin(), entities.end());
+
+        for (ComponentID component_id = 0; component_id < m_component_id_to_data.size(); component_id++) {
+            ISparseSet *sparse_set = m_component_id_to_data[component_id].get();
+            if (!sparse_set || !sparse_set->HasElement(static_cast<size_t>(source))) {
+                continue;
+            }
+
+            if (!sparse_set->GetComponentOps().copy) {
+                LOG_CORE(LoggingType::WARNING, "Component \"" + m_component_id_to_name[component_id] +
+                                                   "\" can't be copied, the clones get default constructed ones.");
+            }
+
+            sparse_set->InsertCopies(static_cast<size_t>(source), indices);
+
+            const ComponentTypeIndex type_index = m_component_id_to_type_index[component_id];
+            if (type_index < m_type_index_to_group.size() && m_type_index_to_group[type_index]) {
+                for (EntityID entity : entities) {
+                    AddToOwningGroup(type_index, entity);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Copies one component from outside the world to every entity in a batch
+     *
+     * @param component_id Registered component to add
+     * @param source Component to copy
+     * @param entities Entities to copy the component to
+     */
+    void ComponentManager::CopyComponents(ComponentID component_id, const IComponent &source,
+                                          std::span<const EntityID> entities) {
+        if (component_id >= m_component_id_to_data.size() || !m_component_id_to_data[component_id]) {
+            auto ex = ComponentNotRegisteredException("ComponentID " + std::to_string(component_id));
+            LOG_CORE(LoggingType::ERROR, ex.what());
+            throw ex;
+        }
+
+        LOG_CORE(LoggingType::DEBUG, "Copying Component \"" + m_component_id_to_name[component_id] + "\" to " +
+                                         std::to_string(entities.size()) + " entities");
+
+        const std::vector<size_t> indices(entities.begin(), entities.end());
+        m_component_id_to_data[component_id]->InsertCopies(source, indices);
+
+        const ComponentTypeIndex type_index = m_component_id_to_type_index[component_id];
+        if (type_index < m_type_index_to_group.size() && m_type_index_to_group[type_index]) {
+            for (EntityID entity : entities) {
+                AddToOwningGroup(type_index, entity);
+            }
+        }
+    }
+
+    /**
+     * @brief Removes a component from every entity in a batch
+     *
+     * @param component_id Registered component to remove
+     * @param entities Entities to remove the component from
+     */
+    void ComponentManager::RemoveComponents(ComponentID component_id, std::span<const EntityID> entities) {
+        if (!IsComponentRegistered(component_id)) {
+            LOG_CORE(LoggingType::WARNING, "Component ID " + std::to_string(component_id) + " not registered.");
+            return;
+        }
+
+        LOG_CORE(LoggingType::DEBUG, "Removing Component \"" + m_component_id_to_name[component_id] + "\" from " +
+                                         std::to_string(entities.size()) + " entities");
+
+        ISparseSet *sparse_set = m_component_id_to_data[component_id].get();
+        const ComponentTypeIndex type_index = m_component_id_to_type_index[component_id];
+
+        for (EntityID entity : entities) {
+            if (sparse_set->HasElement(entity)) {
+                RemoveFromOwningGroup(type_index, entity);
+                sparse_set->Remove(entity);
+            }
         }
     }
 
@@ -100,14 +255,15 @@ namespace HBE::Application::Managers {
             return;
         }
 
-        auto sparse_set = m_component_id_to_data[component_id];
+        ISparseSet *sparse_set = m_component_id_to_data[component_id].get();
 
         if (!sparse_set->HasElement(entity)) {
             LOG_CORE(LoggingType::WARNING, "Component not associated with entity");
             return;
         }
 
-        // Removes entity from component sparse set
+        // Removes entity from component sparse set, leaving its group first so the group stays packed
+        RemoveFromOwningGroup(m_component_id_to_type_index[component_id], entity);
         sparse_set->Remove(entity);
     }
 
@@ -134,16 +290,216 @@ namespace HBE::Application::Managers {
     }
 
     /**
-     * @brief Clears all component data by destroying all sparse sets
+     * @brief Clears all component data, every sparse set is emptied but keeps its pages for the next components
      */
     void ComponentManager::ClearAllComponents() {
         LOG_CORE(LoggingType::DEBUG, "Clearing all components.");
 
-        m_component_id_to_name.clear();
-        m_component_name_to_type.clear();
-        m_component_id_to_data.clear();
-        m_registered_components = 0;
+        for (const std::shared_ptr<ISparseSet> &sparse_set : m_component_id_to_data) {
+            if (sparse_set) {
+                sparse_set->Clear();
+            }
+        }
+
+        // Groups keep their sets, which are all empty now
+        for (const auto &group : m_groups) {
+            group->Clear();
+        }
 
         LOG_CORE(LoggingType::DEBUG, "All components cleared.");
     }
+
+    /**
+     * @brief Frees the pages every component set isn't using
+     */
+    void ComponentManager::Compact() {
+        LOG_CORE(LoggingType::DEBUG, "Compacting component storage.");
+
+        for (const std::shared_ptr<ISparseSet> &sparse_set : m_component_id_to_data) {
+            if (sparse_set) {
+                sparse_set->ShrinkToFit();
+            }
+        }
+    }
+
+    /**
+     * @brief Finds the lowest ComponentID no registered component type is using
+     *
+     * @return ComponentID Free ID
+     */
+    ComponentID ComponentManager::GetFreeComponentID() const {
+        ComponentID component_id = 0;
+        while (component_id < m_component_id_to_data.size() && m_component_id_to_data[component_id]) {
+            component_id++;
+        }
+
+        return component_id;
+    }
+
+    /**
+     * @brief Copies every component set along with the registered component IDs
+     *
+     * @return Snapshot Copies of the sets, indexed by ComponentID
+     */
+    ComponentManager::Snapshot ComponentManager::CaptureSnapshot() const {
+        Snapshot snapshot;
+        snapshot.registered_components = m_registered_components;
+        snapshot.entity_limit = m_entity_limit;
+        snapshot.component_id_to_name = m_component_id_to_name;
+        snapshot.component_id_to_type_index = m_component_id_to_type_index;
+        snapshot.component_sets.resize(m_component_id_to_data.size());
+
+        for (ComponentID component_id = 0; component_id < m_component_id_to_data.size(); component_id++) {
+            const std::shared_ptr<ISparseSet> &sparse_set = m_component_id_to_data[component_id];
+            if (!sparse_set) {
+                continue;
+            }
+
+            if (!sparse_set->GetComponentOps().copy) {
+                LOG_CORE(LoggingType::WARNING, "Component \"" + m_component_id_to_name.at(component_id) +
+                                                   "\" can't be copied, the snapshot holds default constructed ones.");
+            }
+
+            snapshot.component_sets[component_id] = sparse_set->Clone();
+        }
+
+        return snapshot;
+    }
+
+    /**
+     * @brief Replaces every component set and registration with copies of a snapshot's
+     *
+     * @param snapshot Snapshot taken by CaptureSnapshot()
+     */
+    void ComponentManager::RestoreSnapshot(const Snapshot &snapshot) {
+        m_registered_components = snapshot.registered_components;
+        m_entity_limit = snapshot.entity_limit;
+        m_component_id_to_name = snapshot.component_id_to_name;
+        m_component_id_to_type_index = snapshot.component_id_to_type_index;
+
+        m_component_name_to_type.clear();
+        for (const auto &[component_id, component_name] : m_component_id_to_name) {
+            m_component_name_to_type[component_name] = component_id;
+        }
+
+        m_component_id_to_data.assign(snapshot.component_sets.size(), nullptr);
+        m_type_index_to_set.clear();
+
+        for (ComponentID component_id = 0; component_id < snapshot.component_sets.size(); component_id++) {
+            if (!snapshot.component_sets[component_id]) {
+                continue;
+            }
+
+            // Copy again so the snapshot can be restored more than once
+            std::shared_ptr<ISparseSet> sparse_set = snapshot.component_sets[component_id]->Clone();
+            sparse_set->SetTickSource(&m_change_tick);
+            sparse_set->MarkAllAdded();
+
+            const ComponentTypeIndex type_index = m_component_id_to_type_index[component_id];
+            if (m_type_index_to_set.size() <= type_index) {
+                m_type_index_to_set.resize(type_index + 1);
+            }
+
+            m_type_index_to_set[type_index] = {sparse_set.get(), component_id};
+            m_component_id_to_data[component_id] = std::move(sparse_set);
+        }
+
+        // Groups outlive their sets, so sort the copies for them. Sets that were grouped when copied are already in
+        // order and are only counted again
+        for (const auto &group : m_groups) {
+            group->Rebuild(GetGroupSets(*group));
+        }
+
+        LOG_CORE(LoggingType::DEBUG,
+                 "Restored " + std::to_string(m_registered_components) + " component types from a snapshot.");
+    }
+
+    /**
+     * @brief Finds the group that owns exactly the given component types, or creates and sorts it
+     *
+     * @param owned_types Component types the group owns
+     * @return OwningGroup& The group
+     * @throw ComponentAlreadyOwnedException if a different group already owns one of the types
+     */
+    OwningGroup &ComponentManager::GetOrCreateGroup(std::vector<ComponentTypeIndex> owned_types) {
+        for (ComponentTypeIndex type_index : owned_types) {
+            if (type_index >= m_type_index_to_group.size() || !m_type_index_to_group[type_index]) {
+                continue;
+            }
+
+            // A set can only be sorted one way, so it can't be owned by two different groups
+            OwningGroup &owner = *m_type_index_to_group[type_index];
+            if (!owner.OwnsExactly(owned_types)) {
+                ComponentID component_id = m_type_index_to_set[type_index].component_id;
+                auto ex = Core::ComponentAlreadyOwnedException(GetComponentName(component_id));
+                LOG_CORE(LoggingType::ERROR, ex.what());
+                throw ex;
+            }
+
+            return owner;
+        }
+
+        LOG_CORE(LoggingType::DEBUG, "Creating owning group of " + std::to_string(owned_types.size()) + " components");
+
+        OwningGroup &group = *m_groups.emplace_back(std::make_unique<OwningGroup>(std::move(owned_types)));
+        for (ComponentTypeIndex type_index : group.GetOwnedTypes()) {
+            if (m_type_index_to_group.size() <= type_index) {
+                m_type_index_to_group.resize(type_index + 1, nullptr);
+            }
+
+            m_type_index_to_group[type_index] = &group;
+        }
+
+        group.Rebuild(GetGroupSets(group));
+        return group;
+    }
+
+    /**
+     * @brief Fills m_group_sets with the current sparse sets of a group's owned types
+     *
+     * @param group Group to look up the sets of
+     * @return std::span<ISparseSet *const> One set per owned type, nullptr for unregistered types
+     */
+    std::span<ISparseSet *const> ComponentManager::GetGroupSets(const OwningGroup &group) {
+        m_group_sets.clear();
+
+        for (ComponentTypeIndex type_index : group.GetOwnedTypes()) {
+            m_group_sets.push_back(type_index < m_type_index_to_set.size() ? m_type_index_to_set[type_index].sparse_set
+                                                                           : nullptr);
+        }
+
+        return m_group_sets;
+    }
+
+    void ComponentManager::AddToOwningGroup(ComponentTypeIndex type_index, EntityID entity) {
+        if (type_index < m_type_index_to_group.size() && m_type_index_to_group[type_index]) {
+            OwningGroup &group = *m_type_index_to_group[type_index];
+            group.Add(GetGroupSets(group), entity);
+        }
+    }
+
+    void ComponentManager::RemoveFromOwningGroup(ComponentTypeIndex type_index, EntityID entity) {
+        if (type_index < m_type_index_to_group.size() && m_type_index_to_group[type_index]) {
+            OwningGroup &group = *m_type_index_to_group[type_index];
+            group.Remove(GetGroupSets(group), entity);
+        }
+    }
+
+    /**
+     * @brief Changes the limit on entity IDs for every component sparse set
+     *
+     * @param entity_limit New limit, entity IDs must be below this value
+     */
+    void ComponentManager::SetEntityLimit(EntityID entity_limit) {
+        m_entity_limit = entity_limit;
+
+        for (ComponentID component_id = 0; component_id < m_component_id_to_data.size(); component_id++) {
+            const std::shared_ptr<ISparseSet> &sparse_set = m_component_id_to_data[component_id];
+
+            if (sparse_set && !sparse_set->SetMaxItems(static_cast<size_t>(entity_limit))) {
+                LOG_CORE(LoggingType::WARNING, "Component \"" + m_component_id_to_name[component_id] +
+                                                   "\" has an entity above the new entity limit.");
+            }
+        }
+    }
 } // namespace HBE::Application::Managers
\ No newline at end of file
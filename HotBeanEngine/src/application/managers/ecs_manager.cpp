@@ -14,15 +14,20 @@
  * @copyright Copyright (c) 2025
  */
 
+#include <algorithm>
+#include <stdexcept>
+
 #include <HotBeanEngine/application/managers/ecs_manager.hpp>
 
 namespace HBE::Application::Managers {
     using namespace Core;
 
-    ECSManager::ECSManager(std::shared_ptr<LoggingManager> logging_manager) : m_logging_manager(logging_manager) {
+    ECSManager::ECSManager(std::shared_ptr<LoggingManager> logging_manager, std::shared_ptr<JobManager> job_manager)
+        : m_job_manager(job_manager), m_logging_manager(logging_manager) {
         m_entity_manager = std::make_unique<EntityManager>(logging_manager);
         m_component_manager = std::make_shared<ComponentManager>(logging_manager);
-        m_system_manager = std::make_unique<SystemManager>(m_component_manager, logging_manager);
+        m_system_manager = std::make_unique<SystemManager>(m_component_manager, logging_manager, job_manager);
+        m_command_buffer = std::make_unique<CommandBuffer>(m_entity_manager.get());
     }
 
     /**
@@ -35,27 +40,457 @@ namespace HBE::Application::Managers {
     EntityID ECSManager::CreateEntity() { return m_entity_manager->CreateEntity(); }
 
     /**
-     * Destroys an entity and releases its resources.
+     * Creates several entities at once.
+     *
+     * @param count Number of entities to create.
+     * @return The new entities, fewer than count if the entity limit is reached.
+     */
+    std::vector<EntityID> ECSManager::CreateEntities(size_t count) { return m_entity_manager->CreateEntities(count); }
+
+    /**
+     * @brief Spawns a batch of entities that all start with the archetype's components.
+     *
+     * @param archetype Archetype listing the registered components every entity gets.
+     * @param count Number of entities to spawn.
+     * @param initializer Called with each entity and its index in the batch before systems and listeners see it.
+     * @return The spawned entities.
+     * @throw ComponentNotRegisteredException
+     */
+    std::vector<EntityID> ECSManager::SpawnBatch(IArchetype *archetype, size_t count,
+                                                 const std::function<void(EntityID, size_t)> &initializer) {
+        // Resolve every name before creating anything so an unknown component doesn't leave half a batch behind
+        std::vector<ComponentID> component_ids;
+        for (const std::string &component_name : archetype->GetComponentNames()) {
+            component_ids.push_back(GetComponentID(component_name));
+        }
+
+        return SpawnBatch(component_ids, count, initializer);
+    }
+
+    /**
+     * @brief Spawns a batch of entities that all start with the same components.
+     *
+     * Each component pool is grown once, the signature is built once and shared by the whole batch, and every system
+     * and listener is matched against it once. The initializer runs before systems and listeners are told so they see
+     * the entity's starting values.
+     *
+     * @param component_ids Registered components every entity gets.
+     * @param count Number of entities to spawn.
+     * @param initializer Called with each entity and its index in the batch, may be empty.
+     * @return The spawned entities.
+     */
+    std::vector<EntityID> ECSManager::SpawnBatch(std::span<const ComponentID> component_ids, size_t count,
+                                                 const std::function<void(EntityID, size_t)> &initializer) {
+        std::vector<EntityID> entities = m_entity_manager->CreateEntities(count);
+
+        Signature signature;
+        for (ComponentID component_id : component_ids) {
+            m_component_manager->AddComponents(component_id, entities);
+            signature.set(component_id);
+        }
+
+        for (EntityID entity : entities) {
+            m_entity_manager->SetSignature(entity, signature);
+        }
+
+        if (initializer) {
+            for (size_t i = 0; i < entities.size(); i++) {
+                initializer(entities[i], i);
+            }
+        }
+
+        m_system_manager->EntitiesSignatureChanged(entities, signature);
+
+        for (ComponentID component_id : component_ids) {
+            NotifyComponentsAdded(component_id, entities, signature);
+        }
+
+        return entities;
+    }
+
+    /**
+     * @brief Spawns copies of an entity.
+     *
+     * Every component pool the source is in copies its component into the new entities in one go. Copies count as
+     * added and changed components, and systems and listeners see them after every component has been copied.
+     *
+     * @param source Living entity to copy.
+     * @param count Number of copies to spawn.
+     * @return The spawned copies.
+     */
+    std::vector<EntityID> ECSManager::CloneEntity(EntityID source, size_t count) {
+        if (!m_entity_manager->IsAlive(source)) {
+            LOG_CORE(LoggingType::WARNING, "Can't clone EntityID \"" + std::to_string(source) + "\", it isn't alive.");
+            return {};
+        }
+
+        // Copied before creating entities, which can grow the signature storage
+        const Signature signature = m_entity_manager->GetSignature(source);
+        std::vector<EntityID> entities = m_entity_manager->CreateEntities(count);
+
+        m_component_manager->CloneComponents(source, entities);
+
+        for (EntityID entity : entities) {
+            m_entity_manager->SetSignature(entity, signature);
+        }
+
+        m_system_manager->EntitiesSignatureChanged(entities, signature);
+
+        for (ComponentID component_id = 0; component_id < MAX_COMPONENTS; component_id++) {
+            if (signature[component_id]) {
+                NotifyComponentsAdded(component_id, entities, signature);
+            }
+        }
+
+        return entities;
+    }
+
+    std::vector<EntityID> ECSManager::InstantiatePrefab(const Prefab &prefab, size_t count, EntityID parent) {
+        const std::vector<Prefab::Node> &nodes = prefab.GetNodes();
+        if (nodes.empty() || count == 0) {
+            return {};
+        }
+
+        // A component ID can be handed to another type after the prefab was cooked, its blob would be the wrong type
+        for (const PrefabComponentBlob &blob : prefab.GetComponents()) {
+            if (m_component_manager->GetComponentOps(blob.GetComponentID()) != &blob.GetComponentOps()) {
+                auto ex = ComponentNotRegisteredException("ComponentID " + std::to_string(blob.GetComponentID()));
+                LOG_CORE(LoggingType::ERROR, ex.what());
+                throw ex;
+            }
+        }
+
+        std::vector<EntityID> entities = m_entity_manager->CreateEntities(nodes.size() * count);
+
+        // Only whole instances are spawned when the entity limit is reached
+        if (entities.size() < nodes.size() * count) {
+            LOG_CORE(LoggingType::WARNING, "Entity limit reached, only spawning " +
+                                               std::to_string(entities.size() / nodes.size()) + " of " +
+                                               std::to_string(count) + " prefab instances.");
+
+            count = entities.size() / nodes.size();
+            m_entity_manager->DestroyEntities(std::span<const EntityID>(entities).subspan(nodes.size() * count));
+            entities.resize(nodes.size() * count);
+
+            if (count == 0) {
+                return {};
+            }
+        }
+
+        // Instance i of node n is entities[n * count + i], so each node's instances are one batch and every parent
+        // comes before its children
+        auto instances = [&](size_t node) { return std::span<const EntityID>(entities).subspan(node * count, count); };
+
+        std::vector<EntityID> added;
+        std::vector<size_t> blob_nodes;
+
+        for (const PrefabComponentBlob &blob : prefab.GetComponents()) {
+            const ComponentID component_id = blob.GetComponentID();
+            const ComponentOps &ops = blob.GetComponentOps();
+
+            for (size_t position = 0; position < blob.Size(); position++) {
+                const size_t node = blob.GetNodes()[position];
+                m_component_manager->CopyComponents(component_id, blob.GetComponent(position), instances(node));
+
+                if (!ops.set_parent) {
+                    continue;
+                }
+
+                const Sint64 parent_node = nodes[node].parent;
+                for (size_t instance = 0; instance < count; instance++) {
+                    const EntityID linked_parent =
+                        parent_node == -1 ? parent : entities[static_cast<size_t>(parent_node) * count + instance];
+                    ops.set_parent(m_component_manager->GetComponent(instances(node)[instance], component_id),
+                                   linked_parent);
+                }
+            }
+        }
+
+        for (size_t node = 0; node < nodes.size(); node++) {
+            for (EntityID entity : instances(node)) {
+                m_entity_manager->SetSignature(entity, nodes[node].signature);
+            }
+
+            m_system_manager->EntitiesSignatureChanged(instances(node), nodes[node].signature);
+        }
+
+        // Listeners get every instance of every node with the component in one batch, parents first
+        for (const PrefabComponentBlob &blob : prefab.GetComponents()) {
+            blob_nodes.assign(blob.GetNodes().begin(), blob.GetNodes().end());
+            std::sort(blob_nodes.begin(), blob_nodes.end());
+
+            added.clear();
+            for (size_t node : blob_nodes) {
+                std::span<const EntityID> node_instances = instances(node);
+                added.insert(added.end(), node_instances.begin(), node_instances.end());
+            }
+
+            NotifyComponentsAdded(blob.GetComponentID(), added);
+        }
+
+        std::span<const EntityID> roots = instances(0);
+        return std::vector<EntityID>(roots.begin(), roots.end());
+    }
+
+    /**
+     * @brief Queues an entity to be destroyed when the engine's command buffer is flushed at the end of the frame.
+     *
+     * The entity keeps its components and stays in its systems until then, so systems iterating it this frame never
+     * see it half torn down. Queuing the same entity more than once is harmless.
      *
      * @param entity The ID of the entity to destroy.
+     */
+    void ECSManager::DestroyEntity(EntityID entity) { m_command_buffer->DestroyEntity(entity); }
+
+    /**
+     * @brief Tears down a batch of living entities at once.
      *
-     * @throws assertion failure if the entity ID is out of range or invalid.
+     * Systems and listeners let go of the entities while their components still exist. Components are then removed
+     * pool by pool, so each sparse set is visited once for the whole batch, and no signature is rematched.
+     *
+     * @param entities Living entities to destroy, each listed once.
      */
-    void ECSManager::DestroyEntity(EntityID entity) {
-        m_entity_manager->DestroyEntity(entity);
-        RemoveAllComponents(entity);
+    void ECSManager::DestroyEntities(std::span<const EntityID> entities) {
+        if (entities.empty()) {
+            return;
+        }
+
+        m_system_manager->EntitiesDestroyed(entities);
+        NotifyEntitiesDestroyed(entities, false);
+
+        Signature used_components;
+        for (EntityID entity : entities) {
+            used_components |= m_entity_manager->GetSignature(entity);
+        }
+
+        for (ComponentID component_id = 0; component_id < MAX_COMPONENTS; component_id++) {
+            if (used_components[component_id]) {
+                m_component_manager->RemoveComponents(component_id, entities);
+            }
+        }
+
+        m_entity_manager->DestroyEntities(entities);
     }
 
     /**
-     * @brief Destroys all entities and clears component/system mappings.
+     * @brief Gets the command buffer that is flushed at the end of every frame.
+     *
+     * @return The engine's command buffer.
+     */
+    CommandBuffer &ECSManager::GetCommandBuffer() { return *m_command_buffer; }
+
+    /**
+     * @brief Creates an empty command buffer for this ECSManager.
+     *
+     * @return A command buffer that has to be applied with Flush(CommandBuffer &).
      */
-    void ECSManager::DestroyAllEntities() {
-        for (EntityID entity : GetAllEntities()) {
-            RemoveAllComponents(entity);
+    CommandBuffer ECSManager::CreateCommandBuffer() { return CommandBuffer(m_entity_manager.get()); }
+
+    /**
+     * @brief Applies the engine's command buffer.
+     */
+    void ECSManager::Flush() { Flush(*m_command_buffer); }
+
+    /**
+     * @brief Applies all commands recorded in a command buffer and empties it.
+     *
+     * Commands are sorted by entity, keeping the recorded order for each entity. Each entity's component changes are
+     * applied to storage first, then its signature is set and matched against the systems once. Listeners are told
+     * about removed components as each entity is updated, and about added components after every entity has been
+     * updated, in one batch per component. Destroyed entities are collected into one kill list and torn down together
+     * once every other command has been applied, see DestroyEntities().
+     *
+     * @param command_buffer The buffer to apply.
+     */
+    void ECSManager::Flush(CommandBuffer &command_buffer) {
+        std::vector<CommandBuffer::Command> commands = command_buffer.TakeCommands();
+        if (commands.empty()) {
+            return;
+        }
+
+        LOG_CORE(LoggingType::DEBUG, "Flushing " + std::to_string(commands.size()) + " commands");
+
+        std::stable_sort(commands.begin(), commands.end(),
+                         [](const CommandBuffer::Command &a, const CommandBuffer::Command &b) {
+                             return a.entity < b.entity;
+                         });
+
+        std::vector<std::pair<ComponentID, EntityID>> added_components;
+        std::vector<EntityID> destroyed_entities;
+
+        size_t begin = 0;
+        while (begin < commands.size()) {
+            EntityID entity = commands[begin].entity;
+            size_t end = begin;
+            while (end < commands.size() && commands[end].entity == entity) {
+                end++;
+            }
+
+            if (!m_entity_manager->IsAlive(entity)) {
+                LOG_CORE(LoggingType::WARNING,
+                         "Dropping commands for EntityID \"" + std::to_string(entity) + "\", it isn't alive.");
+                begin = end;
+                continue;
+            }
+
+            const Signature initial_signature = m_entity_manager->GetSignature(entity);
+            Signature signature = initial_signature;
+            bool destroy = false;
+
+            for (size_t i = begin; i < end; i++) {
+                CommandBuffer::Command &command = commands[i];
+
+                if (command.type == CommandBuffer::CommandType::DestroyEntity) {
+                    destroy = true;
+                    break;
+                }
+
+                ComponentID component_id = command.apply(*m_component_manager);
+                if (component_id >= MAX_COMPONENTS) {
+                    continue;
+                }
+
+                if (command.type == CommandBuffer::CommandType::AddComponent) {
+                    signature.set(component_id);
+                    added_components.push_back({component_id, entity});
+                }
+                else {
+                    signature.reset(component_id);
+                }
+            }
+
+            m_entity_manager->SetSignature(entity, signature);
+
+            // Removals are reported before a destroy, which reports the components the entity still has
+            NotifyComponentsRemoved(entity, initial_signature, signature);
+
+            if (destroy) {
+                destroyed_entities.push_back(entity);
+            }
+            else {
+                m_system_manager->EntitySignatureChanged(entity, signature);
+            }
+
+            begin = end;
+        }
+
+        DestroyEntities(destroyed_entities);
+
+        // Components added and then removed or destroyed in the same flush are skipped
+        std::erase_if(added_components, [this](const std::pair<ComponentID, EntityID> &added) {
+            return !HasComponent(added.second, added.first);
+        });
+        std::stable_sort(added_components.begin(), added_components.end(),
+                         [](const auto &a, const auto &b) { return a.first < b.first; });
+
+        std::vector<EntityID> entities;
+        size_t batch_begin = 0;
+        while (batch_begin < added_components.size()) {
+            ComponentID component_id = added_components[batch_begin].first;
+
+            entities.clear();
+            size_t batch_end = batch_begin;
+            while (batch_end < added_components.size() && added_components[batch_end].first == component_id) {
+                entities.push_back(added_components[batch_end].second);
+                batch_end++;
+            }
+
+            NotifyComponentsAdded(component_id, entities);
+            batch_begin = batch_end;
         }
+    }
+
+    /**
+     * @brief Destroys all entities right away and clears component/system mappings.
+     *
+     * Used to unload a scene. Every component set and system is emptied in one go instead of removing components
+     * entity by entity, and listeners are told once through OnAllComponentsRemoved(). Component types stay
+     * registered and their sets keep their memory for the next scene. Commands waiting to be flushed are dropped,
+     * the entities they refer to are gone.
+     */
+    void ECSManager::DestroyAllEntities() {
+        LOG_CORE(LoggingType::DEBUG, "Destroying all " + std::to_string(EntityCount()) + " entities");
+
+        m_command_buffer->Clear();
+
+        std::vector<EntityID> entities = GetAllEntities();
+        m_system_manager->RemoveAllEntities();
+        NotifyEntitiesDestroyed(entities, true);
+
+        m_component_manager->ClearAllComponents();
         m_entity_manager->DestroyAllEntities();
     }
 
+    /**
+     * @brief Copies the whole world.
+     *
+     * @return Snapshot of every component, the entity bookkeeping and the entities of each system.
+     */
+    WorldSnapshot ECSManager::CaptureSnapshot() const {
+        LOG_CORE(LoggingType::DEBUG, "Capturing snapshot of " + std::to_string(EntityCount()) + " entities");
+
+        WorldSnapshot snapshot;
+        snapshot.m_entities = m_entity_manager->CaptureSnapshot();
+        snapshot.m_components = m_component_manager->CaptureSnapshot();
+        snapshot.m_systems = m_system_manager->CaptureSnapshot();
+
+        return snapshot;
+    }
+
+    /**
+     * @brief Replaces the whole world with a snapshot.
+     *
+     * Systems and listeners let go of the current entities while their components still exist. The sets, entities
+     * and system memberships are then copied back in, and systems and listeners are told about the restored entities.
+     *
+     * @param snapshot Snapshot taken by CaptureSnapshot().
+     */
+    void ECSManager::RestoreSnapshot(const WorldSnapshot &snapshot) {
+        LOG_CORE(LoggingType::DEBUG, "Restoring snapshot of " + std::to_string(snapshot.EntityCount()) + " entities");
+
+        m_command_buffer->Clear();
+
+        std::vector<EntityID> entities = GetAllEntities();
+        m_system_manager->RemoveAllEntities();
+        NotifyEntitiesDestroyed(entities, true);
+        m_entity_manager->DestroyAllEntities();
+
+        m_component_manager->RestoreSnapshot(snapshot.m_components);
+        m_entity_manager->RestoreSnapshot(snapshot.m_entities);
+
+        entities = GetAllEntities();
+        if (!m_system_manager->RestoreSnapshot(snapshot.m_systems)) {
+            // Systems that changed since the snapshot was taken are matched against every entity
+            for (EntityID entity : entities) {
+                m_system_manager->EntitySignatureChanged(entity, m_entity_manager->GetSignature(entity));
+            }
+        }
+        else {
+            // Cached queries aren't part of the snapshot, so they're always matched again
+            QueryCache &query_cache = m_system_manager->GetQueryCache();
+            for (EntityID entity : entities) {
+                query_cache.EntitySignatureChanged(entity, m_entity_manager->GetSignature(entity));
+            }
+        }
+
+        // One batch per listened component, so each listener is called once per component
+        std::vector<EntityID> component_entities;
+        for (ComponentID component_id = 0; component_id < MAX_COMPONENTS; component_id++) {
+            if (m_component_listeners[component_id].empty()) {
+                continue;
+            }
+
+            component_entities.clear();
+            for (EntityID entity : entities) {
+                if (m_entity_manager->GetSignature(entity)[component_id]) {
+                    component_entities.push_back(entity);
+                }
+            }
+
+            NotifyComponentsAdded(component_id, component_entities);
+        }
+    }
+
     /**
      * @brief Retrieves all entity IDs in the manager.
      *
@@ -63,6 +498,48 @@ namespace HBE::Application::Managers {
      */
     std::vector<EntityID> ECSManager::GetAllEntities() { return m_entity_manager->GetAllEntities(); }
 
+    /**
+     * @brief Gets every entity matching a query filter.
+     *
+     * A persistent query is returned straight from the cache. Otherwise every entity's signature is checked and the
+     * result is handed to the cache, which keeps the query up to date from the second ask onwards.
+     *
+     * @param filter Components matching entities must and must not have.
+     * @return Matching entities.
+     * @throw std::invalid_argument if the filter doesn't require any component.
+     */
+    const EntitySet &ECSManager::Query(const QueryFilter &filter) {
+        // An entity that lost all of its components would match, and destroying every entity doesn't tell the cache
+        if (filter.with.none()) {
+            LOG_CORE(LoggingType::ERROR, "A query needs at least one required component");
+            throw std::invalid_argument("A query needs at least one required component");
+        }
+
+        QueryCache &query_cache = m_system_manager->GetQueryCache();
+        if (const EntitySet *cached = query_cache.Find(filter)) {
+            return *cached;
+        }
+
+        EntitySet matched;
+        for (EntityID entity : GetAllEntities()) {
+            if (filter.Matches(m_entity_manager->GetSignature(entity))) {
+                matched.Insert(entity);
+            }
+        }
+
+        return query_cache.Add(filter, std::move(matched));
+    }
+
+    /**
+     * @brief Result of a query on a component that isn't registered.
+     *
+     * @return An empty set shared by every world.
+     */
+    const EntitySet &ECSManager::EmptyQueryResult() {
+        static const EntitySet empty;
+        return empty;
+    }
+
     /**
      * @brief Removes all components associated with a given entity.
      *
@@ -81,13 +558,25 @@ namespace HBE::Application::Managers {
                 Signature signature = m_entity_manager->SetSignature(entity, (ComponentID)i, false);
                 m_system_manager->EntitySignatureChanged(entity, signature);
                 m_component_manager->RemoveComponent(entity, i);
+                NotifyComponentRemoved((ComponentID)i, entity, signature);
             }
         }
     }
 
+    /**
+     * @brief Stamp an entity's component as changed without touching it.
+     *
+     * @param entity EntityID whose component changed.
+     * @param component_id Registered component ID.
+     */
+    void ECSManager::MarkChanged(EntityID entity, ComponentID component_id) {
+        m_component_manager->MarkChanged(entity, component_id);
+    }
+
     std::vector<IComponent *> ECSManager::GetAllComponents(EntityID entity) {
         Signature signature = m_entity_manager->GetSignature(entity);
         std::vector<IComponent *> components = std::vector<IComponent *>();
+        components.reserve(signature.count());
 
         for (size_t i = 0; i < signature.size(); i++) {
             if (signature.test(i)) {
@@ -105,34 +594,96 @@ namespace HBE::Application::Managers {
      */
     EntityID ECSManager::EntityCount() const { return m_entity_manager->EntityCount(); }
 
+    /**
+     * @brief Gets the current limit on the number of entities.
+     *
+     * @return Entity IDs are always below this value.
+     */
+    EntityID ECSManager::GetEntityLimit() const { return m_entity_manager->GetEntityLimit(); }
+
+    /**
+     * @brief Changes the limit on the number of entities.
+     *
+     * Storage grows with the number of entities in use, so raising the limit doesn't allocate anything up front.
+     *
+     * @param entity_limit New limit.
+     * @return False if a living entity's ID is at or above the new limit.
+     */
+    bool ECSManager::SetEntityLimit(EntityID entity_limit) {
+        if (!m_entity_manager->SetEntityLimit(entity_limit)) {
+            return false;
+        }
+
+        m_component_manager->SetEntityLimit(entity_limit);
+        return true;
+    }
+
+    /**
+     * @brief Checks if an entity ID is currently in use.
+     *
+     * @param entity The ID of the entity to check.
+     * @return True if the entity is alive.
+     */
+    bool ECSManager::IsEntityAlive(EntityID entity) const { return m_entity_manager->IsAlive(entity); }
+
+    /**
+     * @brief Gets a handle that keeps referring to this entity after its ID is recycled.
+     *
+     * @param entity The ID of the entity.
+     * @return Handle to the entity, or a null handle if the entity isn't alive.
+     */
+    EntityHandle ECSManager::GetEntityHandle(EntityID entity) const { return m_entity_manager->GetHandle(entity); }
+
+    /**
+     * @brief Checks if a handle still refers to a living entity.
+     *
+     * @param handle The handle to check.
+     * @return False if the entity was destroyed, even if its ID has been reused.
+     */
+    bool ECSManager::IsEntityValid(EntityHandle handle) const { return m_entity_manager->IsValid(handle); }
+
     /**
      * @brief Unregisters a component type by name.
      *
-     * @warning This will remove the component from all entities and update system signatures. This may lead to errors
-     * or unintended behavior if systems expect the component to exist.
+     * @warning This will remove the component from all entities, notifying its listeners. Systems can't lose a
+     * component from their signature, they would match entities without it, so unregister them first.
      * @param component_name The name of the component type to unregister.
+     * @throw ComponentInUseException if a system signature still has the component
      */
     void ECSManager::UnregisterComponentID(std::string component_name) {
         ComponentID component_id = GetComponentID(component_name);
 
-        // Remove component from all entities that have it
-        for (EntityID entity : GetAllEntities()) {
-            if (HasComponent(entity, component_id)) {
-                m_component_manager->RemoveComponent(entity, component_id);
+        for (SystemBase *system : GetAllSystems()) {
+            if (m_system_manager->GetSignature(system).test(component_id)) {
+                auto ex = ComponentInUseException(component_name, system->GetName());
+                LOG_CORE(LoggingType::ERROR, ex.what());
+                throw ex;
             }
         }
 
-        // Update all system signatures to remove this component
-        for (SystemBase *system : GetAllSystems()) {
-            Signature system_signature = m_system_manager->GetSignature(system);
-            if (system_signature[component_id]) {
-                system_signature[component_id] = false;
+        // The ID can be given to another component type, so queries using it are dropped
+        m_system_manager->GetQueryCache().ForgetComponent(component_id);
+
+        // Clear the component's bit from every entity before its ID can be given to another component type
+        for (EntityID entity : GetAllEntities()) {
+            if (!m_entity_manager->HasComponent(entity, component_id)) {
+                continue;
             }
+
+            Signature signature = m_entity_manager->SetSignature(entity, component_id, false);
+            m_system_manager->EntitySignatureChanged(entity, signature);
+            m_component_manager->RemoveComponent(entity, component_id);
+            NotifyComponentRemoved(component_id, entity, signature);
         }
 
         m_component_manager->UnregisterComponentID(component_name);
     }
 
+    /**
+     * @brief Frees component storage that isn't holding components.
+     */
+    void ECSManager::CompactComponents() { m_component_manager->Compact(); }
+
     /**
      * @brief Checks if an entity has a specific component by name.
      *
@@ -165,6 +716,16 @@ namespace HBE::Application::Managers {
         return m_component_manager->GetComponentName(component_id);
     }
 
+    /**
+     * @brief Get the function table of a registered component
+     *
+     * @param component_id The component to look up
+     * @return The component type's table, or nullptr if the component is not registered
+     */
+    const ComponentOps *ECSManager::GetComponentOps(ComponentID component_id) const {
+        return m_component_manager->GetComponentOps(component_id);
+    }
+
     /**
      * @brief Get the registered Component Type using the Component Name
      *
@@ -210,9 +771,203 @@ namespace HBE::Application::Managers {
      */
     const Signature &ECSManager::GetSignature(EntityID entity) const { return m_entity_manager->GetSignature(entity); }
 
+    /**
+     * @brief Files a listener under every component it listens for.
+     *
+     * @param listener The listener to register, ignored if it's null or already registered.
+     */
     void ECSManager::RegisterComponentListener(ComponentListener *listener) {
-        if (listener) {
-            m_component_listeners.push_back(listener);
+        if (!listener) {
+            return;
+        }
+
+        for (ComponentID component_id : listener->GetListenedComponents()) {
+            if (component_id >= MAX_COMPONENTS) {
+                LOG_CORE(LoggingType::WARNING,
+                         "Listener listens for ComponentID \"" + std::to_string(component_id) + "\" which can't exist");
+                continue;
+            }
+
+            std::vector<ComponentListener *> &listeners = m_component_listeners[component_id];
+            if (std::find(listeners.begin(), listeners.end(), listener) == listeners.end()) {
+                listeners.push_back(listener);
+            }
+        }
+    }
+
+    /**
+     * @brief Notify listeners that a batch of entities sharing one signature gained a component.
+     *
+     * Every entity in the batch has the same signature, so each listener is checked once for the whole batch.
+     *
+     * @param component_id The component that was added.
+     * @param entities The entities that gained the component.
+     * @param signature The signature shared by every entity in the batch.
+     */
+    void ECSManager::NotifyComponentsAdded(ComponentID component_id, std::span<const EntityID> entities,
+                                           const Signature &signature) {
+        std::vector<IComponent *> components;
+
+        for (ComponentListener *listener : m_component_listeners[component_id]) {
+            if (!listener->GetListenedSignature().IsSubsetOf(signature)) {
+                continue;
+            }
+
+            // Only look the components up once, and only if a listener wants them
+            if (components.empty()) {
+                components.reserve(entities.size());
+                for (EntityID entity : entities) {
+                    components.push_back(m_component_manager->GetComponent(entity, component_id));
+                }
+            }
+
+            listener->OnComponentsAdded(component_id, components, entities);
+        }
+    }
+
+    /**
+     * @brief Notify listeners that a batch of entities with different signatures gained a component.
+     *
+     * Each listener is called once with the entities that now have every component it listens for.
+     *
+     * @param component_id The component that was added.
+     * @param entities The entities that gained the component.
+     */
+    void ECSManager::NotifyComponentsAdded(ComponentID component_id, std::span<const EntityID> entities) {
+        std::vector<EntityID> matched_entities;
+        std::vector<IComponent *> components;
+
+        for (ComponentListener *listener : m_component_listeners[component_id]) {
+            matched_entities.clear();
+            components.clear();
+
+            for (EntityID entity : entities) {
+                if (listener->GetListenedSignature().IsSubsetOf(m_entity_manager->GetSignature(entity))) {
+                    matched_entities.push_back(entity);
+                    components.push_back(m_component_manager->GetComponent(entity, component_id));
+                }
+            }
+
+            if (!matched_entities.empty()) {
+                listener->OnComponentsAdded(component_id, components, matched_entities);
+            }
+        }
+    }
+
+    /**
+     * @brief Notify listeners of a component that it was added to an entity.
+     *
+     * A listener is called once the entity has every component it listens for.
+     *
+     * @param component_id The component that was added.
+     * @param entity The entity ID that gained the component.
+     */
+    void ECSManager::NotifyComponentAdded(ComponentID component_id, EntityID entity) {
+        const Signature &signature = m_entity_manager->GetSignature(entity);
+        IComponent *component = nullptr;
+
+        for (ComponentListener *listener : m_component_listeners[component_id]) {
+            if (!listener->GetListenedSignature().IsSubsetOf(signature)) {
+                continue;
+            }
+
+            if (!component) {
+                component = m_component_manager->GetComponent(entity, component_id);
+            }
+
+            listener->OnComponentAdded(component, entity);
+        }
+    }
+
+    /**
+     * @brief Notify listeners of a component that it was removed from an entity.
+     *
+     * @param component_id The component that was removed.
+     * @param entity The entity ID that lost the component.
+     */
+    void ECSManager::NotifyComponentRemoved(ComponentID component_id, EntityID entity) {
+        NotifyComponentRemoved(component_id, entity, m_entity_manager->GetSignature(entity));
+    }
+
+    /**
+     * @brief Notify listeners of a component that it was removed from an entity.
+     *
+     * Only listeners that matched the entity until now are called, the ones still waiting for another of their
+     * components never heard about it.
+     *
+     * @param component_id The component that was removed.
+     * @param entity The entity ID that lost the component.
+     * @param signature The entity's signature without the component.
+     */
+    void ECSManager::NotifyComponentRemoved(ComponentID component_id, EntityID entity, const Signature &signature) {
+        Signature previous_signature = signature;
+        previous_signature.set(component_id);
+
+        for (ComponentListener *listener : m_component_listeners[component_id]) {
+            if (listener->GetListenedSignature().IsSubsetOf(previous_signature)) {
+                listener->OnComponentRemoved(component_id, entity);
+            }
+        }
+    }
+
+    /**
+     * @brief Notify listeners about every component an entity lost at once, as if they were removed one at a time.
+     *
+     * @param entity The entity ID that lost the components.
+     * @param signature The entity's signature before it lost them.
+     * @param remaining_signature The entity's signature now.
+     */
+    void ECSManager::NotifyComponentsRemoved(EntityID entity, Signature signature,
+                                             const Signature &remaining_signature) {
+        const Signature removed = signature & ~remaining_signature;
+        if (removed.none()) {
+            return;
+        }
+
+        for (ComponentID component_id = 0; component_id < MAX_COMPONENTS; component_id++) {
+            if (removed[component_id]) {
+                signature.reset(component_id);
+                NotifyComponentRemoved(component_id, entity, signature);
+            }
+        }
+    }
+
+    /**
+     * @brief Notify listeners that a batch of entities is being destroyed.
+     *
+     * Each listener is called once, with the lowest of its components like NotifyComponentsRemoved() removing them in
+     * order, and the entities that matched it. Components still have to exist when this runs.
+     *
+     * @param entities The entities being destroyed.
+     * @param all_entities True if every entity is being destroyed, listeners get OnAllComponentsRemoved() instead.
+     */
+    void ECSManager::NotifyEntitiesDestroyed(std::span<const EntityID> entities, bool all_entities) {
+        std::vector<ComponentListener *> notified_listeners;
+        std::vector<EntityID> matched_entities;
+
+        for (ComponentID component_id = 0; component_id < MAX_COMPONENTS; component_id++) {
+            for (ComponentListener *listener : m_component_listeners[component_id]) {
+                // Listeners are filed under every component they listen for, the first one found is the lowest
+                if (std::find(notified_listeners.begin(), notified_listeners.end(), listener) !=
+                    notified_listeners.end()) {
+                    continue;
+                }
+                notified_listeners.push_back(listener);
+
+                matched_entities.clear();
+                for (EntityID entity : entities) {
+                    if (listener->GetListenedSignature().IsSubsetOf(m_entity_manager->GetSignature(entity))) {
+                        matched_entities.push_back(entity);
+                    }
+                }
+
+                if (all_entities) {
+                    listener->OnAllComponentsRemoved(component_id, matched_entities);
+                }
+                else if (!matched_entities.empty()) {
+                    listener->OnComponentsRemoved(component_id, matched_entities);
+                }
+            }
         }
     }
 
@@ -233,5 +988,26 @@ namespace HBE::Application::Managers {
         m_system_manager->IterateSystems(event, state);
     }
 
+    void ECSManager::IterateWorlds(JobManager &job_manager, std::span<ECSManager *const> worlds,
+                                   GameLoopState state) {
+        job_manager.ParallelFor(0, worlds.size(), [worlds, state](size_t i) { worlds[i]->IterateSystems(state); }, 1);
+    }
+
+    void ECSManager::StepWorlds(JobManager &job_manager, std::span<ECSManager *const> worlds, size_t step_count) {
+        job_manager.ParallelFor(
+            0, worlds.size(),
+            [worlds, step_count](size_t i) {
+                ECSManager &world = *worlds[i];
+                for (size_t step = 0; step < step_count; step++) {
+                    world.IterateSystems(GameLoopState::OnFixedUpdate);
+                    world.IterateSystems(GameLoopState::OnUpdate);
+                    world.Flush();
+                }
+            },
+            1);
+    }
+
     std::vector<SystemBase *> ECSManager::GetAllSystems() { return m_system_manager->GetAllSystems(); }
+
+    void ECSManager::SetParallelExecution(bool enabled) { m_system_manager->SetParallelExecution(enabled); }
 } // namespace HBE::Application::Managers
\ No newline at end of file
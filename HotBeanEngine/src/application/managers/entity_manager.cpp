@@ -8,46 +8,87 @@
  * @copyright Copyright (c) 2025
  */
 
+#include <algorithm>
+
 #include <HotBeanEngine/application/managers/entity_manager.hpp>
 
 namespace HBE::Application::Managers {
     /**
-     * Constructs an EntityManager and initializes the queue of available entity IDs.
+     * Constructs an EntityManager using the configured entity limit.
      *
-     * This constructor fills the queue with all possible entity IDs, making them
-     * available for future use. The entity IDs range from 0 to MAX_ENTITIES - 1.
+     * Entity IDs range from 0 to the entity limit - 1 and are handed out as they are needed.
      */
-    EntityManager::EntityManager(std::shared_ptr<LoggingManager> logging_manager) : m_logging_manager(logging_manager) {
+    EntityManager::EntityManager(std::shared_ptr<LoggingManager> logging_manager)
+        : m_logging_manager(logging_manager), m_entity_limit(Core::ENTITY_LIMIT) {
 
         LOG_CORE(LoggingType::DEBUG, "Initializing EntityManager");
 
         InitializeEntities();
 
-        LOG_CORE(LoggingType::INFO,
-                 "Initialized " + std::to_string(m_available_entities.size()) + " Entities (starting at 0)");
+        LOG_CORE(LoggingType::INFO, "Initialized EntityManager with a limit of " + std::to_string(m_entity_limit) +
+                                        " Entities (starting at 0)");
     }
 
     EntityManager::~EntityManager() = default;
 
     /**
-     * @brief Initializes the queue with available entity IDs.
+     * @brief Resets entity ID bookkeeping.
      *
-     * Fills the queue with all possible entity IDs, making them
-     * available for future use. The entity IDs range from 0 to MAX_ENTITIES - 1.
+     * Clears recycled IDs, liveness and signatures so IDs are handed out from 0 again. Generations are kept so handles
+     * to the old entities stay invalid.
      */
     void EntityManager::InitializeEntities() {
-        m_living_entity_count = 0;
+        for (EntityID entity : m_alive_entities) {
+            m_slots[entity].generation++;
+        }
 
-        // Clear existing queue
-        while (!m_available_entities.empty()) {
-            m_available_entities.pop();
+        for (EntitySlot &slot : m_slots) {
+            slot.alive_index = NO_ENTITY;
+            slot.next_free = NO_ENTITY;
         }
 
-        for (EntityID entity_id = 0; entity_id < MAX_ENTITIES; entity_id++) {
-            m_available_entities.push(entity_id);
-            m_alive_entities[entity_id] = false;
-            m_signatures[entity_id].reset();
+        m_next_entity_id = 0;
+        m_free_head = NO_ENTITY;
+        m_free_tail = NO_ENTITY;
+
+        m_alive_entities.clear();
+        m_signatures.clear();
+    }
+
+    /**
+     * @brief Adds an entity ID to the back of the free list
+     *
+     * @param entity The ID to recycle.
+     */
+    void EntityManager::PushFreeEntity(EntityID entity) {
+        m_slots[entity].next_free = NO_ENTITY;
+
+        if (m_free_tail == NO_ENTITY) {
+            m_free_head = static_cast<Uint32>(entity);
+        }
+        else {
+            m_slots[m_free_tail].next_free = static_cast<Uint32>(entity);
         }
+
+        m_free_tail = static_cast<Uint32>(entity);
+    }
+
+    /**
+     * @brief Takes the entity ID at the front of the free list
+     *
+     * @return The recycled ID. The free list must not be empty.
+     */
+    EntityID EntityManager::PopFreeEntity() {
+        EntityID entity = m_free_head;
+
+        m_free_head = m_slots[entity].next_free;
+        m_slots[entity].next_free = NO_ENTITY;
+
+        if (m_free_head == NO_ENTITY) {
+            m_free_tail = NO_ENTITY;
+        }
+
+        return entity;
     }
 
     /**
@@ -57,23 +98,85 @@ namespace HBE::Application::Managers {
      * @throw std::overflow_error if the maximum number of entities has been reached.
      */
     EntityID EntityManager::CreateEntity() {
-        if (m_living_entity_count >= MAX_ENTITIES) {
+        if (EntityCount() >= m_entity_limit) {
             LOG_CORE(LoggingType::WARNING, "Maximum number of entities reached.");
-            return MAX_ENTITIES;
+            return m_entity_limit;
         }
 
-        // Take an ID from the front of the queue
-        EntityID id = m_available_entities.front();
-        m_alive_entities[id] = true;
+        EntityID id = AllocateEntity();
 
-        LOG_CORE(LoggingType::DEBUG, "Creating EntityID \"" + std::to_string(id) + "\"");
+        LOG_CORE(LoggingType::DEBUG, "Entity \"" + std::to_string(id) + "\" created.");
+        LOG_CORE(LoggingType::DEBUG, "\tLiving Entities: " + std::to_string(EntityCount()));
+        LOG_CORE(LoggingType::DEBUG, "\tAvailable Entities: " + std::to_string(m_entity_limit - EntityCount()));
 
-        m_available_entities.pop();
-        m_living_entity_count++;
+        return id;
+    }
 
-        LOG_CORE(LoggingType::DEBUG, "Entity \"" + std::to_string(id) + "\" created.");
-        LOG_CORE(LoggingType::DEBUG, "\tLiving Entities: " + std::to_string(m_living_entity_count));
-        LOG_CORE(LoggingType::DEBUG, "\tAvailable Entities: " + std::to_string(m_available_entities.size() - 1));
+    /**
+     * @brief Creates several entities at once.
+     *
+     * Storage is grown once for the whole batch and only a single summary is logged.
+     *
+     * @param count Number of entities to create.
+     * @return IDs of the new entities, fewer than count if the entity limit was reached.
+     */
+    std::vector<EntityID> EntityManager::CreateEntities(size_t count) {
+        size_t available = static_cast<size_t>(m_entity_limit - EntityCount());
+        if (count > available) {
+            LOG_CORE(LoggingType::WARNING, "Maximum number of entities reached, creating " +
+                                               std::to_string(available) + " of " + std::to_string(count) +
+                                               " entities.");
+            count = available;
+        }
+
+        std::vector<EntityID> entities;
+        entities.reserve(count);
+        m_alive_entities.reserve(m_alive_entities.size() + count);
+
+        // Grow the per-entity storage once for every never-used ID the batch will take
+        size_t unused_ids = static_cast<size_t>(m_entity_limit - m_next_entity_id);
+        size_t new_size = static_cast<size_t>(m_next_entity_id) + std::min(count, unused_ids);
+        if (m_signatures.size() < new_size) {
+            m_signatures.resize(new_size);
+        }
+        if (m_slots.size() < new_size) {
+            m_slots.resize(new_size);
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            entities.push_back(AllocateEntity());
+        }
+
+        LOG_CORE(LoggingType::DEBUG, "Created " + std::to_string(count) + " entities.");
+        LOG_CORE(LoggingType::DEBUG, "\tLiving Entities: " + std::to_string(EntityCount()));
+
+        return entities;
+    }
+
+    /**
+     * @brief Takes the next free entity ID and marks it alive. The caller checks the entity limit.
+     *
+     * @return The new entity's ID.
+     */
+    EntityID EntityManager::AllocateEntity() {
+        // Hand out IDs that have never been used before recycling destroyed ones
+        EntityID id;
+        if (m_next_entity_id < m_entity_limit) {
+            id = m_next_entity_id++;
+            if (m_signatures.size() < static_cast<size_t>(m_next_entity_id)) {
+                m_signatures.resize(m_next_entity_id);
+            }
+            if (m_slots.size() < static_cast<size_t>(m_next_entity_id)) {
+                m_slots.resize(m_next_entity_id);
+            }
+        }
+        else {
+            // Take an ID from the front of the free list
+            id = PopFreeEntity();
+        }
+
+        m_slots[id].alive_index = static_cast<Uint32>(m_alive_entities.size());
+        m_alive_entities.push_back(id);
 
         return id;
     }
@@ -85,39 +188,116 @@ namespace HBE::Application::Managers {
      * @throw std::out_of_range if the entity ID is out of range.
      */
     void EntityManager::DestroyEntity(EntityID entity) {
-        if (entity < 0 || entity >= MAX_ENTITIES) {
+        if (entity < 0 || entity >= m_entity_limit) {
             LOG_CORE(LoggingType::ERROR, "Entity out of range.");
             return;
         }
 
         // If the entity is not alive, return
-        if (!m_alive_entities[entity])
+        if (!IsAlive(entity))
             return;
 
         LOG_CORE(LoggingType::DEBUG, "Destroying EntityID \"" + std::to_string(entity) + "\"");
 
+        ReleaseEntity(entity);
+
+        LOG_CORE(LoggingType::INFO, "Entity \"" + std::to_string(entity) + "\" destroyed.");
+        LOG_CORE(LoggingType::DEBUG, "\tLiving Entities: " + std::to_string(EntityCount()));
+        LOG_CORE(LoggingType::DEBUG, "\tAvailable Entities: " + std::to_string(m_entity_limit - EntityCount()));
+    }
+
+    /**
+     * @brief Destroys a batch of entities and makes their IDs available for reuse.
+     *
+     * @param entities The IDs of the entities to be destroyed.
+     */
+    void EntityManager::DestroyEntities(std::span<const EntityID> entities) {
+        size_t destroyed = 0;
+        for (EntityID entity : entities) {
+            if (entity >= 0 && entity < m_entity_limit && IsAlive(entity)) {
+                ReleaseEntity(entity);
+                destroyed++;
+            }
+        }
+
+        LOG_CORE(LoggingType::INFO, std::to_string(destroyed) + " entities destroyed.");
+        LOG_CORE(LoggingType::DEBUG, "\tLiving Entities: " + std::to_string(EntityCount()));
+    }
+
+    /**
+     * @brief Clears a living entity's signature, takes it out of the alive list and recycles its ID.
+     *
+     * @param entity The ID of a living entity.
+     */
+    void EntityManager::ReleaseEntity(EntityID entity) {
         // Invalidate the destroyed entity's signature
         m_signatures[entity].reset();
 
-        // Place the destroyed entity ID at the back of the queue
-        m_available_entities.push(entity);
-        m_alive_entities[entity] = false;
-        m_living_entity_count--;
+        // Fill the destroyed entity's place in the alive list with the last living entity
+        EntitySlot &slot = m_slots[entity];
+        EntityID last_entity = m_alive_entities.back();
+        m_alive_entities[slot.alive_index] = last_entity;
+        m_slots[last_entity].alive_index = slot.alive_index;
+        m_alive_entities.pop_back();
 
-        LOG_CORE(LoggingType::INFO, "Entity \"" + std::to_string(entity) + "\" destroyed.");
-        LOG_CORE(LoggingType::DEBUG, "\tLiving Entities: " + std::to_string(m_living_entity_count));
-        LOG_CORE(LoggingType::DEBUG, "\tAvailable Entities: " + std::to_string(m_available_entities.size()));
+        // Invalidate handles to the destroyed entity
+        slot.alive_index = NO_ENTITY;
+        slot.generation++;
+
+        // Place the destroyed entity ID at the back of the free list
+        PushFreeEntity(entity);
     }
 
     void EntityManager::DestroyAllEntities() {
         LOG_CORE(LoggingType::DEBUG, "Destroying all entities.");
 
-        // Re-initialize the entity queue
+        // Re-initialize the entity free list
         InitializeEntities();
 
         LOG_CORE(LoggingType::INFO, "All entities destroyed.");
-        LOG_CORE(LoggingType::DEBUG, "\tLiving Entities: " + std::to_string(m_living_entity_count));
-        LOG_CORE(LoggingType::DEBUG, "\tAvailable Entities: " + std::to_string(m_available_entities.size()));
+        LOG_CORE(LoggingType::DEBUG, "\tLiving Entities: " + std::to_string(EntityCount()));
+        LOG_CORE(LoggingType::DEBUG, "\tAvailable Entities: " + std::to_string(m_entity_limit));
+    }
+
+    /**
+     * @brief Copies the bookkeeping of every entity.
+     *
+     * @return Snapshot that RestoreSnapshot() can bring back.
+     */
+    EntityManager::Snapshot EntityManager::CaptureSnapshot() const {
+        return Snapshot{m_slots, m_alive_entities, m_free_head, m_free_tail, m_next_entity_id, m_entity_limit,
+                        m_signatures};
+    }
+
+    /**
+     * @brief Replaces every entity with the entities of a snapshot.
+     *
+     * @param snapshot Snapshot taken by CaptureSnapshot().
+     */
+    void EntityManager::RestoreSnapshot(const Snapshot &snapshot) {
+        std::vector<EntitySlot> slots = snapshot.slots;
+        slots.resize(std::max(slots.size(), m_slots.size()));
+
+        // An ID that isn't alive in the snapshot keeps the newest generation, so handles to entities created after the
+        // snapshot was taken don't become valid again
+        for (size_t entity = 0; entity < m_slots.size(); entity++) {
+            const EntitySlot &current = m_slots[entity];
+            EntityGeneration generation = current.generation + (current.alive_index != NO_ENTITY ? 1 : 0);
+
+            if (slots[entity].alive_index == NO_ENTITY) {
+                slots[entity].generation = std::max(slots[entity].generation, generation);
+            }
+        }
+
+        m_slots = std::move(slots);
+        m_alive_entities = snapshot.alive_entities;
+        m_free_head = snapshot.free_head;
+        m_free_tail = snapshot.free_tail;
+        m_next_entity_id = snapshot.next_entity_id;
+        m_entity_limit = snapshot.entity_limit;
+        m_signatures = snapshot.signatures;
+
+        LOG_CORE(LoggingType::DEBUG, "Restored " + std::to_string(EntityCount()) + " entities from a snapshot.");
     }
 
     /**
@@ -130,12 +310,16 @@ namespace HBE::Application::Managers {
      * @throw std::out_of_range if the entity ID is out of range.
      */
     Signature EntityManager::SetSignature(EntityID entity, ComponentID component_id, bool value) {
-        if (entity < 0 || entity >= MAX_ENTITIES) {
+        if (entity < 0 || entity >= m_entity_limit) {
             std::out_of_range ex = std::out_of_range("Entity out of range.");
             LOG_CORE(LoggingType::ERROR, ex.what());
             throw ex;
         }
 
+        if (static_cast<size_t>(entity) >= m_signatures.size()) {
+            m_signatures.resize(entity + 1);
+        }
+
         // Set the signature for the given entity
         m_signatures[entity].set(component_id, value);
 
@@ -147,6 +331,35 @@ namespace HBE::Application::Managers {
         return m_signatures[entity];
     }
 
+    /**
+     * Replaces the signature for a given entity.
+     *
+     * @param entity The ID of the entity to set the signature for.
+     * @param signature The new signature.
+     * @return The signature of the entity.
+     * @throw std::out_of_range if the entity ID is out of range.
+     */
+    Signature EntityManager::SetSignature(EntityID entity, const Signature &signature) {
+        if (entity < 0 || entity >= m_entity_limit) {
+            std::out_of_range ex = std::out_of_range("Entity out of range.");
+            LOG_CORE(LoggingType::ERROR, ex.what());
+            throw ex;
+        }
+
+        if (static_cast<size_t>(entity) >= m_signatures.size()) {
+            m_signatures.resize(entity + 1);
+        }
+
+        m_signatures[entity] = signature;
+
+        LOG_CORE(LoggingType::DEBUG, "Entity \"" + std::to_string(entity) +
+                                         "\""
+                                         " signature set \"" +
+                                         m_signatures[entity].to_string() + "\"");
+
+        return m_signatures[entity];
+    }
+
     /**
      * Retrieves the signature associated with a given entity.
      *
@@ -155,13 +368,19 @@ namespace HBE::Application::Managers {
      * @throw std::out_of_range if the entity ID is out of range.
      */
     const Signature &EntityManager::GetSignature(EntityID entity) const {
-        if (entity < 0 || entity >= MAX_ENTITIES) {
+        if (entity < 0 || entity >= m_entity_limit) {
             std::out_of_range ex = std::out_of_range("Entity out of range.");
             LOG_CORE(LoggingType::ERROR, ex.what());
             throw ex;
         }
 
-        return m_signatures.at(entity);
+        // IDs that haven't been handed out yet have no components
+        static const Signature empty_signature;
+        if (static_cast<size_t>(entity) >= m_signatures.size()) {
+            return empty_signature;
+        }
+
+        return m_signatures[entity];
     }
 
     /**
@@ -185,24 +404,102 @@ namespace HBE::Application::Managers {
      *
      * @return EntityID count
      */
-    EntityID EntityManager::EntityCount() const { return m_living_entity_count; }
+    EntityID EntityManager::EntityCount() const { return static_cast<EntityID>(m_alive_entities.size()); }
 
-    std::vector<EntityID> EntityManager::GetAllEntities() {
-        std::vector<EntityID> entities;
-        entities.reserve(m_living_entity_count);
+    std::vector<EntityID> EntityManager::GetAllEntities() { return m_alive_entities; }
+
+    /**
+     * @brief Checks if an entity ID is currently in use
+     *
+     * @param entity EntityID to check
+     * @return true if the entity is alive
+     */
+    bool EntityManager::IsAlive(EntityID entity) const {
+        return entity >= 0 && static_cast<size_t>(entity) < m_slots.size() &&
+               m_slots[entity].alive_index != NO_ENTITY;
+    }
+
+    /**
+     * @brief Get a handle to a living entity
+     *
+     * @param entity EntityID to get a handle for
+     * @return EntityHandle with the entity's current generation, or a null handle if the entity isn't alive
+     */
+    EntityHandle EntityManager::GetHandle(EntityID entity) const {
+        if (!IsAlive(entity)) {
+            return EntityHandle{};
+        }
+
+        return EntityHandle{static_cast<Uint32>(entity), m_slots[entity].generation};
+    }
+
+    /**
+     * @brief Checks if a handle still refers to a living entity
+     *
+     * @param handle Handle to check
+     * @return false if the handle is null or its entity was destroyed
+     */
+    bool EntityManager::IsValid(EntityHandle handle) const {
+        return !handle.IsNull() && IsAlive(handle.GetID()) && m_slots[handle.index].generation == handle.generation;
+    }
+
+    /**
+     * @brief Get the current limit on the number of entities
+     *
+     * @return Entity IDs are always below this value
+     */
+    EntityID EntityManager::GetEntityLimit() const { return m_entity_limit; }
+
+    /**
+     * @brief Change the limit on the number of entities
+     *
+     * Raising the limit doesn't allocate anything, new IDs are handed out as they are needed. Lowering the limit drops
+     * unused IDs at or above the new limit.
+     *
+     * @param entity_limit New limit
+     * @return False if a living entity's ID is at or above the new limit
+     */
+    bool EntityManager::SetEntityLimit(EntityID entity_limit) {
+        if (entity_limit < 0) {
+            LOG_CORE(LoggingType::WARNING, "Entity limit can't be negative.");
+            return false;
+        }
 
-        size_t count = 0;
-        for (EntityID entity_id = 0; entity_id < MAX_ENTITIES; entity_id++) {
-            if (m_alive_entities[entity_id]) {
-                entities.push_back(entity_id);
-                count++;
+        // Handles store the ID in 32 bits
+        if (entity_limit > static_cast<EntityID>(NO_ENTITY)) {
+            LOG_CORE(LoggingType::WARNING, "Entity limit can't be above " + std::to_string(NO_ENTITY) + ".");
+            return false;
+        }
+
+        for (EntityID entity_id : m_alive_entities) {
+            if (entity_id >= entity_limit) {
+                LOG_CORE(LoggingType::WARNING, "Can't lower entity limit to " + std::to_string(entity_limit) +
+                                                   ", EntityID \"" + std::to_string(entity_id) + "\" is alive.");
+                return false;
             }
+        }
 
-            if (count == m_living_entity_count) {
-                break;
+        // Drop recycled IDs that are no longer valid
+        if (entity_limit < m_entity_limit) {
+            std::vector<EntityID> available_entities;
+            while (m_free_head != NO_ENTITY) {
+                EntityID entity_id = PopFreeEntity();
+                if (entity_id < entity_limit) {
+                    available_entities.push_back(entity_id);
+                }
             }
+
+            for (EntityID entity_id : available_entities) {
+                PushFreeEntity(entity_id);
+            }
+
+            m_next_entity_id = std::min(m_next_entity_id, entity_limit);
+            m_signatures.resize(std::min(m_signatures.size(), static_cast<size_t>(entity_limit)));
         }
 
-        return entities;
+        LOG_CORE(LoggingType::INFO, "Entity limit set to " + std::to_string(entity_limit));
+
+        m_entity_limit = entity_limit;
+        return true;
     }
 } // namespace HBE::Application::Managers
\ No newline at end of file
@@ -0,0 +1,231 @@
+/**
+ * @file job_manager.cpp
+ * @author Daniel Parker (DParker13)
+ * @brief Runs jobs on a fixed pool of worker threads.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include <HotBeanEngine/application/managers/job_manager.hpp>
+
+namespace HBE::Application::Managers {
+    namespace {
+        // Set on worker threads so jobs scheduled from inside a job go to that worker's own queue
+        thread_local const JobManager *t_owner = nullptr;
+        thread_local size_t t_worker_index = 0;
+    } // namespace
+
+    JobManager::JobManager(size_t worker_count) {
+        if (worker_count == 0) {
+            unsigned int hardware_threads = std::thread::hardware_concurrency();
+            worker_count = hardware_threads > 1 ? hardware_threads - 1 : 1;
+        }
+
+        m_worker_queues.reserve(worker_count);
+        for (size_t i = 0; i < worker_count; i++) {
+            m_worker_queues.push_back(std::make_unique<WorkerQueue>());
+        }
+
+        m_workers.reserve(worker_count);
+        for (size_t i = 0; i < worker_count; i++) {
+            m_workers.emplace_back(&JobManager::WorkerLoop, this, i);
+        }
+    }
+
+    JobManager::~JobManager() {
+        {
+            std::lock_guard<std::mutex> lock(m_sleep_mutex);
+            m_stopping = true;
+        }
+        m_wake_condition.notify_all();
+
+        for (std::thread &worker : m_workers) {
+            worker.join();
+        }
+    }
+
+    JobHandle JobManager::Schedule(std::function<void()> task) { return Schedule(std::move(task), {}); }
+
+    JobHandle JobManager::Schedule(std::function<void()> task, const std::vector<JobHandle> &dependencies) {
+        auto job = std::make_shared<Job>(std::move(task));
+
+        for (const JobHandle &dependency : dependencies) {
+            if (!dependency.m_job) {
+                continue;
+            }
+
+            // The dependency can finish at any moment, only wait on it if it hasn't released its continuations yet
+            std::lock_guard<std::mutex> lock(dependency.m_job->m_mutex);
+            if (!dependency.m_job->m_finished.load(std::memory_order_acquire)) {
+                job->m_remaining_dependencies.fetch_add(1, std::memory_order_relaxed);
+                dependency.m_job->m_continuations.push_back(job);
+            }
+        }
+
+        // Drop the scheduling hold, queues the job now if every dependency already finished
+        if (job->m_remaining_dependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            Enqueue(job);
+        }
+
+        return JobHandle(job);
+    }
+
+    JobHandle JobManager::Then(const JobHandle &dependency, std::function<void()> task) {
+        return Schedule(std::move(task), {dependency});
+    }
+
+    void JobManager::Wait(const JobHandle &handle) {
+        while (!handle.IsComplete()) {
+            if (!RunPendingJob()) {
+                std::this_thread::yield();
+            }
+        }
+
+        if (handle.m_job && handle.m_job->m_exception) {
+            std::rethrow_exception(handle.m_job->m_exception);
+        }
+    }
+
+    void JobManager::Wait(const std::vector<JobHandle> &handles) {
+        WaitIgnoringErrors(handles);
+
+        for (const JobHandle &handle : handles) {
+            if (handle.m_job && handle.m_job->m_exception) {
+                std::rethrow_exception(handle.m_job->m_exception);
+            }
+        }
+    }
+
+    void JobManager::WaitIgnoringErrors(const std::vector<JobHandle> &handles) {
+        for (const JobHandle &handle : handles) {
+            while (!handle.IsComplete()) {
+                if (!RunPendingJob()) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    }
+
+    size_t JobManager::GetWorkerCount() const { return m_workers.size(); }
+
+    bool JobManager::IsWorkerThread() const { return t_owner == this; }
+
+    void JobManager::WorkerLoop(size_t worker_index) {
+        t_owner = this;
+        t_worker_index = worker_index;
+
+        while (true) {
+            if (RunPendingJob()) {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(m_sleep_mutex);
+            m_wake_condition.wait(lock, [this]() { return m_stopping || m_queued_jobs.load() > 0; });
+
+            // Keep draining queued jobs after a stop is requested so nothing waiting on them hangs
+            if (m_stopping && m_queued_jobs.load() == 0) {
+                break;
+            }
+        }
+
+        t_owner = nullptr;
+    }
+
+    void JobManager::Enqueue(std::shared_ptr<Job> job) {
+        WorkerQueue &queue = IsWorkerThread() ? *m_worker_queues[t_worker_index] : m_shared_queue;
+
+        // Counted before it's visible so the count never drops below the number of queued jobs
+        m_queued_jobs.fetch_add(1);
+
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.jobs.push_back(std::move(job));
+        }
+
+        // Take the sleep lock so a worker between checking the count and sleeping can't miss the wake up
+        { std::lock_guard<std::mutex> lock(m_sleep_mutex); }
+        m_wake_condition.notify_one();
+    }
+
+    std::shared_ptr<Job> JobManager::Dequeue() {
+        const size_t worker_count = m_worker_queues.size();
+        const bool is_worker = IsWorkerThread();
+
+        // Own queue first, newest job first since its data is most likely still in cache
+        if (is_worker) {
+            WorkerQueue &own_queue = *m_worker_queues[t_worker_index];
+            std::lock_guard<std::mutex> lock(own_queue.mutex);
+            if (!own_queue.jobs.empty()) {
+                std::shared_ptr<Job> job = std::move(own_queue.jobs.back());
+                own_queue.jobs.pop_back();
+                return job;
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_shared_queue.mutex);
+            if (!m_shared_queue.jobs.empty()) {
+                std::shared_ptr<Job> job = std::move(m_shared_queue.jobs.front());
+                m_shared_queue.jobs.pop_front();
+                return job;
+            }
+        }
+
+        // Steal the oldest job from another worker, starting with the next worker along to spread out contention
+        const size_t start = is_worker ? t_worker_index + 1 : 0;
+        for (size_t i = 0; i < worker_count; i++) {
+            WorkerQueue &victim = *m_worker_queues[(start + i) % worker_count];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.jobs.empty()) {
+                std::shared_ptr<Job> job = std::move(victim.jobs.front());
+                victim.jobs.pop_front();
+                return job;
+            }
+        }
+
+        return nullptr;
+    }
+
+    bool JobManager::RunPendingJob() {
+        if (m_queued_jobs.load() == 0) {
+            return false;
+        }
+
+        std::shared_ptr<Job> job = Dequeue();
+        if (!job) {
+            return false;
+        }
+
+        m_queued_jobs.fetch_sub(1);
+        Execute(job);
+
+        return true;
+    }
+
+    void JobManager::Execute(const std::shared_ptr<Job> &job) {
+        try {
+            job->m_task();
+        }
+        catch (...) {
+            job->m_exception = std::current_exception();
+        }
+
+        // Release the task's captures now rather than when the last handle goes away
+        job->m_task = nullptr;
+
+        std::vector<std::shared_ptr<Job>> continuations;
+        {
+            std::lock_guard<std::mutex> lock(job->m_mutex);
+            job->m_finished.store(true, std::memory_order_release);
+            continuations.swap(job->m_continuations);
+        }
+
+        for (std::shared_ptr<Job> &continuation : continuations) {
+            if (continuation->m_remaining_dependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                Enqueue(std::move(continuation));
+            }
+        }
+    }
+} // namespace HBE::Application::Managers
\ No newline at end of file
@@ -36,6 +36,8 @@ namespace HBE::Application::Managers {
             return;
         }
 
+        std::lock_guard<std::mutex> lock(m_log_mutex);
+
         std::stringstream final_message;
         std::time_t t = std::time(nullptr);
         std::tm *now = std::localtime(&t);
@@ -150,12 +152,14 @@ namespace HBE::Application::Managers {
     }
 
     void LoggingManager::RegisterLogListener(ILogListener *listener) {
+        std::lock_guard<std::mutex> lock(m_log_mutex);
         if (listener && std::find(m_log_listeners.begin(), m_log_listeners.end(), listener) == m_log_listeners.end()) {
             m_log_listeners.push_back(listener);
         }
     }
 
     void LoggingManager::UnregisterLogListener(ILogListener *listener) {
+        std::lock_guard<std::mutex> lock(m_log_mutex);
         m_log_listeners.erase(std::remove(m_log_listeners.begin(), m_log_listeners.end(), listener),
                               m_log_listeners.end());
     }
@@ -0,0 +1,57 @@
+/**
+ * @file prefab_manager.cpp
+ * @author Daniel Parker (DParker13)
+ * @brief Prefab manager for cooking and instantiating prefab assets.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include <HotBeanEngine/application/application.hpp>
+#include <HotBeanEngine/application/managers/prefab_manager.hpp>
+
+namespace HBE::Application::Managers {
+    using namespace Core;
+
+    PrefabManager::PrefabManager(std::unique_ptr<IPrefabCooker> cooker) : m_cooker(std::move(cooker)) {
+        assert(m_cooker && "Prefab cooker is null.");
+    }
+
+    const Prefab &PrefabManager::Load(const std::filesystem::path &filepath) {
+        const std::string key = GetKey(filepath);
+
+        auto it = m_prefabs.find(key);
+        if (it != m_prefabs.end()) {
+            return *it->second;
+        }
+
+        if (!m_cooker->FileExists(filepath)) {
+            LOG(LoggingType::ERROR, "Prefab file does not exist: " + filepath.string());
+            throw std::runtime_error("Prefab file does not exist: " + filepath.string());
+        }
+
+        std::unique_ptr<Prefab> prefab = std::make_unique<Prefab>(m_cooker->Cook(filepath));
+        LOG(LoggingType::INFO, "Cooked prefab \"" + filepath.string() + "\" with " +
+                                   std::to_string(prefab->NodeCount()) + " entities");
+
+        return *m_prefabs.emplace(key, std::move(prefab)).first->second;
+    }
+
+    std::vector<EntityID> PrefabManager::Instantiate(const std::filesystem::path &filepath, size_t count,
+                                                     EntityID parent) {
+        return g_ecs.InstantiatePrefab(Load(filepath), count, parent);
+    }
+
+    bool PrefabManager::IsLoaded(const std::filesystem::path &filepath) const {
+        return m_prefabs.find(GetKey(filepath)) != m_prefabs.end();
+    }
+
+    void PrefabManager::Unload(const std::filesystem::path &filepath) { m_prefabs.erase(GetKey(filepath)); }
+
+    void PrefabManager::UnloadAll() { m_prefabs.clear(); }
+
+    std::string PrefabManager::GetKey(const std::filesystem::path &filepath) {
+        return filepath.lexically_normal().generic_string();
+    }
+} // namespace HBE::Application::Managers
\ No newline at end of file
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include <HotBeanEngine/application/application.hpp>
 #include <HotBeanEngine/application/managers/render_manager.hpp>
 
@@ -5,10 +7,7 @@ namespace HBE::Application::Managers {
     using namespace Core;
     using namespace Components;
 
-    RenderManager::RenderManager(std::shared_ptr<CameraManager> camera_manager) : m_camera_manager(camera_manager) {
-        // Listen for changes to Texture and Transform2D components to track renderable entities
-        ListenForComponents({g_ecs.GetComponentID<Texture>(), g_ecs.GetComponentID<Transform2D>()});
-    }
+    RenderManager::RenderManager(std::shared_ptr<CameraManager> camera_manager) : m_camera_manager(camera_manager) {}
 
     /**
      * @brief Destructor. Cleans up all SDL_Texture layers.
@@ -40,30 +39,30 @@ namespace HBE::Application::Managers {
     /**
      * @brief Render each entity to its respective texture layer for each camera, then combine all layers on the screen.
      *
-     * Iterates over cached renderable entities and all active cameras, rendering each entity to the appropriate layer
-     * texture. Finally, all layers are rendered to the screen in order.
+     * Iterates over renderable entities in entity ID order and all active cameras, rendering each entity to the
+     * appropriate layer texture. Finally, all layers are rendered to the screen in order.
      */
     void RenderManager::OnRender() {
+        CollectRenderables();
+
         if (g_app.GetStateManager().IsState(ApplicationState::Playing)) {
             for (EntityID camera_entity : m_camera_manager->GetAllActiveCameras()) {
-                auto &camera = g_ecs.GetComponent<Camera>(camera_entity);
-                auto &camera_transform = g_ecs.GetComponent<Transform2D>(camera_entity);
-
-                // Use cached set instead of GetEntitiesWithComponents for performance
-                for (EntityID entity : m_renderable_entities) {
-                    auto &transform = g_ecs.GetComponent<Transform2D>(entity);
-                    auto &texture = g_ecs.GetComponent<Texture>(entity);
-                    RenderTextureToLayer(camera, camera_transform, transform, texture);
+                const auto &camera = g_ecs.GetComponent<const Camera>(camera_entity);
+                const auto &camera_transform = g_ecs.GetComponent<const Transform2D>(camera_entity);
+
+                for (const Renderable &renderable : m_renderables) {
+                    RenderTextureToLayer(camera, camera_transform, *renderable.transform, *renderable.texture);
                 }
             }
         }
         else {
-            // In editor, render all cached entities using the editor camera
-            for (EntityID entity : m_renderable_entities) {
-                auto &transform = g_ecs.GetComponent<Transform2D>(entity);
-                auto &texture = g_ecs.GetComponent<Texture>(entity);
-                RenderTextureToLayer(g_app.GetEditorGUI().GetEditorCamera(),
-                                     g_app.GetEditorGUI().GetEditorCameraTransform(), transform, texture);
+            // In editor, render all entities using the editor camera
+            const auto &editor_camera = g_app.GetEditorGUI().GetEditorCamera();
+            const auto &editor_camera_transform = g_app.GetEditorGUI().GetEditorCameraTransform();
+
+            for (const Renderable &renderable : m_renderables) {
+                RenderTextureToLayer(editor_camera, editor_camera_transform, *renderable.transform,
+                                     *renderable.texture);
             }
         }
 
@@ -90,21 +89,23 @@ namespace HBE::Application::Managers {
     std::map<int, SDL_Texture *> RenderManager::GetAllLayers() const { return m_layers; }
 
     /**
-     * @brief Called when a tracked component (Transform2D or Texture) is added to an entity.
-     * If entity has both required components, it's added to the renderable cache.
-     * @param component Pointer to the component that was added.
-     * @param entity The entity ID that gained a component.
+     * @brief Fills m_renderables with every entity that has a Transform2D and a Texture, in entity ID order.
+     *
+     * The view doesn't own the component storage, so games are free to group Transform2D or Texture themselves. Its
+     * order follows the storage, which moves entities around as components come and go, so the entities are sorted
+     * to keep overlapping sprites in the same order every frame.
      */
-    void RenderManager::OnComponentAdded(Core::IComponent *component, Core::EntityID entity) {
-        m_renderable_entities.insert(entity);
-    }
+    void RenderManager::CollectRenderables() {
+        m_renderables.clear();
 
-    /**
-     * @brief Called when a tracked component is removed from an entity.
-     * Removes entity from renderable cache.
-     * @param entity The entity ID that lost a component.
-     */
-    void RenderManager::OnComponentRemoved(Core::EntityID entity) { m_renderable_entities.erase(entity); }
+        g_ecs.View<const Transform2D, const Texture>().Each(
+            [this](EntityID entity, const Transform2D &transform, const Texture &texture) {
+                m_renderables.push_back({entity, &transform, &texture});
+            });
+
+        std::sort(m_renderables.begin(), m_renderables.end(),
+                  [](const Renderable &a, const Renderable &b) { return a.entity < b.entity; });
+    }
 
     /**
      * @brief Creates a texture layer for the entity's layer if it doesn't already exist.
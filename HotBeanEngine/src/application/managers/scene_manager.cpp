@@ -51,6 +51,9 @@ namespace HBE::Application::Managers {
         }
 
         m_current_scene->SetupScene();
+
+        // Apply anything the scene recorded into the command buffer before the first frame
+        g_ecs.Flush();
     }
 
     void SceneManager::UnloadScene(bool save_to_file) {
@@ -8,11 +8,21 @@
  * @copyright Copyright (c) 2025
  */
 
+#include <algorithm>
+
 #include <HotBeanEngine/application/managers/system_manager.hpp>
 
 namespace HBE::Application::Managers {
     using namespace Core;
 
+    namespace {
+        // Hands a signature change's scratch space back when it finishes, even if a callback throws
+        struct ScratchScope {
+            size_t &depth;
+            ~ScratchScope() { depth--; }
+        };
+    } // namespace
+
     SystemManager::~SystemManager() {
         for (auto &[name, system] : m_systems) {
             delete system;
@@ -31,15 +41,39 @@ namespace HBE::Application::Managers {
         LOG_CORE(LoggingType::DEBUG, "Destroying EntityID \"" + std::to_string(entity) + "\"");
 
         // Erase a destroyed entity from all system lists
-        // m_entities is a set so no check needed
-        for (auto &[type_name, system] : m_systems) {
-            erased_entities += static_cast<int>(system->m_entities.erase(entity));
+        // Remove is a no-op for systems that don't track the entity
+        for (SystemBase *system : m_systems_ordered) {
+            erased_entities += static_cast<int>(system->m_entities.Remove(entity));
         }
 
+        m_query_cache.EntityDestroyed(entity);
+
         LOG_CORE(LoggingType::DEBUG, "\tErased EntityID \"" + std::to_string(entity) + "\" from " +
                                          std::to_string(erased_entities) + " Systems");
     }
 
+    /**
+     * Erases a batch of entities that are about to be destroyed from every system and cached query.
+     *
+     * @param entities The IDs of the entities being destroyed.
+     */
+    void SystemManager::EntitiesDestroyed(std::span<const EntityID> entities) {
+        LOG_CORE(LoggingType::DEBUG, "Destroying " + std::to_string(entities.size()) + " entities");
+
+        for (SystemBase *system : m_systems_ordered) {
+            for (EntityID entity : entities) {
+                if (system->m_entities.Contains(entity)) {
+                    system->OnEntityRemoved(entity);
+                    system->m_entities.Remove(entity);
+                }
+            }
+        }
+
+        for (EntityID entity : entities) {
+            m_query_cache.EntityDestroyed(entity);
+        }
+    }
+
     /**
      * Notifies each system that an entity's signature has changed.
      *
@@ -48,31 +82,39 @@ namespace HBE::Application::Managers {
      *
      * This function iterates over each system and checks if the entity's new signature matches the system's signature.
      * If it does, the entity is added to the system's set of entities. If it does not, the entity is removed from the
-     * system's set of entities.
+     * system's set of entities. Every set is updated before any OnEntityAdded() or OnEntityRemoved() runs, so a
+     * callback that changes a signature again starts from the finished membership.
      */
     void SystemManager::EntitySignatureChanged(EntityID entity, Signature entity_signature) {
         int entity_added_to_systems = 0;
         int entity_removed_from_systems = 0;
 
-        // Notify each system that an entity's signature changed
-        for (auto &[type_name, system] : m_systems) {
-            auto const &system_signature = m_signatures[type_name];
+        SignatureChangeScratch &scratch = AcquireSignatureChangeScratch();
+        ScratchScope scope{m_signature_change_depth};
+
+        MatchSystemSignatures(entity_signature, scratch.matches);
+        m_query_cache.EntitySignatureChanged(entity, entity_signature);
+
+        // Only systems whose membership flips are told about the entity
+        for (size_t i = 0; i < m_systems_ordered.size(); i++) {
+            SystemBase *system = m_systems_ordered[i];
 
             // EntityID signature matches system signature - insert into set
-            if ((entity_signature & system_signature) == system_signature) {
-                if (system->m_entities.insert(entity).second) {
-                    system->OnEntityAdded(entity);
+            if (scratch.matches[i]) {
+                if (system->m_entities.Insert(entity)) {
+                    scratch.changes.push_back({system, entity, true});
                     entity_added_to_systems++;
                 }
             }
             // EntityID signature does not match system signature - erase from set
-            else if (system->m_entities.count(entity) > 0) {
-                system->OnEntityRemoved(entity);
-                system->m_entities.erase(entity);
+            else if (system->m_entities.Remove(entity)) {
+                scratch.changes.push_back({system, entity, false});
                 entity_removed_from_systems++;
             }
         }
 
+        DispatchMembershipChanges(scratch.changes);
+
         if (entity_added_to_systems > 0) {
             LOG_CORE(LoggingType::DEBUG, "\tAdded EntityID \"" + std::to_string(entity) + "\" to " +
                                              std::to_string(entity_added_to_systems) + " Systems");
@@ -84,38 +126,245 @@ namespace HBE::Application::Managers {
         }
     }
 
+    /**
+     * @brief Notifies each system that a batch of entities now share the same signature
+     *
+     * @param entities Entities whose signature has changed
+     * @param entity_signature The new signature shared by every entity in the batch
+     */
+    void SystemManager::EntitiesSignatureChanged(std::span<const EntityID> entities, Signature entity_signature) {
+        if (entities.empty()) {
+            return;
+        }
+
+        const EntityID largest_entity = *std::max_element(entities.begin(), entities.end());
+        int systems_matched = 0;
+
+        SignatureChangeScratch &scratch = AcquireSignatureChangeScratch();
+        ScratchScope scope{m_signature_change_depth};
+
+        MatchSystemSignatures(entity_signature, scratch.matches);
+        m_query_cache.EntitiesSignatureChanged(entities, entity_signature);
+
+        for (size_t i = 0; i < m_systems_ordered.size(); i++) {
+            SystemBase *system = m_systems_ordered[i];
+
+            // Signature matches - insert the whole batch into the set
+            if (scratch.matches[i]) {
+                system->m_entities.Reserve(system->m_entities.Size() + entities.size(), largest_entity);
+
+                for (EntityID entity : entities) {
+                    if (system->m_entities.Insert(entity)) {
+                        scratch.changes.push_back({system, entity, true});
+                    }
+                }
+
+                systems_matched++;
+            }
+            // Signature does not match - erase any entity the system was tracking
+            else {
+                for (EntityID entity : entities) {
+                    if (system->m_entities.Remove(entity)) {
+                        scratch.changes.push_back({system, entity, false});
+                    }
+                }
+            }
+        }
+
+        DispatchMembershipChanges(scratch.changes);
+
+        LOG_CORE(LoggingType::DEBUG, "\tAdded " + std::to_string(entities.size()) + " entities to " +
+                                         std::to_string(systems_matched) + " Systems");
+    }
+
+    /**
+     * @brief Takes the scratch space for a signature change, released by the ScratchScope that follows it
+     *
+     * @return Scratch space no signature change further up the call stack is using, with no changes in it
+     */
+    SystemManager::SignatureChangeScratch &SystemManager::AcquireSignatureChangeScratch() {
+        if (m_signature_change_depth == m_signature_changes.size()) {
+            m_signature_changes.emplace_back();
+        }
+
+        SignatureChangeScratch &scratch = m_signature_changes[m_signature_change_depth++];
+        scratch.changes.clear();
+        return scratch;
+    }
+
+    /**
+     * @brief Tests an entity's signature against every system signature
+     *
+     * Fills matches with 1 for each system whose signature is a subset of the entity's. The signatures are stored back
+     * to back and the loop has no branches, so the compiler can test several systems per instruction.
+     *
+     * @param entity_signature Signature to test
+     * @param matches Filled with one entry per system, in registration order
+     */
+    void SystemManager::MatchSystemSignatures(const Signature &entity_signature, std::vector<uint8_t> &matches) {
+        const size_t system_count = m_system_signatures.size();
+        matches.resize(system_count);
+
+        const Signature *system_signatures = m_system_signatures.data();
+        uint8_t *match = matches.data();
+
+        for (size_t i = 0; i < system_count; i++) {
+            match[i] = static_cast<uint8_t>(system_signatures[i].IsSubsetOf(entity_signature));
+        }
+    }
+
+    /**
+     * @brief Calls OnEntityAdded() or OnEntityRemoved() for each recorded membership change
+     *
+     * A callback earlier in the list can change the entity's signature again and move it back, the change is skipped
+     * then since the nested signature change already told the system.
+     *
+     * @param changes Changes in the order they were made
+     */
+    void SystemManager::DispatchMembershipChanges(std::span<const MembershipChange> changes) {
+        for (const MembershipChange &change : changes) {
+            if (change.system->m_entities.Contains(change.entity) != change.added) {
+                continue;
+            }
+
+            if (change.added) {
+                change.system->OnEntityAdded(change.entity);
+            } else {
+                change.system->OnEntityRemoved(change.entity);
+            }
+        }
+    }
+
     /**
      * @brief Iterates all systems and calls specific game loop method
      *
      * @param state Current game loop state
      */
     void SystemManager::IterateSystems(GameLoopState state) {
+        // Rendering, events and startup touch SDL so they always run on the main thread
+        bool parallel_phase = state == GameLoopState::OnFixedUpdate || state == GameLoopState::OnUpdate;
+
+        // The change tick moves forward after each system or stage, so a system never sees its own changes as new
+        // and changes made between its runs always are
+        if (m_parallel_execution && parallel_phase) {
+            for (const auto &stage : GetSystemStages()) {
+                RunSystemStage(stage, state);
+                m_component_manager->AdvanceChangeTick();
+            }
+            return;
+        }
+
         for (auto &system : m_systems_ordered) {
-            switch (state) {
-            case GameLoopState::OnStart:
-                system->OnStart();
-                break;
-            case GameLoopState::OnPreEvent:
-                system->OnPreEvent();
-                break;
-            case GameLoopState::OnFixedUpdate:
-                system->OnFixedUpdate();
-                break;
-            case GameLoopState::OnUpdate:
-                system->OnUpdate();
-                break;
-            case GameLoopState::OnRender:
-                system->OnRender();
-                break;
-            case GameLoopState::OnPostRender:
-                system->OnPostRender();
-                break;
-            default:
-                break;
+            RunSystem(system, state);
+            m_component_manager->AdvanceChangeTick();
+        }
+    }
+
+    /**
+     * @brief Calls a system's game loop method
+     *
+     * @param system System to run
+     * @param state Current game loop state
+     */
+    void SystemManager::RunSystem(SystemBase *system, GameLoopState state) {
+        system->BeginRun(state, m_component_manager->GetChangeTick());
+
+        switch (state) {
+        case GameLoopState::OnStart:
+            system->OnStart();
+            break;
+        case GameLoopState::OnPreEvent:
+            system->OnPreEvent();
+            break;
+        case GameLoopState::OnFixedUpdate:
+            system->OnFixedUpdate();
+            break;
+        case GameLoopState::OnUpdate:
+            system->OnUpdate();
+            break;
+        case GameLoopState::OnRender:
+            system->OnRender();
+            break;
+        case GameLoopState::OnPostRender:
+            system->OnPostRender();
+            break;
+        default:
+            break;
+        }
+    }
+
+    /**
+     * @brief Runs every system in a stage and waits for them to finish
+     *
+     * The first system runs on the calling thread, the rest on worker threads.
+     *
+     * @param stage Systems that don't conflict with each other
+     * @param state Current game loop state
+     */
+    void SystemManager::RunSystemStage(const std::vector<SystemBase *> &stage, GameLoopState state) {
+        if (stage.size() == 1 || !m_job_manager) {
+            for (SystemBase *system : stage) {
+                RunSystem(system, state);
+            }
+            return;
+        }
+
+        // The main thread runs the first system and helps with the rest while waiting, rethrows anything a job threw
+        auto run_system = [this, &stage, state](size_t index) { RunSystem(stage[index], state); };
+        m_job_manager->ParallelFor(0, stage.size(), run_system, 1);
+    }
+
+    /**
+     * @brief Groups the registered systems into stages
+     *
+     * Each system goes in the stage after the latest stage holding an earlier system it conflicts with. Exclusive
+     * systems conflict with everything so they always end up alone in their stage.
+     */
+    void SystemManager::BuildSystemStages() {
+        m_system_stages.clear();
+
+        std::vector<SystemAccess> accesses;
+        std::vector<size_t> system_stage_index;
+        accesses.reserve(m_systems_ordered.size());
+        system_stage_index.reserve(m_systems_ordered.size());
+
+        for (SystemBase *system : m_systems_ordered) {
+            SystemAccess access = system->GetComponentAccess();
+
+            size_t stage_index = 0;
+            for (size_t i = 0; i < accesses.size(); i++) {
+                if (access.ConflictsWith(accesses[i])) {
+                    stage_index = std::max(stage_index, system_stage_index[i] + 1);
+                }
+            }
+
+            if (stage_index >= m_system_stages.size()) {
+                m_system_stages.resize(stage_index + 1);
             }
+
+            m_system_stages[stage_index].push_back(system);
+            accesses.push_back(std::move(access));
+            system_stage_index.push_back(stage_index);
         }
+
+        m_system_stages_dirty = false;
+
+        LOG_CORE(LoggingType::DEBUG, "Scheduled " + std::to_string(m_systems_ordered.size()) + " Systems in " +
+                                         std::to_string(m_system_stages.size()) + " stages");
     }
 
+    const std::vector<std::vector<SystemBase *>> &SystemManager::GetSystemStages() {
+        if (m_system_stages_dirty) {
+            BuildSystemStages();
+        }
+
+        return m_system_stages;
+    }
+
+    void SystemManager::SetParallelExecution(bool enabled) { m_parallel_execution = enabled; }
+
+    bool SystemManager::IsParallelExecutionEnabled() const { return m_parallel_execution; }
+
     void SystemManager::IterateSystems(SDL_Event &event, GameLoopState state) {
 
         if (m_logging_manager->GetLoggingLevel() == LoggingType::DEBUG) {
@@ -129,6 +378,8 @@ namespace HBE::Application::Managers {
         }
 
         for (auto &system : m_systems_ordered) {
+            system->BeginRun(state, m_component_manager->GetChangeTick());
+
             switch (state) {
             case GameLoopState::OnEvent:
                 system->OnEvent(event);
@@ -139,6 +390,8 @@ namespace HBE::Application::Managers {
             default:
                 break;
             }
+
+            m_component_manager->AdvanceChangeTick();
         }
 
         if (m_logging_manager->GetLoggingLevel() == LoggingType::DEBUG) {
@@ -163,11 +416,34 @@ namespace HBE::Application::Managers {
         }
 
         LOG_CORE(LoggingType::DEBUG, "Unregistering System \"" + std::string(system->GetName()) + "\"");
-        RemoveSignature(system);
-        m_systems_ordered.erase(
-            std::remove(m_systems_ordered.begin(), m_systems_ordered.end(), m_systems[std::string(system->GetName())]),
-            m_systems_ordered.end());
+        EraseSystem(system);
+    }
+
+    /**
+     * @brief Removes a registered system and its signature without deleting it
+     *
+     * @param system Registered system to remove
+     */
+    void SystemManager::EraseSystem(SystemBase *system) {
+        size_t index = GetSystemIndex(system);
+
+        m_systems_ordered.erase(m_systems_ordered.begin() + index);
+        m_system_signatures.erase(m_system_signatures.begin() + index);
         m_systems.erase(std::string(system->GetName()));
+        m_system_stages_dirty = true;
+    }
+
+    /**
+     * @brief Finds a registered system's position in the registration order
+     *
+     * @param system Registered system
+     * @return Index into m_systems_ordered and m_system_signatures
+     */
+    size_t SystemManager::GetSystemIndex(SystemBase *system) const {
+        auto it = std::find(m_systems_ordered.begin(), m_systems_ordered.end(), system);
+        assert(it != m_systems_ordered.end() && "System is not registered");
+
+        return static_cast<size_t>(it - m_systems_ordered.begin());
     }
 
     bool SystemManager::IsSystemRegistered(SystemBase *system) {
@@ -178,19 +454,53 @@ namespace HBE::Application::Managers {
         return m_systems.find(std::string(system->GetName())) != m_systems.end();
     }
 
-    void SystemManager::RemoveSignature(SystemBase *system) {
-        if (!system) {
-            return;
+    void SystemManager::RemoveAllEntities() {
+        for (SystemBase *system : m_systems_ordered) {
+            for (EntityID entity : system->m_entities) {
+                system->OnEntityRemoved(entity);
+            }
+
+            system->m_entities.Clear();
         }
 
-        if (!IsSystemRegistered(system)) {
-            LOG_CORE(LoggingType::WARNING, "System is not registered");
-            return;
+        m_query_cache.ClearEntities();
+    }
+
+    SystemManager::Snapshot SystemManager::CaptureSnapshot() const {
+        Snapshot snapshot;
+        snapshot.systems.reserve(m_systems_ordered.size());
+
+        for (size_t i = 0; i < m_systems_ordered.size(); i++) {
+            SystemBase *system = m_systems_ordered[i];
+            snapshot.systems.push_back({std::string(system->GetName()), m_system_signatures[i], system->m_entities});
         }
 
-        LOG_CORE(LoggingType::DEBUG, "System \"" + std::string(system->GetName()) + "\" Signature removed");
+        return snapshot;
+    }
+
+    bool SystemManager::RestoreSnapshot(const Snapshot &snapshot) {
+        bool restored_all = true;
+
+        for (size_t i = 0; i < m_systems_ordered.size(); i++) {
+            SystemBase *system = m_systems_ordered[i];
+
+            auto saved = std::find_if(snapshot.systems.begin(), snapshot.systems.end(),
+                                      [system](const Snapshot::SystemEntities &saved_system) {
+                                          return saved_system.name == system->GetName();
+                                      });
+
+            if (saved == snapshot.systems.end() || saved->signature != m_system_signatures[i]) {
+                restored_all = false;
+                continue;
+            }
+
+            system->m_entities = saved->entities;
+            for (EntityID entity : system->m_entities) {
+                system->OnEntityAdded(entity);
+            }
+        }
 
-        m_signatures.erase(std::string(system->GetName()));
+        return restored_all;
     }
 
     std::vector<SystemBase *> SystemManager::GetAllSystems() { return m_systems_ordered; }
@@ -222,7 +532,7 @@ namespace HBE::Application::Managers {
                                          signature.to_string() + "\"");
 
         // Set the signature for this system
-        m_signatures.insert({system_name, signature});
+        m_system_signatures[GetSystemIndex(system)] = signature;
     }
 
     Signature &SystemManager::GetSignature(SystemBase *system) {
@@ -230,6 +540,6 @@ namespace HBE::Application::Managers {
         assert(IsSystemRegistered(system) && "System is not registered");
 
         // Get the signature for this system
-        return m_signatures[std::string(system->GetName())];
+        return m_system_signatures[GetSystemIndex(system)];
     }
 } // namespace HBE::Application::Managers
\ No newline at end of file
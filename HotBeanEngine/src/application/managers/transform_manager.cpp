@@ -13,11 +13,13 @@ namespace HBE::Application::Managers {
         m_scene_graph.AddEntity(entity, transform->m_parent);
     }
 
-    void TransformManager::OnComponentRemoved(EntityID entity) {
+    void TransformManager::OnComponentRemoved(ComponentID, EntityID entity) {
         // When a Transform2D is removed, remove the entity from the scene graph
         m_scene_graph.RemoveEntity(entity);
     }
 
+    void TransformManager::OnAllComponentsRemoved(ComponentID, std::span<const EntityID>) { m_scene_graph.Clear(); }
+
     void TransformManager::OnUpdate() {
 
         // If not playing, also propagate transforms for editor camera to ensure it moves properly in the editor
@@ -25,20 +27,29 @@ namespace HBE::Application::Managers {
             PropagateTransforms(g_app.GetEditorGUI().GetEditorCameraTransform(), nullptr);
         }
 
+        JobManager &job_manager = g_app.GetJobManager();
+
         // Iterate through all levels and propagate transforms
+        // Levels run in order so parents are done first, entities within a level only write their own transform
         for (auto &level : m_scene_graph.GetAllLevels()) {
-            for (auto &entity : level.second) {
-                auto &transform = g_ecs.GetComponent<Transform2D>(entity);
+            m_level_entities.assign(level.second.begin(), level.second.end());
+
+            auto propagate = [this](size_t index) {
+                auto &transform = g_ecs.GetComponent<Transform2D>(m_level_entities[index]);
 
                 // Get parent transform if it exists
                 const Transform2D *parent_transform = nullptr;
                 if (transform.m_parent != -1) {
-                    parent_transform = &g_ecs.GetComponent<Transform2D>(transform.m_parent);
+                    parent_transform = &g_ecs.GetComponent<const Transform2D>(transform.m_parent);
                 }
 
                 // Propagate transforms
                 PropagateTransforms(transform, parent_transform);
-            }
+            };
+
+            size_t chunk_size =
+                ParallelChunkSize(m_level_entities.size(), sizeof(Transform2D), job_manager.GetWorkerCount() + 1);
+            job_manager.ParallelFor(0, m_level_entities.size(), propagate, chunk_size);
         }
     }
 
@@ -37,22 +37,14 @@ namespace HBE::Components {
         in.Read("world_position", m_world_position);
         in.Read("world_rotation", m_world_rotation);
         in.Read("world_scale", m_world_scale);
-
-        MarkDirty();
     }
 
     void Transform2D::RenderProperties(int &id) {
-        bool changed = false;
-
-        changed |= Int::RenderProperty(id, "Layer", reinterpret_cast<int &>(m_layer));
-        changed |= Int::RenderProperty(id, "Parent", reinterpret_cast<int &>(m_parent), -1);
+        Int::RenderProperty(id, "Layer", reinterpret_cast<int &>(m_layer));
+        Int::RenderProperty(id, "Parent", reinterpret_cast<int &>(m_parent), -1);
         ImGui::Separator();
-        changed |= Vec2::RenderProperty(id, "Local Position", m_local_position);
-        changed |= Float::RenderProperty(id, "Local Rotation", m_local_rotation);
-        changed |= Vec2::RenderProperty(id, "Local Scale", m_local_scale);
-
-        if (changed) {
-            MarkDirty();
-        }
+        Vec2::RenderProperty(id, "Local Position", m_local_position);
+        Float::RenderProperty(id, "Local Rotation", m_local_rotation);
+        Vec2::RenderProperty(id, "Local Scale", m_local_scale);
     }
 } // namespace HBE::Components
\ No newline at end of file
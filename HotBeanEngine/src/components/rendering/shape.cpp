@@ -30,14 +30,8 @@ namespace HBE::Components {
     }
 
     void Shape::RenderProperties(int &id) {
-        bool changed = false;
-
-        changed |= Bool::RenderProperty(id, "Filled", m_filled);
-        changed |= Vec2::RenderProperty(id, "Size", m_size, {0.0f, 0.0f});
-        changed |= Color::RenderProperty(id, "Color", m_color);
-
-        if (changed) {
-            MarkDirty();
-        }
+        Bool::RenderProperty(id, "Filled", m_filled);
+        Vec2::RenderProperty(id, "Size", m_size, {0.0f, 0.0f});
+        Color::RenderProperty(id, "Color", m_color);
     }
 } // namespace HBE::Components
\ No newline at end of file
@@ -10,26 +10,76 @@
 
 #include <HotBeanEngine/components/rendering/texture.hpp>
 
+#include <utility>
+
 #include <HotBeanEngine/editor/property_nodes/texture_preview.hpp>
 #include <HotBeanEngine/editor/property_nodes/vec2.hpp>
 
 namespace HBE::Components {
     using namespace GUI::PropertyNodes;
 
+    Texture::Texture(Texture &&other) noexcept
+        : m_texture(std::exchange(other.m_texture, nullptr)), m_size(other.m_size) {}
+
+    Texture &Texture::operator=(Texture &&other) noexcept {
+        if (this != &other) {
+            if (m_texture) {
+                SDL_DestroyTexture(m_texture);
+            }
+
+            m_texture = std::exchange(other.m_texture, nullptr);
+            m_size = other.m_size;
+        }
+
+        return *this;
+    }
+
     Texture::~Texture() {
         if (m_texture) {
             SDL_DestroyTexture(m_texture);
         }
     }
 
+    Texture Texture::Clone() const {
+        Texture clone;
+        clone.m_size = m_size;
+
+        if (!m_texture) {
+            return clone;
+        }
+
+        SDL_Renderer *renderer = SDL_GetRendererFromTexture(m_texture);
+        float width = 0.0f;
+        float height = 0.0f;
+        SDL_GetTextureSize(m_texture, &width, &height);
+
+        clone.m_texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                            static_cast<int>(width), static_cast<int>(height));
+        if (!clone.m_texture) {
+            return clone;
+        }
+
+        SDL_BlendMode blend_mode = SDL_BLENDMODE_BLEND;
+        SDL_GetTextureBlendMode(m_texture, &blend_mode);
+        SDL_SetTextureBlendMode(clone.m_texture, blend_mode);
+
+        // Draw the pixels over unblended, then put back whatever the renderer was drawing to
+        SDL_Texture *previous_target = SDL_GetRenderTarget(renderer);
+        SDL_SetRenderTarget(renderer, clone.m_texture);
+        SDL_SetTextureBlendMode(m_texture, SDL_BLENDMODE_NONE);
+        SDL_RenderTexture(renderer, m_texture, nullptr, nullptr);
+        SDL_SetTextureBlendMode(m_texture, blend_mode);
+        SDL_SetRenderTarget(renderer, previous_target);
+
+        return clone;
+    }
+
     void Texture::Serialize(Core::ISerializationWriter &out) const { out.Write("size", m_size); }
 
     void Texture::Deserialize(Core::ISerializationReader &in) { in.Read("size", m_size); }
 
     void Texture::RenderProperties(int &id) {
-        if (Vec2::RenderProperty(id, "Size", m_size, {0.0f, 0.0f})) {
-            MarkDirty();
-        }
+        Vec2::RenderProperty(id, "Size", m_size, {0.0f, 0.0f});
 
         TexturePreview::RenderProperty(id, "Texture Preview", m_texture);
     }
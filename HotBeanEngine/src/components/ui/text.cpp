@@ -25,7 +25,6 @@ namespace HBE::Components {
         in.Read("size", m_size);
         in.Read("style", m_style);
         in.Read("wrapping_width", m_wrapping_width);
-        MarkDirty();
     }
 
     void Text::Serialize(Core::ISerializationWriter &out) const {
@@ -40,23 +39,16 @@ namespace HBE::Components {
     }
 
     void Text::RenderProperties(int &id) {
-        bool changed = false;
-
-        changed |= String::RenderProperty(id, "Text", m_text);
-        changed |= Color::RenderProperty(id, "Foreground Color", m_foreground_color);
-        changed |= Color::RenderProperty(id, "Background Color", m_background_color);
-        changed |= Enum::RenderProperty(id, "Font Style", m_style,
-                                        {{TTF_STYLE_NORMAL, "Normal"},
-                                         {TTF_STYLE_BOLD, "Bold"},
-                                         {TTF_STYLE_ITALIC, "Italic"},
-                                         {TTF_STYLE_UNDERLINE, "Underline"},
-                                         {TTF_STYLE_STRIKETHROUGH, "Strikethrough"}});
-        changed |= Int::RenderProperty(id, "Font Size", reinterpret_cast<int &>(m_size));
-        changed |= Int::RenderProperty(id, "Wrapping Width", reinterpret_cast<int &>(m_wrapping_width));
-
-        // Mark texture as dirty if any property changed
-        if (changed) {
-            MarkDirty();
-        }
+        String::RenderProperty(id, "Text", m_text);
+        Color::RenderProperty(id, "Foreground Color", m_foreground_color);
+        Color::RenderProperty(id, "Background Color", m_background_color);
+        Enum::RenderProperty(id, "Font Style", m_style,
+                             {{TTF_STYLE_NORMAL, "Normal"},
+                              {TTF_STYLE_BOLD, "Bold"},
+                              {TTF_STYLE_ITALIC, "Italic"},
+                              {TTF_STYLE_UNDERLINE, "Underline"},
+                              {TTF_STYLE_STRIKETHROUGH, "Strikethrough"}});
+        Int::RenderProperty(id, "Font Size", reinterpret_cast<int &>(m_size));
+        Int::RenderProperty(id, "Wrapping Width", reinterpret_cast<int &>(m_wrapping_width));
     }
 } // namespace HBE::Components
\ No newline at end of file
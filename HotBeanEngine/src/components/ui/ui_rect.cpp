@@ -64,7 +64,6 @@ namespace HBE::Components {
         in.Read("margin_right", m_margin_right);
         in.Read("margin_top", m_margin_top);
         in.Read("margin_bottom", m_margin_bottom);
-        MarkDirty();
     }
 
     void UIRect::RenderProperties(int &id) {
@@ -64,6 +64,10 @@ namespace HBE::GUI {
                 // Log to console changed
             }
 
+            if (ImGui::InputInt("Entity Limit", &m_entity_limit)) {
+                m_entity_limit = std::max(m_entity_limit, 0);
+            }
+
             if (ImGui::Button("Save")) {
                 SaveConfigToFile();
                 m_open = false;
@@ -85,6 +89,9 @@ namespace HBE::GUI {
         m_log_level = LOGGING_LEVEL;
         m_logging_directory = LOG_DIRECTORY;
         m_log_to_console = LOG_TO_CONSOLE;
+
+        // ECS
+        m_entity_limit = static_cast<int>(ENTITY_LIMIT);
     }
 
     void ConfigWindow::SaveConfigToFile() {
@@ -96,6 +103,12 @@ namespace HBE::GUI {
         g_app.SetLoggingLevel(m_log_level);
         LOG_TO_CONSOLE = m_log_to_console;
 
+        // ECS
+        // The limit can't be lowered below an entity that is still alive
+        if (g_ecs.SetEntityLimit(m_entity_limit)) {
+            ENTITY_LIMIT = m_entity_limit;
+        }
+
         SaveConfig();
     }
 } // namespace HBE::GUI
\ No newline at end of file
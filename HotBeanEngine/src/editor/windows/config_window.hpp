@@ -30,6 +30,7 @@ namespace HBE::GUI {
         std::filesystem::path m_startup_project;
         LoggingType m_log_level = LoggingType::DEBUG;
         std::filesystem::path m_logging_directory;
+        int m_entity_limit = static_cast<int>(MAX_ENTITIES);
 
     public:
         ConfigWindow() : IWindow("Config Settings", false, true) {}
@@ -15,6 +15,14 @@ namespace HBE::GUI {
     using namespace Core;
 
     void EntityWindow::RenderWindow() {
+        // The property window points into the selected entity's components, drop them once it's destroyed
+        if (!m_selected_entity.IsNull() && !g_ecs.IsEntityValid(m_selected_entity)) {
+            m_selected_entity = EntityHandle{};
+            if (m_property_window) {
+                m_property_window->SetProperties({});
+            }
+        }
+
         if (ImGui::Begin(m_name.c_str(), &m_open)) {
             int id = 0;
             for (auto &system : g_ecs.GetAllSystems()) {
@@ -39,17 +47,37 @@ namespace HBE::GUI {
     }
 
     void EntityWindow::EntitySelected(EntityID entity) {
+        m_selected_entity = g_ecs.GetEntityHandle(entity);
+
         if (m_property_window) {
             std::vector<std::pair<std::string, IPropertyRenderable *>> property_nodes;
-            for (IComponent *component : g_ecs.GetAllComponents(entity)) {
+            std::vector<ComponentID> property_component_ids;
+
+            // GetAllComponents() lists components in signature order, so the nth set bit is the nth component's ID
+            const Signature &signature = g_ecs.GetSignature(entity);
+            std::vector<IComponent *> components = g_ecs.GetAllComponents(entity);
+            ComponentID component_id = 0;
+
+            for (IComponent *component : components) {
+                while (!signature.test(component_id)) {
+                    component_id++;
+                }
+
                 IPropertyRenderable *renderable = dynamic_cast<IPropertyRenderable *>(component);
                 IName *nameable = dynamic_cast<IName *>(component);
 
                 if (renderable && nameable) {
                     property_nodes.push_back({std::string(nameable->GetName()), renderable});
+                    property_component_ids.push_back(component_id);
                 }
+
+                component_id++;
             }
-            m_property_window->SetProperties(property_nodes);
+
+            // Edits in the property window write straight into the component, so stamp it as changed for systems
+            m_property_window->SetProperties(property_nodes, [entity, property_component_ids](size_t index) {
+                g_ecs.MarkChanged(entity, property_component_ids[index]);
+            });
         }
         else {
             LOG(LoggingType::ERROR, "Property window was never setup.");
@@ -26,6 +26,9 @@ namespace HBE::GUI {
     private:
         std::shared_ptr<PropertyWindow> m_property_window = nullptr;
 
+        // Entity whose properties are shown, cleared once the entity is destroyed
+        Core::EntityHandle m_selected_entity;
+
     public:
         EntityWindow(std::shared_ptr<PropertyWindow> property_window)
             : IWindow("Entities"), m_property_window(property_window) {}
@@ -15,16 +15,26 @@ namespace HBE::GUI {
     void PropertyWindow::RenderWindow() {
         if (ImGui::Begin(m_name.c_str(), &m_open)) {
             int id = 0;
-            for (auto &property : m_properties) {
+            for (size_t i = 0; i < m_properties.size(); i++) {
+                auto &property = m_properties[i];
                 if (ImGui::CollapsingHeader(property.first.data(), ImGuiTreeNodeFlags_DefaultOpen)) {
+                    // The group reports an edit if any widget inside it was edited this frame
+                    ImGui::BeginGroup();
                     property.second->RenderProperties(id);
+                    ImGui::EndGroup();
+
+                    if (ImGui::IsItemEdited() && m_on_property_edited) {
+                        m_on_property_edited(i);
+                    }
                 }
             }
         }
         ImGui::End();
     }
 
-    void PropertyWindow::SetProperties(std::vector<std::pair<std::string, IPropertyRenderable *>> properties) {
+    void PropertyWindow::SetProperties(std::vector<std::pair<std::string, IPropertyRenderable *>> properties,
+                                       std::function<void(size_t)> on_property_edited) {
         m_properties = properties;
+        m_on_property_edited = on_property_edited;
     }
 } // namespace HBE::GUI
\ No newline at end of file
@@ -28,11 +28,21 @@ namespace HBE::GUI {
     private:
         std::vector<std::pair<std::string, IPropertyRenderable *>> m_properties;
 
+        // Called with the index of a property after the user edits it
+        std::function<void(size_t)> m_on_property_edited;
+
     public:
         PropertyWindow() : IWindow("Properties") {}
         ~PropertyWindow() = default;
 
         void RenderWindow() override;
-        void SetProperties(std::vector<std::pair<std::string, IPropertyRenderable *>> properties);
+
+        /**
+         * @brief Replace the properties shown in the window
+         * @param properties Name and renderable of each property
+         * @param on_property_edited Called with the index of a property after the user edits it, may be empty
+         */
+        void SetProperties(std::vector<std::pair<std::string, IPropertyRenderable *>> properties,
+                           std::function<void(size_t)> on_property_edited = nullptr);
     };
 } // namespace HBE::GUI
\ No newline at end of file
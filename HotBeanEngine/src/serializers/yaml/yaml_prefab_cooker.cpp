@@ -0,0 +1,65 @@
+/**
+ * @file yaml_prefab_cooker.cpp
+ * @author Daniel Parker (DParker13)
+ * @brief YAML-backed implementation of the IPrefabCooker interface.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include <HotBeanEngine/application/application.hpp>
+#include <HotBeanEngine/serializers/yaml/yaml_prefab_cooker.hpp>
+#include <HotBeanEngine/serializers/yaml/yaml_serialization_reader.hpp>
+
+namespace HBE::Serializers {
+    using namespace Core;
+
+    Prefab YamlPrefabCooker::Cook(std::filesystem::path filepath) {
+        assert(!filepath.empty() && "Prefab filepath is empty.");
+
+        LOG(LoggingType::INFO, "Cooking prefab \"" + filepath.string() + "\"");
+
+        YAML::Node root = YAML::LoadFile(filepath.string());
+        if (!root["Entity"]) {
+            LOG(LoggingType::ERROR, "Prefab " + filepath.string() + " has no root Entity.");
+            throw std::runtime_error("Prefab " + filepath.string() + " has no root Entity.");
+        }
+
+        Prefab prefab;
+        CookEntity(root, -1, prefab);
+        return prefab;
+    }
+
+    void YamlPrefabCooker::CookEntity(const YAML::Node &node, Sint64 parent_node, Prefab &prefab) {
+        const Sint64 prefab_node = static_cast<Sint64>(prefab.AddNode(parent_node));
+        YAML::Node children;
+
+        for (const auto &components : node["Entity"]) {
+            std::string component_name = components.first.as<std::string>();
+
+            // Children are cooked after every component of this entity, nodes must follow their parent
+            if (component_name == "Entities") {
+                children = components.second;
+                continue;
+            }
+
+            if (!g_ecs.IsComponentRegistered(component_name)) {
+                LOG(LoggingType::ERROR, "Component " + component_name + " is not registered.");
+                continue;
+            }
+
+            // Cooked the same way the component factory loads a scene, default construct then deserialize
+            const ComponentID component_id = g_ecs.GetComponentID(component_name);
+            IComponent &component = prefab.AddComponent(static_cast<size_t>(prefab_node), component_id,
+                                                        *g_ecs.GetComponentOps(component_id));
+
+            YamlComponentReader reader(components.second);
+            component.Deserialize(reader);
+        }
+
+        for (const YAML::Node &child : children) {
+            CookEntity(child, prefab_node, prefab);
+        }
+    }
+} // namespace HBE::Serializers
\ No newline at end of file
@@ -34,10 +34,10 @@ namespace HBE::Systems {
         if (keys_pressed.size() > 0) {
             float distance = speed * g_app.GetDeltaTime();
 
-            auto &controller = g_ecs.GetComponent<Controller>(entity);
+            const auto &controller = GetWorld().GetComponent<const Controller>(entity);
 
             if (controller.controllable) {
-                auto &transform = g_ecs.GetComponent<Transform2D>(entity);
+                auto &transform = GetWorld().GetComponent<Transform2D>(entity);
 
                 if (keys_pressed.find(SDLK_LEFT) != keys_pressed.end()) {
                     transform.m_local_position.x -= distance;
@@ -15,8 +15,8 @@ namespace HBE::Systems {
     void CollisionSystem::OnUpdate() {}
 
     void CollisionSystem::OnEntityAdded(EntityID entity) {
-        auto collider = g_ecs.GetComponent<Collider2D>(entity);
-        auto rigidbody = g_ecs.GetComponent<RigidBody>(entity);
+        const auto &collider = GetWorld().GetComponent<const Collider2D>(entity);
+        const auto &rigidbody = GetWorld().GetComponent<const RigidBody>(entity);
 
         b2ShapeDef shape_def = b2DefaultShapeDef();
         shape_def.density = 1.0f;
@@ -29,20 +29,19 @@ namespace HBE::Systems {
         // Step the physics world forward
         b2World_Step(m_world_id, time_step, sub_step_count);
 
-        for (auto &entity : m_entities) {
-            auto &transform = g_ecs.GetComponent<Transform2D>(entity);
-            auto &rigidbody = g_ecs.GetComponent<RigidBody>(entity);
-
-            b2Vec2 position = b2Body_GetPosition(rigidbody.m_body_id);
-            b2Rot rotation = b2Body_GetRotation(rigidbody.m_body_id);
-            transform.m_local_position = {position.x, position.y};
-            transform.m_local_rotation = RadiansToDegrees(atan2(rotation.s, rotation.c));
-        }
+        // Reading body state is safe from several threads once the step has finished
+        GetWorld().ParallelForEach<Transform2D, const RigidBody>(
+            [this](EntityID, Transform2D &transform, const RigidBody &rigidbody) {
+                b2Vec2 position = b2Body_GetPosition(rigidbody.m_body_id);
+                b2Rot rotation = b2Body_GetRotation(rigidbody.m_body_id);
+                transform.m_local_position = {position.x, position.y};
+                transform.m_local_rotation = RadiansToDegrees(atan2(rotation.s, rotation.c));
+            });
     }
 
     void PhysicsSystem::OnEntityAdded(EntityID entity) {
-        auto &transform = g_ecs.GetComponent<Transform2D>(entity);
-        auto &rigidbody = g_ecs.GetComponent<RigidBody>(entity);
+        auto &transform = GetWorld().GetComponent<Transform2D>(entity);
+        auto &rigidbody = GetWorld().GetComponent<RigidBody>(entity);
 
         b2BodyDef body_def = b2DefaultBodyDef();
         body_def.position = b2Vec2({transform.m_local_position.x, transform.m_local_position.y});
@@ -58,7 +57,7 @@ namespace HBE::Systems {
      * @param entity The entity to remove.
      */
     void PhysicsSystem::OnEntityRemoved(EntityID entity) {
-        auto &rigidbody = g_ecs.GetComponent<RigidBody>(entity);
+        auto &rigidbody = GetWorld().GetComponent<RigidBody>(entity);
         b2DestroyBody(rigidbody.m_body_id);
     }
 
@@ -13,51 +13,43 @@
 
 namespace HBE::Systems {
     void ShapeSystem::OnRender() {
-        for (auto &entity : m_entities) {
-            auto &texture = g_ecs.GetComponent<Texture>(entity);
-            auto &shape = g_ecs.GetComponent<Shape>(entity);
+        // Only redraw shapes that were added or edited since the last frame
+        auto changed_shapes =
+            GetWorld().View<const Transform2D, const Shape, Texture>().Changed<Shape>(GetLastRunTick());
 
-            if (shape.IsDirty()) {
-                // Make sure the shape and texture sizes stay in sync
-                if (!CompareTextureAndShape(texture, shape)) {
-                    SDL_DestroyTexture(texture.m_texture); // TODO: Update texture instead of destroying and recreating
-                    CreateTextureForEntity(entity);
-                    texture.MarkDirty();
-                }
-
-                SDL_SetRenderTarget(g_app.GetRenderer(), texture.m_texture);
-                SDL_SetRenderDrawColor(g_app.GetRenderer(), 0, 0, 0, 0);
-                SDL_RenderClear(g_app.GetRenderer());
-                SDL_SetRenderDrawColor(g_app.GetRenderer(), shape.m_color.r, shape.m_color.g, shape.m_color.b,
-                                       shape.m_color.a);
+        changed_shapes.Each([this](EntityID entity, const Transform2D &, const Shape &shape, Texture &texture) {
+            // Make sure the shape and texture sizes stay in sync
+            if (!CompareTextureAndShape(texture, shape)) {
+                SDL_DestroyTexture(texture.m_texture); // TODO: Update texture instead of destroying and recreating
+                texture.m_texture = nullptr;
+                CreateTextureForEntity(entity);
+            }
 
-                switch (shape.m_type) {
-                case Shape::ShapeType::Box: {
-                    const SDL_FRect *rect = new SDL_FRect({0, 0, shape.m_size.x, shape.m_size.y});
-                    if (shape.m_filled) {
-                        SDL_RenderFillRect(g_app.GetRenderer(), rect);
-                    }
-                    else {
-                        SDL_RenderRect(g_app.GetRenderer(), rect);
-                    }
+            SDL_SetRenderTarget(g_app.GetRenderer(), texture.m_texture);
+            SDL_SetRenderDrawColor(g_app.GetRenderer(), 0, 0, 0, 0);
+            SDL_RenderClear(g_app.GetRenderer());
+            SDL_SetRenderDrawColor(g_app.GetRenderer(), shape.m_color.r, shape.m_color.g, shape.m_color.b,
+                                   shape.m_color.a);
 
-                    // Free rect
-                    if (rect) {
-                        delete rect;
-                    }
+            switch (shape.m_type) {
+            case Shape::ShapeType::Box: {
+                const SDL_FRect rect = {0, 0, shape.m_size.x, shape.m_size.y};
+                if (shape.m_filled) {
+                    SDL_RenderFillRect(g_app.GetRenderer(), &rect);
                 }
+                else {
+                    SDL_RenderRect(g_app.GetRenderer(), &rect);
                 }
-
-                shape.MarkClean();
             }
-        }
+            }
+        });
     }
 
     void ShapeSystem::OnEntityAdded(EntityID entity) { CreateTextureForEntity(entity); }
 
     void ShapeSystem::CreateTextureForEntity(EntityID entity) {
-        auto &texture = g_ecs.GetComponent<Texture>(entity);
-        auto &shape = g_ecs.GetComponent<Shape>(entity);
+        auto &texture = GetWorld().GetComponent<Texture>(entity);
+        const auto &shape = GetWorld().GetComponent<const Shape>(entity);
 
         if (texture.m_texture == nullptr) {
             texture.m_size = {shape.m_size.x, shape.m_size.y};
@@ -68,7 +60,7 @@ namespace HBE::Systems {
         }
     }
 
-    bool ShapeSystem::CompareTextureAndShape(Texture &texture, Shape &shape) {
+    bool ShapeSystem::CompareTextureAndShape(const Texture &texture, const Shape &shape) {
         return (texture.m_size.x == shape.m_size.x && texture.m_size.y == shape.m_size.y);
     }
 } // namespace HBE::Systems
\ No newline at end of file
@@ -20,8 +20,8 @@ namespace HBE::Systems {
 
     void InteractSystem::OnEvent(SDL_Event &event) {
         for (auto &entity : m_entities) {
-            auto &button = g_ecs.GetComponent<Interactive>(entity);
-            auto &texture = g_ecs.GetComponent<Texture>(entity);
+            auto &button = GetWorld().GetComponent<Interactive>(entity);
+            const auto &texture = GetWorld().GetComponent<const Texture>(entity);
 
             auto mouse_buttons_pressed = g_app.GetInputEventListener().GetMouseButtonsPressed();
 
@@ -36,24 +36,24 @@ namespace HBE::Systems {
             SDL_FPoint mouse_point = {mouse_x, mouse_y};
 
             // Check if using screen space
-            if (g_ecs.HasComponent<UIRect>(entity)) {
-                auto &ui_rect = g_ecs.GetComponent<UIRect>(entity);
+            if (GetWorld().HasComponent<UIRect>(entity)) {
+                const auto &ui_rect = GetWorld().GetComponent<const UIRect>(entity);
                 int screen_width, screen_height;
                 SDL_GetRenderOutputSize(g_app.GetRenderer(), &screen_width, &screen_height);
 
                 SDL_FRect button_rect = ui_rect.GetScreenBounds(screen_width, screen_height);
                 if (SDL_PointInRectFloat(&mouse_point, &button_rect)) {
                     // Button was clicked - emit click event
-                    g_app.GetEventManager().Emit(OnClickEvent{entity});
+                    g_app.GetEventManager().Emit(OnClickEvent{entity, GetWorld().GetEntityHandle(entity)});
                 }
             }
             else {
                 // World space: use camera transforms
-                auto &transform = g_ecs.GetComponent<Transform2D>(entity);
+                const auto &transform = GetWorld().GetComponent<const Transform2D>(entity);
 
-                for (auto &camera_entity : g_app.GetCameraManager().GetAllActiveCameras()) {
-                    auto &camera = g_ecs.GetComponent<Camera>(camera_entity);
-                    auto &camera_transform = g_ecs.GetComponent<Transform2D>(camera_entity);
+                for (auto &camera_entity : g_app.GetCameraManager().GetAllActiveCameras(GetWorld())) {
+                    const auto &camera = GetWorld().GetComponent<const Camera>(camera_entity);
+                    const auto &camera_transform = GetWorld().GetComponent<const Transform2D>(camera_entity);
 
                     auto screen_pos =
                         g_app.GetCameraManager().CalculateScreenPosition(camera, camera_transform, transform);
@@ -63,7 +63,7 @@ namespace HBE::Systems {
 
                     if (SDL_PointInRectFloat(&mouse_point, &button_rect)) {
                         // Button was clicked - emit click event
-                        g_app.GetEventManager().Emit(OnClickEvent{entity});
+                        g_app.GetEventManager().Emit(OnClickEvent{entity, GetWorld().GetEntityHandle(entity)});
                     }
                 }
             }
@@ -95,8 +95,8 @@ namespace HBE::Systems {
         }
 
         for (auto &entity : m_entities) {
-            auto &button = g_ecs.GetComponent<Interactive>(entity);
-            auto &texture = g_ecs.GetComponent<Texture>(entity);
+            auto &button = GetWorld().GetComponent<Interactive>(entity);
+            const auto &texture = GetWorld().GetComponent<const Texture>(entity);
 
             SDL_FPoint mouse_point = m_current_mouse_position;
 
@@ -105,8 +105,8 @@ namespace HBE::Systems {
             bool swept_through_while_outside = false;
 
             // Check if using screen space
-            if (g_ecs.HasComponent<UIRect>(entity)) {
-                auto &ui_rect = g_ecs.GetComponent<UIRect>(entity);
+            if (GetWorld().HasComponent<UIRect>(entity)) {
+                const auto &ui_rect = GetWorld().GetComponent<const UIRect>(entity);
                 int screen_width, screen_height;
                 SDL_GetRenderOutputSize(g_app.GetRenderer(), &screen_width, &screen_height);
 
@@ -119,11 +119,11 @@ namespace HBE::Systems {
             }
             else {
                 // World space: check against camera transforms
-                auto &transform = g_ecs.GetComponent<Transform2D>(entity);
+                const auto &transform = GetWorld().GetComponent<const Transform2D>(entity);
 
-                for (auto &camera_entity : g_app.GetCameraManager().GetAllActiveCameras()) {
-                    auto &camera = g_ecs.GetComponent<Camera>(camera_entity);
-                    auto &camera_transform = g_ecs.GetComponent<Transform2D>(camera_entity);
+                for (auto &camera_entity : g_app.GetCameraManager().GetAllActiveCameras(GetWorld())) {
+                    const auto &camera = GetWorld().GetComponent<const Camera>(camera_entity);
+                    const auto &camera_transform = GetWorld().GetComponent<const Transform2D>(camera_entity);
 
                     auto screen_pos =
                         g_app.GetCameraManager().CalculateScreenPosition(camera, camera_transform, transform);
@@ -142,11 +142,11 @@ namespace HBE::Systems {
             }
 
             if ((currently_hovered && !button.m_mouse_hover) || swept_through_while_outside) {
-                g_app.GetEventManager().Emit(OnEnterEvent{entity});
+                g_app.GetEventManager().Emit(OnEnterEvent{entity, GetWorld().GetEntityHandle(entity)});
                 button.m_mouse_hover = true;
             }
             if (!currently_hovered && button.m_mouse_hover) {
-                g_app.GetEventManager().Emit(OnExitEvent{entity});
+                g_app.GetEventManager().Emit(OnExitEvent{entity, GetWorld().GetEntityHandle(entity)});
                 button.m_mouse_hover = false;
             }
         }
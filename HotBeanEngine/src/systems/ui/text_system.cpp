@@ -32,8 +32,7 @@ namespace HBE::Systems {
 
     void TextSystem::OnWindowResize(SDL_Event &event) {
         for (auto &entity : m_entities) {
-            auto &texture = g_ecs.GetComponent<Texture>(entity);
-            texture.MarkDirty();
+            GetWorld().MarkChanged<Texture>(entity);
         }
     }
 
@@ -41,45 +40,59 @@ namespace HBE::Systems {
      * Updates all UI element textures
      */
     void TextSystem::OnRender() {
+        const Tick last_run_tick = GetLastRunTick();
+        auto &world = GetWorld();
+
+        // Changes made while this system runs aren't new to its next run, so failures are marked changed a frame later
+        for (EntityID entity : m_failed_entities) {
+            if (world.HasComponent<Text>(entity)) {
+                world.MarkChanged<Text>(entity);
+            }
+        }
+        m_failed_entities.clear();
+
         for (auto &entity : m_entities) {
-            auto &text = g_ecs.GetComponent<Text>(entity);
-            auto &texture = g_ecs.GetComponent<Texture>(entity);
+            // Only re-render text that was added or edited since the last frame
+            if (!world.IsChanged<Text>(entity, last_run_tick) && !world.IsChanged<Texture>(entity, last_run_tick)) {
+                continue;
+            }
+
+            auto &text = world.GetComponent<Text>(entity);
+            auto &texture = world.GetComponent<Texture>(entity);
 
             // Initialize font
             if (!text.m_font) {
                 text.m_font = m_font;
             }
 
-            // Update text texture if dirty
-            if (texture.IsDirty() || text.IsDirty()) {
-                SDL_Surface *text_surface = nullptr;
-
-                // Render text to surface
-                if (text.m_background_color.a == 0) {
-                    text_surface = TTF_RenderText_Solid_Wrapped(m_font, text.m_text.c_str(), 0, text.m_foreground_color,
-                                                                text.m_wrapping_width);
-                }
-                else {
-                    text_surface = TTF_RenderText_LCD_Wrapped(m_font, text.m_text.c_str(), 0, text.m_foreground_color,
-                                                              text.m_background_color, text.m_wrapping_width);
-                }
-
-                if (!text_surface) {
-                    LOG(LoggingType::ERROR, "Couldn't render text: " + std::string(SDL_GetError()));
-                    return;
-                }
-
-                // Update texture with new surface
-                if (text.m_font && text.m_text != "") {
-                    texture.m_texture = SDL_CreateTextureFromSurface(g_app.GetRenderer(), text_surface);
-                    texture.m_size = {text_surface->w, text_surface->h};
-                    SDL_SetTextureBlendMode(texture.m_texture, SDL_BLENDMODE_BLEND);
-                    texture.MarkClean();
-                    text.MarkClean();
-                }
-
-                SDL_DestroySurface(text_surface);
+            SDL_Surface *text_surface = nullptr;
+
+            // Render text to surface
+            if (text.m_background_color.a == 0) {
+                text_surface = TTF_RenderText_Solid_Wrapped(m_font, text.m_text.c_str(), 0, text.m_foreground_color,
+                                                            text.m_wrapping_width);
             }
+            else {
+                text_surface = TTF_RenderText_LCD_Wrapped(m_font, text.m_text.c_str(), 0, text.m_foreground_color,
+                                                          text.m_background_color, text.m_wrapping_width);
+            }
+
+            if (!text_surface) {
+                LOG(LoggingType::ERROR, "Couldn't render text: " + std::string(SDL_GetError()));
+                m_failed_entities.push_back(entity);
+                continue;
+            }
+
+            // Update texture with new surface
+            if (text.m_font && text.m_text != "") {
+                // The texture owns its handle, so the previous render is destroyed before it's replaced
+                SDL_DestroyTexture(texture.m_texture);
+                texture.m_texture = SDL_CreateTextureFromSurface(g_app.GetRenderer(), text_surface);
+                texture.m_size = {text_surface->w, text_surface->h};
+                SDL_SetTextureBlendMode(texture.m_texture, SDL_BLENDMODE_BLEND);
+            }
+
+            SDL_DestroySurface(text_surface);
         }
     }
 
@@ -0,0 +1,67 @@
+/**
+ * @file component_access_benchmark.cpp
+ * @author Daniel Parker (DParker13)
+ * @brief Benchmarks for reaching components without knowing their type.
+ * Covers the paths used by the serializer (GetAllComponents) and by component listeners (GetComponent by ID).
+ * Hidden from the default test run, use the [benchmark] tag to run.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include <catch2/catch_all.hpp>
+
+#include "test_component.hpp"
+#include "test_component_2.hpp"
+#include <HotBeanEngine/application/managers/ecs_manager.hpp>
+
+using namespace HBE::Core;
+using namespace HBE::Application::Managers;
+
+namespace {
+    /**
+     * @brief Listener that reads the component it's handed, like the render and transform managers do.
+     */
+    class CountingListener : public HBE::Application::Listeners::ComponentListener {
+    public:
+        int m_total = 0;
+
+        void OnComponentAdded(IComponent *component, EntityID) override {
+            m_total += static_cast<TestComponent *>(component)->m_value;
+        }
+        void OnComponentRemoved(ComponentID, EntityID) override {}
+    };
+} // namespace
+
+TEST_CASE("Benchmark: Type-erased component access", "[.][benchmark]") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    const int entity_count = 10000;
+
+    ECSManager ecs_manager = ECSManager(logging_manager);
+    for (int i = 0; i < entity_count; i++) {
+        EntityID entity = ecs_manager.CreateEntity();
+        ecs_manager.AddComponent<TestComponent>(entity);
+        ecs_manager.AddComponent<TestComponent2>(entity, TestComponent2(1.0f, 2.0f));
+    }
+
+    CountingListener listener;
+    listener.ListenForComponents({ecs_manager.GetComponentID<TestComponent>()});
+    ecs_manager.RegisterComponentListener(&listener);
+
+    BENCHMARK("GetAllComponents (10000 entities)") {
+        size_t found = 0;
+        for (EntityID entity = 0; entity < entity_count; entity++) {
+            found += ecs_manager.GetAllComponents(entity).size();
+        }
+        return found;
+    };
+
+    BENCHMARK("Notify listener of added component (10000 entities)") {
+        ComponentID component_id = ecs_manager.GetComponentID<TestComponent>();
+        for (EntityID entity = 0; entity < entity_count; entity++) {
+            ecs_manager.NotifyComponentAdded(component_id, entity);
+        }
+        return listener.m_total;
+    };
+}
@@ -13,6 +13,7 @@
 
 #include "test_component.hpp"
 #include "test_component_2.hpp"
+#include "test_tag.hpp"
 #include <HotBeanEngine/application/managers/component_manager.hpp>
 #include <HotBeanEngine/application/managers/entity_manager.hpp>
 
@@ -93,11 +94,13 @@ TEST_CASE("ComponentManager: Component Removal") {
         REQUIRE(component_manager.IsComponentRegistered<TestComponent>());
     }
 
-    SECTION("Remove last component unregisters type") {
+    SECTION("Remove last component keeps type registered") {
         component_manager.AddComponent<TestComponent>(entity_1, test_component);
+        ComponentID component_id = component_manager.GetComponentID<TestComponent>();
         component_manager.RemoveComponent<TestComponent>(entity_1);
 
-        REQUIRE_FALSE(component_manager.IsComponentRegistered<TestComponent>());
+        REQUIRE(component_manager.IsComponentRegistered<TestComponent>());
+        REQUIRE(component_manager.GetComponentID<TestComponent>() == component_id);
         REQUIRE_FALSE(component_manager.HasComponent<TestComponent>(entity_1));
     }
 
@@ -251,3 +254,108 @@ TEST_CASE("ComponentManager: Multiple Component Types") {
         REQUIRE(component_manager.IsComponentRegistered<TestComponent2>());
     }
 }
+
+
+TEST_CASE("ComponentManager: Typed Lookup") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    ComponentManager component_manager = ComponentManager(logging_manager);
+    EntityManager entity_manager = EntityManager(logging_manager);
+    EntityID entity = entity_manager.CreateEntity();
+
+    SECTION("Different component types get different type indices") {
+        REQUIRE(COMPONENT_TYPE_INDEX<TestComponent> != COMPONENT_TYPE_INDEX<TestComponent2>);
+    }
+
+    SECTION("Typed ID matches name lookup") {
+        component_manager.AddComponent<TestComponent>(entity);
+
+        REQUIRE(component_manager.GetComponentID<TestComponent>() == component_manager.GetComponentID("TestComponent"));
+    }
+
+    SECTION("Typed lookup follows re-registration") {
+        TestComponent comp;
+        comp.m_value = 7;
+
+        component_manager.AddComponent<TestComponent2>(entity);
+        component_manager.AddComponent<TestComponent>(entity, comp);
+        component_manager.RemoveComponent<TestComponent>(entity);
+        component_manager.UnregisterComponentID<TestComponent>();
+
+        REQUIRE_FALSE(component_manager.IsComponentRegistered<TestComponent>());
+        REQUIRE(component_manager.TryGetComponentData<TestComponent>(entity) == nullptr);
+
+        comp.m_value = 8;
+        component_manager.AddComponent<TestComponent>(entity, comp);
+
+        REQUIRE(component_manager.GetComponentData<TestComponent>(entity).m_value == 8);
+        REQUIRE(component_manager.GetComponentID<TestComponent>() == component_manager.GetComponentID("TestComponent"));
+    }
+
+    SECTION("Typed lookup survives clearing all components") {
+        component_manager.AddComponent<TestComponent>(entity);
+        component_manager.ClearAllComponents();
+
+        REQUIRE(component_manager.IsComponentRegistered<TestComponent>());
+        REQUIRE_FALSE(component_manager.HasComponent<TestComponent>(entity));
+        REQUIRE(component_manager.TryGetComponentData<TestComponent>(entity) == nullptr);
+    }
+
+    SECTION("Managers keep separate typed lookups") {
+        ComponentManager other_manager = ComponentManager(logging_manager);
+
+        component_manager.AddComponent<TestComponent>(entity);
+
+        REQUIRE(component_manager.HasComponent<TestComponent>(entity));
+        REQUIRE_FALSE(other_manager.IsComponentRegistered<TestComponent>());
+        REQUIRE_FALSE(other_manager.HasComponent<TestComponent>(entity));
+    }
+}
+
+TEST_CASE("ComponentManager: Stable Registration") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    ComponentManager component_manager = ComponentManager(logging_manager);
+    EntityManager entity_manager = EntityManager(logging_manager);
+    EntityID entity = entity_manager.CreateEntity();
+
+    ComponentID first_id = component_manager.RegisterComponentID<TestComponent>();
+    ComponentID second_id = component_manager.RegisterComponentID<TestComponent2>();
+
+    SECTION("Storage is reused after the last component is removed") {
+        component_manager.AddComponent<TestComponent>(entity);
+        const TestComponent *first = component_manager.TryGetComponentData<TestComponent>(entity);
+        component_manager.RemoveComponent<TestComponent>(entity);
+
+        component_manager.AddComponent<TestComponent>(entity);
+
+        REQUIRE(component_manager.GetComponentID<TestComponent>() == first_id);
+        REQUIRE(component_manager.TryGetComponentData<TestComponent>(entity) == first);
+    }
+
+    SECTION("Unregistering hands out the lowest free ID without colliding") {
+        component_manager.UnregisterComponentID<TestComponent>();
+        ComponentID tag_id = component_manager.RegisterComponentID<TestTag>();
+        ComponentID readded_id = component_manager.RegisterComponentID<TestComponent>();
+
+        REQUIRE(tag_id == first_id);
+        REQUIRE(readded_id != second_id);
+        REQUIRE(readded_id != tag_id);
+        REQUIRE(component_manager.GetComponentID<TestComponent2>() == second_id);
+    }
+
+    SECTION("Compacting keeps components and registrations") {
+        TestComponent comp;
+        comp.m_value = 4;
+        component_manager.AddComponent<TestComponent>(entity, comp);
+        component_manager.AddComponent<TestComponent2>(entity);
+        component_manager.RemoveComponent<TestComponent2>(entity);
+
+        component_manager.Compact();
+
+        REQUIRE(component_manager.IsComponentRegistered<TestComponent2>());
+        REQUIRE_FALSE(component_manager.HasComponent<TestComponent2>(entity));
+        REQUIRE(component_manager.GetComponentData<TestComponent>(entity).m_value == 4);
+
+        component_manager.AddComponent<TestComponent2>(entity);
+        REQUIRE(component_manager.HasComponent<TestComponent2>(entity));
+    }
+}
\ No newline at end of file
@@ -9,11 +9,17 @@
  * @copyright Copyright (c) 2025
  */
 
+#include <algorithm>
+#include <atomic>
+
 #include <catch2/catch_all.hpp>
 
+#include "test_child.hpp"
 #include "test_component.hpp"
 #include "test_component_2.hpp"
 #include "test_system.hpp"
+#include "test_system_2.hpp"
+#include "test_tag.hpp"
 #include <HotBeanEngine/application/managers/ecs_manager.hpp>
 
 using namespace HBE::Core;
@@ -60,11 +66,15 @@ TEST_CASE("ECSManager: Entity Creation and Destruction") {
     SECTION("Destroy entity") {
         EntityID entity = ecs_manager.CreateEntity();
         ecs_manager.DestroyEntity(entity);
+        REQUIRE(ecs_manager.IsEntityAlive(entity));
+
+        ecs_manager.Flush();
         REQUIRE(ecs_manager.EntityCount() == 0);
     }
 
     SECTION("Destroy non-existent entity") {
         ecs_manager.DestroyEntity(0);
+        ecs_manager.Flush();
         REQUIRE(ecs_manager.EntityCount() == 0);
     }
 
@@ -74,7 +84,9 @@ TEST_CASE("ECSManager: Entity Creation and Destruction") {
         ecs_manager.AddComponent<TestComponent>(entity, comp);
 
         ecs_manager.DestroyEntity(entity);
+        ecs_manager.Flush();
         REQUIRE(ecs_manager.EntityCount() == 0);
+        REQUIRE_FALSE(ecs_manager.HasComponent<TestComponent>(entity));
     }
 
     SECTION("Destroy all entities") {
@@ -151,6 +163,15 @@ TEST_CASE("ECSManager: Component Management") {
         REQUIRE(ecs_manager.HasComponent<TestComponent>(entity_1));
         REQUIRE(ecs_manager.HasComponent<TestComponent2>(entity_1));
     }
+
+    SECTION("Emplace constructs the component from arguments") {
+        ecs_manager.Emplace<TestComponent2>(entity_1, 3.0f, 4.0f);
+
+        REQUIRE(ecs_manager.HasComponent<TestComponent2>(entity_1));
+        REQUIRE(ecs_manager.GetComponent<const TestComponent2>(entity_1).m_x == 3.0f);
+        REQUIRE(ecs_manager.GetComponent<const TestComponent2>(entity_1).m_y == 4.0f);
+        REQUIRE(ecs_manager.GetSignature(entity_1).test(ecs_manager.GetComponentID<TestComponent2>()));
+    }
 }
 
 TEST_CASE("ECSManager: Component Removal") {
@@ -281,6 +302,7 @@ TEST_CASE("ECSManager: Entity-Component Integration") {
         ecs_manager.AddComponent<TestComponent>(entity2, comp);
 
         ecs_manager.DestroyEntity(entity);
+        ecs_manager.Flush();
 
         REQUIRE(ecs_manager.IsComponentRegistered<TestComponent>());
         REQUIRE(ecs_manager.HasComponent<TestComponent>(entity2));
@@ -305,9 +327,1278 @@ TEST_CASE("ECSManager: Entity-Component Integration") {
         EntityID first = ecs_manager.CreateEntity();
         REQUIRE(first == 0);
         ecs_manager.DestroyEntity(first);
+        ecs_manager.Flush();
 
         // Next ID comes from front of queue (ID 1), not recycled ID
         EntityID second = ecs_manager.CreateEntity();
         REQUIRE(second == 1);
     }
 }
+
+TEST_CASE("ECSManager: View") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    ECSManager ecs_manager = ECSManager(logging_manager);
+
+    SECTION("View of unregistered component is empty") {
+        ecs_manager.CreateEntity();
+
+        auto view = ecs_manager.View<TestComponent>();
+        REQUIRE(view.SizeHint() == 0);
+        REQUIRE(view.begin() == view.end());
+    }
+
+    SECTION("View only yields entities with every component") {
+        EntityID both = ecs_manager.CreateEntity();
+        EntityID only_first = ecs_manager.CreateEntity();
+        EntityID only_second = ecs_manager.CreateEntity();
+
+        TestComponent comp1;
+        comp1.m_value = 7;
+        ecs_manager.AddComponent<TestComponent>(both, comp1);
+        ecs_manager.AddComponent<TestComponent2>(both, TestComponent2(1.0f, 2.0f));
+        ecs_manager.AddComponent<TestComponent>(only_first);
+        ecs_manager.AddComponent<TestComponent2>(only_second);
+
+        std::vector<EntityID> visited;
+        for (auto [entity, comp, comp2] : ecs_manager.View<TestComponent, TestComponent2>()) {
+            visited.push_back(entity);
+            REQUIRE(comp.m_value == 7);
+            REQUIRE(comp2.m_y == 2.0f);
+        }
+
+        REQUIRE(visited == std::vector<EntityID>{both});
+        REQUIRE(ecs_manager.View<TestComponent, TestComponent2>().Contains(both));
+        REQUIRE_FALSE(ecs_manager.View<TestComponent, TestComponent2>().Contains(only_first));
+    }
+
+    SECTION("View walks the smallest pool") {
+        for (int i = 0; i < 10; i++) {
+            EntityID entity = ecs_manager.CreateEntity();
+            ecs_manager.AddComponent<TestComponent>(entity);
+
+            if (i % 5 == 0) {
+                ecs_manager.AddComponent<TestComponent2>(entity);
+            }
+        }
+
+        REQUIRE(ecs_manager.View<TestComponent, TestComponent2>().SizeHint() == 2);
+        REQUIRE(ecs_manager.View<TestComponent2, TestComponent>().SizeHint() == 2);
+    }
+
+    SECTION("View yields references to the stored components") {
+        for (int i = 0; i < 5; i++) {
+            EntityID entity = ecs_manager.CreateEntity();
+            ecs_manager.AddComponent<TestComponent>(entity);
+        }
+
+        ecs_manager.View<TestComponent>().Each([](EntityID entity, TestComponent &comp) { comp.m_value = entity * 2; });
+
+        int count = 0;
+        ecs_manager.View<const TestComponent>().Each([&count](EntityID entity, const TestComponent &comp) {
+            REQUIRE(comp.m_value == static_cast<int>(entity * 2));
+            count++;
+        });
+
+        REQUIRE(count == 5);
+        REQUIRE(ecs_manager.GetComponent<TestComponent>(3).m_value == 6);
+    }
+
+    SECTION("View matches GetEntitiesWithComponents") {
+        for (int i = 0; i < 50; i++) {
+            EntityID entity = ecs_manager.CreateEntity();
+
+            if (i % 2 == 0) {
+                ecs_manager.AddComponent<TestComponent>(entity);
+            }
+            if (i % 3 == 0) {
+                ecs_manager.AddComponent<TestComponent2>(entity);
+            }
+        }
+
+        std::set<EntityID> from_view;
+        for (auto [entity, comp, comp2] : ecs_manager.View<TestComponent, TestComponent2>()) {
+            from_view.insert(entity);
+        }
+
+        REQUIRE(from_view == ecs_manager.GetEntitiesWithComponents<TestComponent, TestComponent2>());
+    }
+}
+
+TEST_CASE("ECSManager: Change Detection") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    ECSManager ecs_manager = ECSManager(logging_manager);
+
+    // Running a system moves the change tick forward
+    ecs_manager.RegisterSystem<TestSystem>();
+
+    std::vector<EntityID> entities;
+    for (int i = 0; i < 10; i++) {
+        EntityID entity = ecs_manager.CreateEntity();
+        ecs_manager.AddComponent<TestComponent>(entity);
+        ecs_manager.AddComponent<TestComponent2>(entity);
+        entities.push_back(entity);
+    }
+
+    Tick since = ecs_manager.GetChangeTick();
+    ecs_manager.IterateSystems(GameLoopState::OnUpdate);
+
+    SECTION("Nothing is changed after the tick moved on") {
+        REQUIRE(ecs_manager.GetChangeTick() > since);
+        REQUIRE_FALSE(ecs_manager.IsChanged<TestComponent>(entities[0], since));
+        REQUIRE_FALSE(ecs_manager.IsAdded<TestComponent>(entities[0], since));
+        REQUIRE(ecs_manager.IsAdded<TestComponent>(entities[0], 0));
+
+        size_t count = 0;
+        ecs_manager.View<const TestComponent>().Changed<TestComponent>(since).Each(
+            [&count](EntityID, const TestComponent &) { count++; });
+        REQUIRE(count == 0);
+    }
+
+    SECTION("Mutable GetComponent marks the component changed") {
+        ecs_manager.GetComponent<TestComponent>(entities[3]).m_value = 5;
+
+        REQUIRE(ecs_manager.IsChanged<TestComponent>(entities[3], since));
+        REQUIRE_FALSE(ecs_manager.IsChanged<TestComponent2>(entities[3], since));
+        REQUIRE_FALSE(ecs_manager.IsChanged<TestComponent>(entities[4], since));
+    }
+
+    SECTION("Const GetComponent doesn't mark the component changed") {
+        REQUIRE(ecs_manager.GetComponent<const TestComponent>(entities[3]).m_value == 0);
+        REQUIRE_FALSE(ecs_manager.IsChanged<TestComponent>(entities[3], since));
+    }
+
+    SECTION("MarkChanged marks the component changed") {
+        ecs_manager.MarkChanged<TestComponent2>(entities[2]);
+
+        REQUIRE(ecs_manager.IsChanged<TestComponent2>(entities[2], since));
+        REQUIRE_FALSE(ecs_manager.IsChanged<TestComponent>(entities[2], since));
+    }
+
+    SECTION("Changed filter only yields changed entities") {
+        ecs_manager.GetComponent<TestComponent>(entities[1]).m_value = 1;
+        ecs_manager.GetComponent<TestComponent>(entities[7]).m_value = 7;
+        ecs_manager.GetComponent<TestComponent2>(entities[5]).m_x = 5.0f;
+
+        std::vector<EntityID> visited;
+        auto view = ecs_manager.View<const TestComponent, const TestComponent2>().Changed<TestComponent>(since);
+        for (auto [entity, comp, comp2] : view) {
+            visited.push_back(entity);
+        }
+        std::sort(visited.begin(), visited.end());
+
+        REQUIRE(visited == std::vector<EntityID>{entities[1], entities[7]});
+        REQUIRE(view.Contains(entities[1]));
+        REQUIRE_FALSE(view.Contains(entities[5]));
+    }
+
+    SECTION("Filters on several components must all pass") {
+        ecs_manager.MarkChanged<TestComponent>(entities[1]);
+        ecs_manager.MarkChanged<TestComponent>(entities[2]);
+        ecs_manager.MarkChanged<TestComponent2>(entities[2]);
+
+        std::vector<EntityID> visited;
+        ecs_manager.View<const TestComponent, const TestComponent2>()
+            .Changed<TestComponent>(since)
+            .Changed<TestComponent2>(since)
+            .Each([&visited](EntityID entity, const TestComponent &, const TestComponent2 &) {
+                visited.push_back(entity);
+            });
+
+        REQUIRE(visited == std::vector<EntityID>{entities[2]});
+    }
+
+    SECTION("Added filter only yields entities given the component later") {
+        EntityID added = ecs_manager.CreateEntity();
+        ecs_manager.AddComponent<TestComponent>(added);
+        ecs_manager.AddComponent<TestComponent2>(added);
+        ecs_manager.MarkChanged<TestComponent>(entities[0]);
+
+        std::vector<EntityID> visited;
+        ecs_manager.View<const TestComponent>().Added<TestComponent>(since).Each(
+            [&visited](EntityID entity, const TestComponent &) { visited.push_back(entity); });
+
+        REQUIRE(visited == std::vector<EntityID>{added});
+    }
+
+    SECTION("Unfiltered view still yields everything") {
+        ecs_manager.MarkChanged<TestComponent>(entities[1]);
+
+        size_t count = 0;
+        ecs_manager.View<const TestComponent>().Each([&count](EntityID, const TestComponent &) { count++; });
+        REQUIRE(count == entities.size());
+    }
+}
+
+TEST_CASE("ECSManager: Parallel For Each") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    std::shared_ptr<JobManager> job_manager = std::make_shared<JobManager>(4);
+
+    for (bool with_job_manager : {true, false}) {
+        ECSManager ecs_manager = ECSManager(logging_manager, with_job_manager ? job_manager : nullptr);
+
+        for (int i = 0; i < 5000; i++) {
+            EntityID entity = ecs_manager.CreateEntity();
+            ecs_manager.AddComponent<TestComponent>(entity);
+
+            if (i % 4 == 0) {
+                ecs_manager.AddComponent<TestComponent2>(entity, TestComponent2(static_cast<float>(i), 0.0f));
+            }
+        }
+
+        std::atomic<int> visited = 0;
+        ecs_manager.ParallelForEach<TestComponent, const TestComponent2>(
+            [&visited](EntityID, TestComponent &comp, const TestComponent2 &comp2) {
+                comp.m_value = static_cast<int>(comp2.m_x);
+                visited++;
+            });
+
+        REQUIRE(visited == 1250);
+        REQUIRE(ecs_manager.GetComponent<TestComponent>(400).m_value == 400);
+        REQUIRE(ecs_manager.GetComponent<TestComponent>(401).m_value == 0);
+    }
+}
+
+namespace {
+    /**
+     * @brief Archetype listing both test components by name.
+     */
+    struct TestArchetype : public IArchetype {
+        std::vector<std::string> m_component_names = {"TestComponent", "TestComponent2"};
+
+        std::vector<std::string> GetComponentNames() override { return m_component_names; }
+    };
+
+    /**
+     * @brief Listener that records how it was notified.
+     */
+    class BatchListener : public HBE::Application::Listeners::ComponentListener {
+    public:
+        int m_batches = 0;
+        int m_single_adds = 0;
+        std::vector<EntityID> m_entities;
+        std::vector<int> m_values;
+
+        void OnComponentAdded(IComponent *, EntityID) override { m_single_adds++; }
+        void OnComponentRemoved(ComponentID, EntityID) override {}
+
+        void OnComponentsAdded(ComponentID, std::span<IComponent *const> components,
+                               std::span<const EntityID> entities) override {
+            m_batches++;
+            m_entities.insert(m_entities.end(), entities.begin(), entities.end());
+            for (IComponent *component : components) {
+                m_values.push_back(static_cast<TestComponent *>(component)->m_value);
+            }
+        }
+    };
+} // namespace
+
+TEST_CASE("ECSManager: Batch Spawning") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    ECSManager ecs_manager = ECSManager(logging_manager);
+
+    SECTION("Create entities in bulk") {
+        std::vector<EntityID> entities = ecs_manager.CreateEntities(50);
+
+        REQUIRE(entities.size() == 50);
+        REQUIRE(ecs_manager.EntityCount() == 50);
+    }
+
+    SECTION("Spawned entities get every component and the shared signature") {
+        std::vector<EntityID> entities = ecs_manager.SpawnBatch<TestComponent, TestComponent2>(100);
+
+        REQUIRE(entities.size() == 100);
+        REQUIRE(ecs_manager.EntityCount() == 100);
+
+        Signature expected;
+        expected.set(ecs_manager.GetComponentID<TestComponent>());
+        expected.set(ecs_manager.GetComponentID<TestComponent2>());
+
+        size_t mismatches = 0;
+        for (EntityID entity : entities) {
+            mismatches += ecs_manager.GetSignature(entity) != expected;
+            mismatches += !ecs_manager.HasComponent<TestComponent>(entity);
+            mismatches += !ecs_manager.HasComponent<TestComponent2>(entity);
+        }
+        REQUIRE(mismatches == 0);
+    }
+
+    SECTION("Initializer sets up each entity by its batch index") {
+        std::vector<EntityID> entities = ecs_manager.SpawnBatch<TestComponent>(
+            10, [&ecs_manager](EntityID entity, size_t index) {
+                ecs_manager.GetComponent<TestComponent>(entity).m_value = static_cast<int>(index) * 2;
+            });
+
+        REQUIRE(ecs_manager.GetComponent<TestComponent>(entities[0]).m_value == 0);
+        REQUIRE(ecs_manager.GetComponent<TestComponent>(entities[9]).m_value == 18);
+    }
+
+    SECTION("Spawned entities join matching systems only") {
+        ecs_manager.RegisterSystem<TestSystem>();
+        ecs_manager.SetSignature<TestSystem, TestComponent, TestComponent2>();
+        TestSystem *system = ecs_manager.GetSystem<TestSystem>();
+
+        std::vector<EntityID> matching = ecs_manager.SpawnBatch<TestComponent, TestComponent2>(20);
+        std::vector<EntityID> other = ecs_manager.SpawnBatch<TestComponent>(5);
+
+        REQUIRE(system->m_entities.Size() == 20);
+        REQUIRE(system->m_entities.Contains(matching.back()));
+        REQUIRE_FALSE(system->m_entities.Contains(other.front()));
+    }
+
+    SECTION("Spawn from an archetype") {
+        ecs_manager.RegisterComponentID<TestComponent>();
+        ecs_manager.RegisterComponentID<TestComponent2>();
+
+        TestArchetype archetype;
+        std::vector<EntityID> entities = ecs_manager.SpawnBatch(&archetype, 8);
+
+        REQUIRE(entities.size() == 8);
+        REQUIRE(ecs_manager.HasComponent<TestComponent2>(entities.back()));
+    }
+
+    SECTION("Archetype with an unregistered component spawns nothing") {
+        ecs_manager.RegisterComponentID<TestComponent>();
+
+        TestArchetype archetype;
+
+        REQUIRE_THROWS_AS(ecs_manager.SpawnBatch(&archetype, 8), ComponentNotRegisteredException);
+        REQUIRE(ecs_manager.EntityCount() == 0);
+    }
+
+    SECTION("Listeners are notified once per batch after the initializer ran") {
+        ecs_manager.RegisterComponentID<TestComponent>();
+
+        BatchListener listener;
+        listener.ListenForComponents({ecs_manager.GetComponentID<TestComponent>()});
+        ecs_manager.RegisterComponentListener(&listener);
+
+        std::vector<EntityID> entities = ecs_manager.SpawnBatch<TestComponent, TestComponent2>(
+            4, [&ecs_manager](EntityID entity, size_t index) {
+                ecs_manager.GetComponent<TestComponent>(entity).m_value = static_cast<int>(index) + 1;
+            });
+
+        REQUIRE(listener.m_batches == 1);
+        REQUIRE(listener.m_single_adds == 0);
+        REQUIRE(listener.m_entities == entities);
+        REQUIRE(listener.m_values == std::vector<int>{1, 2, 3, 4});
+    }
+
+    SECTION("Spawning past the entity limit returns a partial batch") {
+        REQUIRE(ecs_manager.SetEntityLimit(6));
+
+        std::vector<EntityID> entities = ecs_manager.SpawnBatch<TestComponent>(10);
+
+        REQUIRE(entities.size() == 6);
+        REQUIRE(ecs_manager.HasComponent<TestComponent>(entities.back()));
+    }
+}
+
+TEST_CASE("ECSManager: Command Buffer") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    ECSManager ecs_manager = ECSManager(logging_manager);
+    CommandBuffer &commands = ecs_manager.GetCommandBuffer();
+
+    SECTION("Changes are applied on flush") {
+        EntityID entity = commands.CreateEntity();
+        TestComponent comp;
+        comp.m_value = 5;
+        commands.AddComponent<TestComponent>(entity, comp);
+        commands.AddComponent<TestComponent2>(entity);
+
+        REQUIRE(ecs_manager.EntityCount() == 1);
+        REQUIRE(commands.Size() == 2);
+        REQUIRE_FALSE(ecs_manager.HasComponent<TestComponent>(entity));
+
+        ecs_manager.Flush();
+
+        REQUIRE(commands.Empty());
+        REQUIRE(ecs_manager.GetComponent<TestComponent>(entity).m_value == 5);
+        REQUIRE(ecs_manager.HasComponent<TestComponent2>(entity));
+        REQUIRE(ecs_manager.GetSignature(entity).count() == 2);
+    }
+
+    SECTION("Flushed entities are added to matching systems") {
+        ecs_manager.RegisterSystem<TestSystem>();
+        ecs_manager.SetSignature<TestSystem, TestComponent>();
+        TestSystem *system = ecs_manager.GetSystem<TestSystem>();
+
+        EntityID matching = commands.CreateEntity();
+        EntityID other = commands.CreateEntity();
+        commands.AddComponent<TestComponent>(matching);
+        commands.AddComponent<TestComponent2>(other);
+        ecs_manager.Flush();
+
+        REQUIRE(system->m_entities.Contains(matching));
+        REQUIRE_FALSE(system->m_entities.Contains(other));
+
+        commands.RemoveComponent<TestComponent>(matching);
+        ecs_manager.Flush();
+
+        REQUIRE_FALSE(system->m_entities.Contains(matching));
+    }
+
+    SECTION("Commands for an entity keep their recorded order") {
+        EntityID entity = ecs_manager.CreateEntity();
+        ecs_manager.AddComponent<TestComponent2>(entity);
+
+        commands.AddComponent<TestComponent>(entity);
+        commands.RemoveComponent<TestComponent>(entity);
+        commands.RemoveComponent<TestComponent2>(entity);
+        commands.AddComponent<TestComponent2>(entity, TestComponent2(4.0f, 2.0f));
+        ecs_manager.Flush();
+
+        REQUIRE_FALSE(ecs_manager.HasComponent<TestComponent>(entity));
+        REQUIRE(ecs_manager.GetComponent<TestComponent2>(entity).m_x == 4.0f);
+    }
+
+    SECTION("Destroy drops later commands for the entity") {
+        EntityID entity = commands.CreateEntity();
+        EntityID survivor = commands.CreateEntity();
+        commands.AddComponent<TestComponent>(entity);
+        commands.AddComponent<TestComponent>(survivor);
+        commands.DestroyEntity(entity);
+        commands.AddComponent<TestComponent2>(entity);
+        ecs_manager.Flush();
+
+        REQUIRE(ecs_manager.EntityCount() == 1);
+        REQUIRE_FALSE(ecs_manager.HasComponent<TestComponent>(entity));
+        REQUIRE_FALSE(ecs_manager.HasComponent<TestComponent2>(entity));
+        REQUIRE(ecs_manager.HasComponent<TestComponent>(survivor));
+    }
+
+    SECTION("Commands for dead entities are dropped") {
+        CommandBuffer separate = ecs_manager.CreateCommandBuffer();
+        separate.AddComponent<TestComponent>(3);
+        ecs_manager.Flush(separate);
+
+        REQUIRE(separate.Empty());
+        REQUIRE_FALSE(ecs_manager.IsComponentRegistered<TestComponent>());
+    }
+}
+
+
+namespace {
+    /**
+     * @brief System that counts how often it's told about entities.
+     */
+    struct CountingSystem : public GameSystem<TestComponent> {
+        int m_added = 0;
+        int m_removed = 0;
+
+        DEFINE_NAME("CountingSystem");
+
+        void OnEntityAdded(EntityID) override { m_added++; }
+        void OnEntityRemoved(EntityID) override { m_removed++; }
+    };
+
+    /**
+     * @brief System registered after a snapshot was taken.
+     */
+    struct LateSystem : public GameSystem<const TestComponent2> {
+        int m_added = 0;
+
+        DEFINE_NAME("LateSystem");
+
+        void OnEntityAdded(EntityID) override { m_added++; }
+    };
+
+    /**
+     * @brief Listener that counts how often it's told about components.
+     */
+    class CountingListener : public HBE::Application::Listeners::ComponentListener {
+    public:
+        int m_added = 0;
+        int m_batches = 0;
+        int m_removed = 0;
+        int m_removed_batches = 0;
+        int m_cleared = 0;
+        std::vector<ComponentID> m_removed_components;
+
+        void OnComponentAdded(IComponent *, EntityID) override { m_added++; }
+
+        void OnComponentsAdded(ComponentID component_id, std::span<IComponent *const> components,
+                               std::span<const EntityID> entities) override {
+            m_batches++;
+            ComponentListener::OnComponentsAdded(component_id, components, entities);
+        }
+
+        void OnComponentRemoved(ComponentID component_id, EntityID) override {
+            m_removed++;
+            m_removed_components.push_back(component_id);
+        }
+
+        void OnComponentsRemoved(ComponentID component_id, std::span<const EntityID> entities) override {
+            m_removed_batches++;
+            ComponentListener::OnComponentsRemoved(component_id, entities);
+        }
+
+        void OnAllComponentsRemoved(ComponentID component_id, std::span<const EntityID> entities) override {
+            m_cleared++;
+            ComponentListener::OnAllComponentsRemoved(component_id, entities);
+        }
+    };
+} // namespace
+
+TEST_CASE("ECSManager: Snapshots") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    ECSManager ecs_manager = ECSManager(logging_manager);
+    ecs_manager.RegisterComponentID<TestComponent>();
+    ecs_manager.RegisterComponentID<TestComponent2>();
+    CountingSystem &system = ecs_manager.RegisterSystem<CountingSystem>();
+
+    std::vector<EntityID> entities = ecs_manager.SpawnBatch<TestComponent, TestComponent2>(
+        5, [&ecs_manager](EntityID entity, size_t index) {
+            ecs_manager.GetComponent<TestComponent>(entity).m_value = static_cast<int>(index);
+        });
+    EntityID loose = ecs_manager.CreateEntity();
+    ecs_manager.AddComponent<TestComponent2>(loose, TestComponent2(1.0f, 2.0f));
+
+    WorldSnapshot snapshot = ecs_manager.CaptureSnapshot();
+    REQUIRE(snapshot.EntityCount() == 6);
+
+    SECTION("Restoring undoes changes made since the snapshot") {
+        ecs_manager.GetComponent<TestComponent>(entities[0]).m_value = 100;
+        ecs_manager.RemoveComponent<TestComponent2>(entities[1]);
+        ecs_manager.DestroyEntity(entities[2]);
+        EntityID added = ecs_manager.CreateEntity();
+        ecs_manager.AddComponent<TestComponent>(added);
+
+        ecs_manager.RestoreSnapshot(snapshot);
+
+        REQUIRE(ecs_manager.EntityCount() == 6);
+        REQUIRE(ecs_manager.GetComponent<const TestComponent>(entities[0]).m_value == 0);
+        REQUIRE(ecs_manager.HasComponent<TestComponent2>(entities[1]));
+        REQUIRE(ecs_manager.IsEntityAlive(entities[2]));
+        REQUIRE(ecs_manager.GetComponent<const TestComponent>(entities[4]).m_value == 4);
+        REQUIRE(ecs_manager.GetComponent<const TestComponent2>(loose).m_y == 2.0f);
+    }
+
+    SECTION("Restoring brings back unregistered component types") {
+        for (EntityID entity : entities) {
+            ecs_manager.RemoveComponent<TestComponent>(entity);
+        }
+        ecs_manager.UnregisterSystem<CountingSystem>();
+        ecs_manager.UnregisterComponentID<TestComponent>();
+        REQUIRE_FALSE(ecs_manager.IsComponentRegistered<TestComponent>());
+
+        ecs_manager.RestoreSnapshot(snapshot);
+
+        REQUIRE(ecs_manager.IsComponentRegistered<TestComponent>());
+        REQUIRE(ecs_manager.View<const TestComponent, const TestComponent2>().SizeHint() == 5);
+    }
+
+    SECTION("A snapshot can be restored more than once") {
+        ecs_manager.DestroyAllEntities();
+        ecs_manager.RestoreSnapshot(snapshot);
+        ecs_manager.GetComponent<TestComponent>(entities[3]).m_value = 50;
+        ecs_manager.RestoreSnapshot(snapshot);
+
+        REQUIRE(ecs_manager.GetComponent<const TestComponent>(entities[3]).m_value == 3);
+    }
+
+    SECTION("Entities created after the snapshot get fresh IDs and handles") {
+        EntityHandle handle_before = ecs_manager.GetEntityHandle(entities[0]);
+        EntityID added = ecs_manager.CreateEntity();
+        EntityHandle added_handle = ecs_manager.GetEntityHandle(added);
+
+        ecs_manager.RestoreSnapshot(snapshot);
+
+        REQUIRE(ecs_manager.IsEntityValid(handle_before));
+        REQUIRE_FALSE(ecs_manager.IsEntityAlive(added));
+        REQUIRE(ecs_manager.CreateEntity() == added);
+        REQUIRE_FALSE(ecs_manager.IsEntityValid(added_handle));
+    }
+
+    SECTION("Systems are told about removed and restored entities") {
+        ecs_manager.DestroyEntity(entities[0]);
+        ecs_manager.Flush();
+        system.m_added = 0;
+        system.m_removed = 0;
+
+        ecs_manager.RestoreSnapshot(snapshot);
+
+        REQUIRE(system.m_removed == 4);
+        REQUIRE(system.m_added == 5);
+        REQUIRE(system.m_entities.Size() == 5);
+        REQUIRE(system.m_entities.Contains(entities[0]));
+    }
+
+    SECTION("Systems registered after the snapshot are matched against the restored entities") {
+        LateSystem &late_system = ecs_manager.RegisterSystem<LateSystem>();
+
+        ecs_manager.RestoreSnapshot(snapshot);
+
+        REQUIRE(late_system.m_added == 6);
+        REQUIRE(late_system.m_entities.Size() == 6);
+        REQUIRE(system.m_entities.Size() == 5);
+    }
+
+    SECTION("Listeners are told about removed and restored components") {
+        CountingListener listener;
+        listener.ListenForComponents({ecs_manager.GetComponentID<TestComponent2>()});
+        ecs_manager.RegisterComponentListener(&listener);
+
+        ecs_manager.RestoreSnapshot(snapshot);
+
+        REQUIRE(listener.m_removed == 6);
+        REQUIRE(listener.m_added == 6);
+        REQUIRE(listener.m_batches == 1);
+    }
+
+    SECTION("Restored components count as added and changed") {
+        Tick since = ecs_manager.GetChangeTick();
+        ecs_manager.RegisterSystem<TestSystem>();
+        ecs_manager.IterateSystems(GameLoopState::OnUpdate);
+
+        ecs_manager.RestoreSnapshot(snapshot);
+
+        REQUIRE(ecs_manager.IsAdded<TestComponent>(entities[0], since));
+        REQUIRE(ecs_manager.IsChanged<TestComponent2>(loose, since));
+    }
+
+    SECTION("Pending commands are dropped") {
+        ecs_manager.GetCommandBuffer().AddComponent<TestComponent>(loose);
+
+        ecs_manager.RestoreSnapshot(snapshot);
+        ecs_manager.Flush();
+
+        REQUIRE_FALSE(ecs_manager.HasComponent<TestComponent>(loose));
+    }
+}
+
+
+TEST_CASE("ECSManager: Component Unregistration") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    ECSManager ecs_manager = ECSManager(logging_manager);
+    ComponentID component_id = ecs_manager.RegisterComponentID<TestComponent>();
+    ComponentID component_id_2 = ecs_manager.RegisterComponentID<TestComponent2>();
+
+    ecs_manager.RegisterSystem<TestSystem>();
+    ecs_manager.SetSignature<TestSystem, TestComponent, TestComponent2>();
+    TestSystem *system = ecs_manager.GetSystem<TestSystem>();
+
+    ecs_manager.RegisterSystem<TestSystem2>();
+    ecs_manager.SetSignature<TestSystem2, TestComponent2>();
+    TestSystem2 *other_system = ecs_manager.GetSystem<TestSystem2>();
+
+    CountingListener listener;
+    listener.ListenForComponents({component_id});
+    ecs_manager.RegisterComponentListener(&listener);
+
+    std::vector<EntityID> both = ecs_manager.SpawnBatch<TestComponent, TestComponent2>(3);
+    ecs_manager.SpawnBatch<TestComponent2>(2);
+    REQUIRE(system->m_entities.Size() == 3);
+
+    SECTION("Refused while a system signature has the component") {
+        REQUIRE_THROWS_AS(ecs_manager.UnregisterComponentID<TestComponent>(), ComponentInUseException);
+
+        REQUIRE(ecs_manager.IsComponentRegistered<TestComponent>());
+        REQUIRE(ecs_manager.GetSignature(both.front()).test(component_id));
+        REQUIRE(system->m_entities.Size() == 3);
+        REQUIRE(listener.m_removed == 0);
+    }
+
+    SECTION("Entities lose the component's bit and listeners are told") {
+        ecs_manager.UnregisterSystem<TestSystem>();
+        ecs_manager.UnregisterComponentID<TestComponent>();
+
+        REQUIRE_FALSE(ecs_manager.IsComponentRegistered<TestComponent>());
+        REQUIRE(listener.m_removed == 3);
+
+        for (EntityID entity : both) {
+            REQUIRE(ecs_manager.GetSignature(entity) == Signature().set(component_id_2));
+        }
+
+        // Systems that never used the component keep their entities
+        REQUIRE(ecs_manager.GetSignature<TestSystem2>() == Signature().set(component_id_2));
+        REQUIRE(other_system->m_entities.Size() == 5);
+    }
+
+    SECTION("A component type given the freed ID isn't on the old entities") {
+        ecs_manager.UnregisterSystem<TestSystem>();
+        ecs_manager.UnregisterComponentID<TestComponent>();
+        REQUIRE(ecs_manager.RegisterComponentID<TestChild>() == component_id);
+
+        for (EntityID entity : both) {
+            REQUIRE_FALSE(ecs_manager.HasComponent<TestChild>(entity));
+        }
+
+        auto view = ecs_manager.View<const TestChild>();
+        REQUIRE(view.begin() == view.end());
+
+        ecs_manager.AddComponent<TestChild>(both.front());
+        REQUIRE(ecs_manager.HasComponent<TestChild>(both.front()));
+        REQUIRE_FALSE(ecs_manager.HasComponent<TestChild>(both.back()));
+    }
+}
+
+TEST_CASE("ECSManager: Component Listeners") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    ECSManager ecs_manager = ECSManager(logging_manager);
+    ComponentID component_id = ecs_manager.RegisterComponentID<TestComponent>();
+    ComponentID component_id_2 = ecs_manager.RegisterComponentID<TestComponent2>();
+    ecs_manager.RegisterComponentID<TestTag>();
+
+    CountingListener listener;
+    listener.ListenForComponents({component_id, component_id_2});
+    ecs_manager.RegisterComponentListener(&listener);
+
+    // Keeps both component types registered while the entities under test lose theirs
+    ecs_manager.SpawnBatch<TestComponent, TestComponent2>(1);
+    listener.m_added = 0;
+    listener.m_batches = 0;
+
+    EntityID entity = ecs_manager.CreateEntity();
+    ecs_manager.AddComponent<TestComponent>(entity);
+
+    SECTION("Added once the entity has every listened component") {
+        REQUIRE(listener.m_added == 0);
+
+        ecs_manager.AddComponent<TestComponent2>(entity);
+        REQUIRE(listener.m_added == 1);
+    }
+
+    SECTION("Removing a component the listener doesn't listen for isn't reported") {
+        ecs_manager.AddComponent<TestComponent2>(entity);
+        ecs_manager.AddComponent<TestTag>(entity);
+        ecs_manager.RemoveComponent<TestTag>(entity);
+
+        REQUIRE(listener.m_removed == 0);
+    }
+
+    SECTION("Removals pass the removed component and are only reported for matching entities") {
+        EntityID partial = ecs_manager.CreateEntity();
+        ecs_manager.AddComponent<TestComponent>(partial);
+        ecs_manager.RemoveComponent<TestComponent>(partial);
+        REQUIRE(listener.m_removed == 0);
+
+        ecs_manager.AddComponent<TestComponent2>(entity);
+        ecs_manager.RemoveComponent<TestComponent2>(entity);
+        ecs_manager.RemoveComponent<TestComponent>(entity);
+
+        REQUIRE(listener.m_removed_components == std::vector<ComponentID>{component_id_2});
+    }
+
+    SECTION("Destroying a matching entity is reported once") {
+        ecs_manager.AddComponent<TestComponent2>(entity);
+        ecs_manager.DestroyEntity(entity);
+        ecs_manager.Flush();
+
+        REQUIRE(listener.m_removed == 1);
+    }
+
+    SECTION("Flushed additions are reported in one batch") {
+        std::vector<EntityID> entities = ecs_manager.SpawnBatch<TestComponent>(4);
+        CommandBuffer &commands = ecs_manager.GetCommandBuffer();
+        for (EntityID spawned : entities) {
+            commands.AddComponent<TestComponent2>(spawned);
+        }
+        commands.AddComponent<TestTag>(entities[0]);
+        ecs_manager.Flush();
+
+        REQUIRE(listener.m_batches == 1);
+        REQUIRE(listener.m_added == 4);
+    }
+
+    SECTION("Flushed removals followed by a destroy are reported once") {
+        ecs_manager.AddComponent<TestComponent2>(entity);
+
+        CommandBuffer &commands = ecs_manager.GetCommandBuffer();
+        commands.RemoveComponent<TestComponent2>(entity);
+        commands.DestroyEntity(entity);
+        ecs_manager.Flush();
+
+        REQUIRE(listener.m_removed_components == std::vector<ComponentID>{component_id_2});
+    }
+}
+
+
+namespace {
+    /**
+     * @brief System that only reaches entities through the world it's registered in.
+     * Each fixed update adds 1 to every TestComponent, each update adds 10 and records spawning one entity.
+     */
+    struct WorldStepSystem : public GameSystem<TestComponent> {
+        DEFINE_NAME("WorldStepSystem");
+
+        void OnFixedUpdate() override {
+            for (EntityID entity : m_entities) {
+                GetWorld().GetComponent<TestComponent>(entity).m_value += 1;
+            }
+        }
+
+        void OnUpdate() override {
+            for (EntityID entity : m_entities) {
+                GetWorld().GetComponent<TestComponent>(entity).m_value += 10;
+            }
+
+            CommandBuffer &commands = GetWorld().GetCommandBuffer();
+            commands.AddComponent<TestComponent2>(commands.CreateEntity(), TestComponent2(1.0f, 1.0f));
+        }
+    };
+} // namespace
+
+TEST_CASE("ECSManager: Entity Teardown") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    ECSManager ecs_manager = ECSManager(logging_manager);
+    ComponentID component_id = ecs_manager.RegisterComponentID<TestComponent>();
+    ecs_manager.RegisterComponentID<TestComponent2>();
+    CountingSystem &system = ecs_manager.RegisterSystem<CountingSystem>();
+
+    CountingListener listener;
+    listener.ListenForComponents({component_id});
+    ecs_manager.RegisterComponentListener(&listener);
+
+    std::vector<EntityID> entities = ecs_manager.SpawnBatch<TestComponent, TestComponent2>(6);
+    const EntitySet &query = ecs_manager.Query<TestComponent2>();
+    ecs_manager.Query<TestComponent2>();
+
+    SECTION("Destroyed entities live until the flush") {
+        ecs_manager.DestroyEntity(entities[1]);
+
+        REQUIRE(ecs_manager.IsEntityAlive(entities[1]));
+        REQUIRE(ecs_manager.HasComponent<TestComponent>(entities[1]));
+        REQUIRE(system.m_entities.Contains(entities[1]));
+        REQUIRE(system.m_removed == 0);
+
+        ecs_manager.Flush();
+
+        REQUIRE_FALSE(ecs_manager.IsEntityAlive(entities[1]));
+        REQUIRE_FALSE(system.m_entities.Contains(entities[1]));
+        REQUIRE_FALSE(query.Contains(entities[1]));
+        REQUIRE(system.m_removed == 1);
+        REQUIRE(listener.m_removed == 1);
+    }
+
+    SECTION("Entities destroyed in one frame are torn down together") {
+        ecs_manager.DestroyEntity(entities[0]);
+        ecs_manager.DestroyEntity(entities[3]);
+        ecs_manager.DestroyEntity(entities[3]);
+        ecs_manager.DestroyEntity(entities[5]);
+        ecs_manager.Flush();
+
+        REQUIRE(ecs_manager.EntityCount() == 3);
+        REQUIRE(ecs_manager.View<const TestComponent, const TestComponent2>().SizeHint() == 3);
+        REQUIRE(query.Size() == 3);
+        REQUIRE(system.m_removed == 3);
+        REQUIRE(listener.m_removed == 3);
+        REQUIRE(listener.m_removed_batches == 1);
+        REQUIRE(ecs_manager.GetComponent<const TestComponent>(entities[4]).m_value == 0);
+    }
+
+    SECTION("Destroying every entity clears storage, systems and queries in one go") {
+        ecs_manager.GetCommandBuffer().AddComponent<TestComponent>(ecs_manager.CreateEntity());
+        ecs_manager.DestroyAllEntities();
+
+        REQUIRE(ecs_manager.EntityCount() == 0);
+        REQUIRE(ecs_manager.View<const TestComponent>().SizeHint() == 0);
+        REQUIRE(system.m_entities.Size() == 0);
+        REQUIRE(system.m_removed == 6);
+        REQUIRE(query.Size() == 0);
+        REQUIRE(listener.m_cleared == 1);
+        REQUIRE(listener.m_removed == 6);
+        REQUIRE(ecs_manager.IsComponentRegistered<TestComponent>());
+
+        // The pending command referred to an entity that is gone
+        REQUIRE(ecs_manager.GetCommandBuffer().Empty());
+
+        ecs_manager.SpawnBatch<TestComponent, TestComponent2>(2);
+        REQUIRE(system.m_entities.Size() == 2);
+        REQUIRE(query.Size() == 2);
+    }
+}
+
+TEST_CASE("ECSManager: Entity Cloning") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    ECSManager ecs_manager = ECSManager(logging_manager);
+    ComponentID component_id = ecs_manager.RegisterComponentID<TestComponent>();
+    CountingSystem &system = ecs_manager.RegisterSystem<CountingSystem>();
+
+    CountingListener listener;
+    listener.ListenForComponents({component_id});
+    ecs_manager.RegisterComponentListener(&listener);
+
+    EntityID source = ecs_manager.CreateEntity();
+    TestComponent comp;
+    comp.m_value = 17;
+    ecs_manager.AddComponent<TestComponent>(source, comp);
+    ecs_manager.AddComponent<TestComponent2>(source, TestComponent2(3.0f, 4.0f));
+    ecs_manager.AddComponent<TestTag>(source);
+    system.m_added = 0;
+    listener.m_added = 0;
+
+    SECTION("Clones get a copy of every component") {
+        std::vector<EntityID> clones = ecs_manager.CloneEntity(source, 50);
+
+        REQUIRE(clones.size() == 50);
+        REQUIRE(ecs_manager.EntityCount() == 51);
+        REQUIRE(ecs_manager.GetSignature(clones[49]) == ecs_manager.GetSignature(source));
+        REQUIRE(ecs_manager.GetComponent<const TestComponent>(clones[0]).m_value == 17);
+        REQUIRE(ecs_manager.GetComponent<const TestComponent2>(clones[49]).m_y == 4.0f);
+        REQUIRE(ecs_manager.HasComponent<TestTag>(clones[10]));
+    }
+
+    SECTION("Clones are independent of the source") {
+        EntityID clone = ecs_manager.CloneEntity(source).front();
+        ecs_manager.GetComponent<TestComponent>(clone).m_value = 5;
+
+        REQUIRE(ecs_manager.GetComponent<const TestComponent>(source).m_value == 17);
+    }
+
+    SECTION("Systems and listeners see the clones once per batch") {
+        std::vector<EntityID> clones = ecs_manager.CloneEntity(source, 8);
+
+        REQUIRE(system.m_added == 8);
+        REQUIRE(system.m_entities.Contains(clones[7]));
+        REQUIRE(listener.m_added == 8);
+        REQUIRE(listener.m_batches == 1);
+        REQUIRE(ecs_manager.Query<TestComponent, TestTag>().Size() == 9);
+    }
+
+    SECTION("Clones count as added components") {
+        Tick since = ecs_manager.GetChangeTick();
+        ecs_manager.IterateSystems(GameLoopState::OnUpdate);
+        EntityID clone = ecs_manager.CloneEntity(source).front();
+
+        REQUIRE(ecs_manager.IsAdded<TestComponent>(clone, since));
+        REQUIRE_FALSE(ecs_manager.IsAdded<TestComponent>(source, since));
+    }
+
+    SECTION("Cloning an entity that isn't alive spawns nothing") {
+        ecs_manager.DestroyEntity(source);
+        ecs_manager.Flush();
+
+        REQUIRE(ecs_manager.CloneEntity(source, 3).empty());
+        REQUIRE(ecs_manager.EntityCount() == 0);
+    }
+}
+
+TEST_CASE("ECSManager: Prefab Instantiation") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    ECSManager ecs_manager = ECSManager(logging_manager);
+    ComponentID component_id = ecs_manager.RegisterComponentID<TestComponent>();
+    ComponentID child_id = ecs_manager.RegisterComponentID<TestChild>();
+    ComponentID tag_id = ecs_manager.RegisterComponentID<TestTag>();
+    CountingSystem &system = ecs_manager.RegisterSystem<CountingSystem>();
+
+    CountingListener listener;
+    listener.ListenForComponents({child_id});
+    ecs_manager.RegisterComponentListener(&listener);
+
+    // Root with a TestComponent, two children linked to it and a grandchild linked to the second child
+    Prefab prefab;
+    size_t root = prefab.AddNode();
+    size_t first_child = prefab.AddNode(static_cast<Sint64>(root));
+    size_t second_child = prefab.AddNode(static_cast<Sint64>(root));
+    size_t grandchild = prefab.AddNode(static_cast<Sint64>(second_child));
+
+    prefab.AddComponent<TestComponent>(root, component_id).m_value = 7;
+    prefab.AddComponent<TestChild>(root, child_id);
+    prefab.AddComponent<TestTag>(root, tag_id);
+    prefab.AddComponent<TestChild>(first_child, child_id).m_value = 1;
+    prefab.AddComponent<TestChild>(second_child, child_id).m_value = 2;
+    prefab.AddComponent<TestComponent>(grandchild, component_id).m_value = 3;
+    prefab.AddComponent<TestChild>(grandchild, child_id).m_value = 3;
+
+    SECTION("Nodes must follow their parent") {
+        Prefab invalid;
+
+        REQUIRE_THROWS_AS(invalid.AddNode(0), std::invalid_argument);
+        invalid.AddNode();
+        REQUIRE_THROWS_AS(invalid.AddNode(), std::invalid_argument);
+        REQUIRE_THROWS_AS(invalid.AddNode(1), std::invalid_argument);
+        REQUIRE_THROWS_AS(prefab.AddComponent<TestChild>(root, child_id), std::invalid_argument);
+    }
+
+    SECTION("Components are cooked into one blob per component type") {
+        REQUIRE(prefab.NodeCount() == 4);
+        REQUIRE(prefab.GetComponents().size() == 3);
+        REQUIRE(prefab.GetComponents()[1].Size() == 4);
+        REQUIRE(prefab.GetNodes()[grandchild].signature == Signature().set(component_id).set(child_id));
+        REQUIRE(prefab.GetNodes()[grandchild].parent == static_cast<Sint64>(second_child));
+    }
+
+    SECTION("Every instance gets a copy of each node") {
+        std::vector<EntityID> roots = ecs_manager.InstantiatePrefab(prefab, 100);
+
+        REQUIRE(roots.size() == 100);
+        REQUIRE(ecs_manager.EntityCount() == 400);
+        REQUIRE(ecs_manager.GetComponent<const TestComponent>(roots[99]).m_value == 7);
+        REQUIRE(ecs_manager.HasComponent<TestTag>(roots[0]));
+        REQUIRE(ecs_manager.GetSignature(roots[5]) == prefab.GetNodes()[root].signature);
+        REQUIRE(ecs_manager.Query<TestComponent, TestChild>().Size() == 200);
+        REQUIRE(system.m_added == 200);
+    }
+
+    SECTION("Children are linked to their own instance") {
+        std::vector<EntityID> roots = ecs_manager.InstantiatePrefab(prefab, 3, 42);
+
+        std::vector<EntityID> children;
+        std::vector<EntityID> grandchildren;
+        for (EntityID entity : ecs_manager.Query<TestChild>()) {
+            const TestChild &child = ecs_manager.GetComponent<const TestChild>(entity);
+            if (child.m_value == 2) {
+                children.push_back(entity);
+            }
+            else if (child.m_value == 3) {
+                grandchildren.push_back(entity);
+            }
+        }
+
+        REQUIRE(ecs_manager.GetComponent<const TestChild>(roots[1]).m_parent == 42);
+        REQUIRE(children.size() == 3);
+        REQUIRE(grandchildren.size() == 3);
+        for (size_t instance = 0; instance < 3; instance++) {
+            EntityID child = ecs_manager.GetComponent<const TestChild>(grandchildren[instance]).m_parent;
+            REQUIRE(std::find(children.begin(), children.end(), child) != children.end());
+            REQUIRE(std::find(roots.begin(), roots.end(), ecs_manager.GetComponent<const TestChild>(child).m_parent) !=
+                    roots.end());
+        }
+    }
+
+    SECTION("Listeners get one batch per component type") {
+        ecs_manager.InstantiatePrefab(prefab, 10);
+
+        REQUIRE(listener.m_added == 40);
+        REQUIRE(listener.m_batches == 1);
+    }
+
+    SECTION("Instances are independent of the prefab and each other") {
+        std::vector<EntityID> roots = ecs_manager.InstantiatePrefab(prefab, 2);
+        ecs_manager.GetComponent<TestComponent>(roots[0]).m_value = 100;
+
+        REQUIRE(ecs_manager.GetComponent<const TestComponent>(roots[1]).m_value == 7);
+        REQUIRE(static_cast<const TestComponent &>(prefab.GetComponents()[0].GetComponent(0)).m_value == 7);
+    }
+
+    SECTION("A prefab cooked for a component that was unregistered is rejected") {
+        ecs_manager.UnregisterComponentID<TestTag>();
+
+        REQUIRE_THROWS_AS(ecs_manager.InstantiatePrefab(prefab), ComponentNotRegisteredException);
+        REQUIRE(ecs_manager.EntityCount() == 0);
+    }
+
+    SECTION("Only whole instances are spawned at the entity limit") {
+        ecs_manager.SetEntityLimit(10);
+
+        std::vector<EntityID> roots = ecs_manager.InstantiatePrefab(prefab, 5);
+
+        REQUIRE(roots.size() == 2);
+        REQUIRE(ecs_manager.EntityCount() == 8);
+    }
+}
+
+TEST_CASE("ECSManager: Multiple Worlds") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    std::shared_ptr<JobManager> job_manager = std::make_shared<JobManager>(4);
+
+    // World i starts with i + 1 entities, so a world touching another's entities changes the counts
+    const size_t world_count = 16;
+    std::vector<std::unique_ptr<ECSManager>> worlds;
+    std::vector<ECSManager *> world_pointers;
+    for (size_t i = 0; i < world_count; i++) {
+        worlds.push_back(std::make_unique<ECSManager>(logging_manager, job_manager));
+        world_pointers.push_back(worlds.back().get());
+
+        worlds.back()->RegisterComponentID<TestComponent>();
+        worlds.back()->RegisterComponentID<TestComponent2>();
+        worlds.back()->RegisterSystem<WorldStepSystem>();
+        worlds.back()->SpawnBatch<TestComponent>(i + 1);
+    }
+
+    auto values_are = [&worlds](int expected) {
+        bool all_match = true;
+        for (const auto &world : worlds) {
+            for (auto [entity, comp] : world->View<const TestComponent>()) {
+                all_match &= comp.m_value == expected;
+            }
+        }
+        return all_match;
+    };
+
+    SECTION("Systems reach the world they're registered in") {
+        for (const auto &world : worlds) {
+            REQUIRE(&world->GetSystem<WorldStepSystem>()->GetWorld() == world.get());
+        }
+    }
+
+    SECTION("Iterating worlds runs one game loop method in each") {
+        ECSManager::IterateWorlds(*job_manager, world_pointers, GameLoopState::OnFixedUpdate);
+
+        REQUIRE(values_are(1));
+    }
+
+    SECTION("Stepping worlds runs every step in each world and applies its commands") {
+        ECSManager::StepWorlds(*job_manager, world_pointers, 3);
+
+        REQUIRE(values_are(33));
+        for (size_t i = 0; i < world_count; i++) {
+            REQUIRE(worlds[i]->EntityCount() == static_cast<EntityID>(i + 1 + 3));
+            REQUIRE(worlds[i]->GetEntitiesWithComponents<TestComponent2>().size() == 3);
+        }
+    }
+
+    SECTION("Worlds are independent of each other") {
+        ECSManager::StepWorlds(*job_manager, std::span<ECSManager *const>(world_pointers).first(1), 2);
+
+        REQUIRE(worlds[0]->EntityCount() == 3);
+        REQUIRE(worlds[1]->EntityCount() == 2);
+        REQUIRE(worlds[1]->GetComponent<const TestComponent>(0).m_value == 0);
+    }
+}
+
+
+namespace {
+    /**
+     * @brief System that only wants entities with TestComponent that are tagged with TestTag.
+     */
+    struct TaggedSystem : public GameSystem<TestComponent, const TestTag> {
+        DEFINE_NAME("TaggedSystem");
+    };
+} // namespace
+
+TEST_CASE("ECSManager: Tag Components") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    ECSManager ecs_manager = ECSManager(logging_manager);
+    ecs_manager.RegisterComponentID<TestComponent>();
+    ecs_manager.RegisterComponentID<TestTag>();
+    TaggedSystem &system = ecs_manager.RegisterSystem<TaggedSystem>();
+
+    // Every entity has TestComponent, every other one is tagged
+    std::vector<EntityID> entities = ecs_manager.SpawnBatch<TestComponent>(10);
+    for (size_t i = 0; i < entities.size(); i += 2) {
+        ecs_manager.AddComponent<TestTag>(entities[i]);
+    }
+
+    SECTION("Tags are part of system signatures") {
+        REQUIRE(system.m_entities.Size() == 5);
+        REQUIRE(system.m_entities.Contains(entities[0]));
+        REQUIRE_FALSE(system.m_entities.Contains(entities[1]));
+    }
+
+    SECTION("Tags filter views") {
+        size_t visited = 0;
+        for (auto [entity, comp, tag] : ecs_manager.View<const TestComponent, const TestTag>()) {
+            visited += ecs_manager.HasComponent<TestTag>(entity);
+        }
+        REQUIRE(visited == 5);
+    }
+
+    SECTION("Removing a tag removes the entity from systems") {
+        ecs_manager.RemoveComponent<TestTag>(entities[0]);
+
+        REQUIRE_FALSE(ecs_manager.HasComponent<TestTag>(entities[0]));
+        REQUIRE_FALSE(system.m_entities.Contains(entities[0]));
+        REQUIRE(system.m_entities.Size() == 4);
+    }
+
+    SECTION("Tagged entities share one tag instance") {
+        REQUIRE(&ecs_manager.GetComponent<const TestTag>(entities[0]) ==
+                &ecs_manager.GetComponent<const TestTag>(entities[2]));
+        REQUIRE(ecs_manager.GetAllComponents(entities[0]).size() == 2);
+    }
+}
+
+TEST_CASE("ECSManager: Query Cache") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    ECSManager ecs_manager = ECSManager(logging_manager);
+    ecs_manager.RegisterComponentID<TestComponent>();
+    ecs_manager.RegisterComponentID<TestComponent2>();
+    ecs_manager.RegisterComponentID<TestTag>();
+
+    // Every entity has TestComponent, every other one also has TestComponent2
+    std::vector<EntityID> entities = ecs_manager.SpawnBatch<TestComponent>(10);
+    for (size_t i = 0; i < entities.size(); i += 2) {
+        ecs_manager.AddComponent<TestComponent2>(entities[i]);
+    }
+
+    SECTION("First ask scans, second ask makes the query persistent") {
+        const EntitySet &first = ecs_manager.Query<TestComponent, TestComponent2>();
+        const EntitySet &second = ecs_manager.Query<TestComponent, TestComponent2>();
+
+        REQUIRE(&first == &second);
+        REQUIRE(second.Size() == 5);
+        REQUIRE(&ecs_manager.Query<TestComponent, TestComponent2>() == &second);
+    }
+
+    SECTION("Persistent queries follow component changes") {
+        ecs_manager.Query<TestComponent2>();
+        const EntitySet &result = ecs_manager.Query<TestComponent2>();
+
+        ecs_manager.AddComponent<TestComponent2>(entities[1]);
+        ecs_manager.RemoveComponent<TestComponent2>(entities[0]);
+        ecs_manager.DestroyEntity(entities[2]);
+        ecs_manager.Flush();
+        std::vector<EntityID> spawned = ecs_manager.SpawnBatch<TestComponent2>(3);
+
+        REQUIRE(result.Size() == 7);
+        REQUIRE(result.Contains(entities[1]));
+        REQUIRE_FALSE(result.Contains(entities[0]));
+        REQUIRE_FALSE(result.Contains(entities[2]));
+        REQUIRE(result.Contains(spawned[0]));
+        REQUIRE(ecs_manager.GetEntitiesWithComponents<TestComponent2>() ==
+                std::set<EntityID>(result.begin(), result.end()));
+    }
+
+    SECTION("Persistent queries follow flushed command buffers") {
+        ecs_manager.Query<TestComponent2>();
+        const EntitySet &result = ecs_manager.Query<TestComponent2>();
+
+        CommandBuffer &commands = ecs_manager.GetCommandBuffer();
+        commands.AddComponent<TestComponent2>(entities[3]);
+        commands.DestroyEntity(entities[4]);
+        ecs_manager.Flush();
+
+        REQUIRE(result.Size() == 5);
+        REQUIRE(result.Contains(entities[3]));
+        REQUIRE_FALSE(result.Contains(entities[4]));
+    }
+
+    SECTION("Excluded components filter entities out") {
+        ecs_manager.AddComponent<TestTag>(entities[0]);
+
+        ecs_manager.Query<TestComponent, Without<TestComponent2, TestTag>>();
+        const EntitySet &result = ecs_manager.Query<TestComponent, Without<TestComponent2, TestTag>>();
+        REQUIRE(result.Size() == 5);
+
+        ecs_manager.AddComponent<TestTag>(entities[1]);
+        ecs_manager.RemoveComponent<TestComponent2>(entities[2]);
+
+        REQUIRE(result.Size() == 5);
+        REQUIRE_FALSE(result.Contains(entities[1]));
+        REQUIRE(result.Contains(entities[2]));
+    }
+
+    SECTION("Optional terms share the cached result") {
+        ecs_manager.Query<TestComponent, Optional<TestComponent2>>();
+        const EntitySet &result = ecs_manager.Query<TestComponent>();
+
+        REQUIRE(result.Size() == 10);
+        REQUIRE(&ecs_manager.Query<TestComponent, Optional<TestTag>>() == &result);
+    }
+
+    SECTION("Unregistered required components match nothing") {
+        ecs_manager.UnregisterComponentID<TestTag>();
+
+        REQUIRE(ecs_manager.Query<TestComponent, TestTag>().Empty());
+        REQUIRE(ecs_manager.Query<TestComponent, Without<TestTag>>().Size() == 10);
+        REQUIRE_FALSE(ecs_manager.IsComponentRegistered<TestTag>());
+    }
+
+    SECTION("A query needs a required component") {
+        REQUIRE_THROWS_AS(ecs_manager.Query(QueryFilter{}), std::invalid_argument);
+    }
+
+    SECTION("Restoring a snapshot matches persistent queries again") {
+        ecs_manager.Query<TestComponent2>();
+        const EntitySet &result = ecs_manager.Query<TestComponent2>();
+        WorldSnapshot snapshot = ecs_manager.CaptureSnapshot();
+
+        ecs_manager.DestroyAllEntities();
+        REQUIRE(result.Empty());
+
+        ecs_manager.RestoreSnapshot(snapshot);
+        REQUIRE(result.Size() == 5);
+        REQUIRE(result.Contains(entities[0]));
+    }
+}
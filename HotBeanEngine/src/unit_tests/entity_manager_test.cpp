@@ -9,6 +9,8 @@
  * @copyright Copyright (c) 2025
  */
 
+#include <algorithm>
+
 #include <HotBeanEngine/application/managers/entity_manager.hpp>
 #include <catch2/catch_all.hpp>
 
@@ -278,3 +280,161 @@ TEST_CASE("EntityManager: Destroy All Entities") {
         REQUIRE(sig.none());
     }
 }
+
+TEST_CASE("EntityManager: Entity Limit") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    EntityManager entity_manager = EntityManager(logging_manager);
+
+    SECTION("Default limit is MAX_ENTITIES") { REQUIRE(entity_manager.GetEntityLimit() == MAX_ENTITIES); }
+
+    SECTION("Raise limit") {
+        REQUIRE(entity_manager.SetEntityLimit(MAX_ENTITIES + 10));
+
+        for (int i = 0; i < MAX_ENTITIES + 10; i++) {
+            entity_manager.CreateEntity();
+        }
+
+        REQUIRE(entity_manager.EntityCount() == MAX_ENTITIES + 10);
+        REQUIRE(entity_manager.CreateEntity() == MAX_ENTITIES + 10);
+        REQUIRE(entity_manager.GetSignature(MAX_ENTITIES + 5).none());
+    }
+
+    SECTION("Lower limit") {
+        REQUIRE(entity_manager.SetEntityLimit(3));
+
+        entity_manager.CreateEntity();
+        entity_manager.CreateEntity();
+        entity_manager.CreateEntity();
+
+        REQUIRE(entity_manager.CreateEntity() == 3);
+        REQUIRE(entity_manager.EntityCount() == 3);
+    }
+
+    SECTION("Lowering below a living entity fails") {
+        for (int i = 0; i < 5; i++) {
+            entity_manager.CreateEntity();
+        }
+
+        REQUIRE_FALSE(entity_manager.SetEntityLimit(3));
+        REQUIRE(entity_manager.GetEntityLimit() == MAX_ENTITIES);
+    }
+
+    SECTION("Lowering drops recycled IDs above the limit") {
+        for (int i = 0; i < 5; i++) {
+            entity_manager.CreateEntity();
+        }
+
+        entity_manager.DestroyEntity(4);
+        entity_manager.DestroyEntity(3);
+
+        REQUIRE(entity_manager.SetEntityLimit(4));
+        REQUIRE(entity_manager.CreateEntity() == 3);
+
+        // ID 4 is no longer valid, so the limit has been reached
+        REQUIRE(entity_manager.CreateEntity() == 4);
+        REQUIRE(entity_manager.EntityCount() == 4);
+    }
+}
+
+TEST_CASE("EntityManager: Bulk Creation") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    EntityManager entity_manager = EntityManager(logging_manager);
+
+    SECTION("Create entities in one call") {
+        std::vector<EntityID> entities = entity_manager.CreateEntities(100);
+
+        REQUIRE(entities.size() == 100);
+        REQUIRE(entity_manager.EntityCount() == 100);
+        REQUIRE(entities.front() == 0);
+        REQUIRE(entities.back() == 99);
+        REQUIRE(entity_manager.IsAlive(99));
+    }
+
+    SECTION("Create zero entities") {
+        REQUIRE(entity_manager.CreateEntities(0).empty());
+        REQUIRE(entity_manager.EntityCount() == 0);
+    }
+
+    SECTION("Bulk creation stops at the entity limit") {
+        REQUIRE(entity_manager.SetEntityLimit(10));
+        entity_manager.CreateEntity();
+
+        std::vector<EntityID> entities = entity_manager.CreateEntities(20);
+
+        REQUIRE(entities.size() == 9);
+        REQUIRE(entity_manager.EntityCount() == 10);
+        REQUIRE(entity_manager.CreateEntities(1).empty());
+    }
+
+    SECTION("Bulk creation recycles destroyed IDs once new IDs run out") {
+        REQUIRE(entity_manager.SetEntityLimit(5));
+        entity_manager.CreateEntities(5);
+        entity_manager.DestroyEntity(1);
+        entity_manager.DestroyEntity(3);
+
+        std::vector<EntityID> entities = entity_manager.CreateEntities(2);
+
+        REQUIRE(entities == std::vector<EntityID>{1, 3});
+        REQUIRE(entity_manager.EntityCount() == 5);
+    }
+}
+
+TEST_CASE("EntityManager: Entity Handles") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    EntityManager entity_manager = EntityManager(logging_manager);
+
+    SECTION("Handle to a living entity is valid") {
+        EntityID entity = entity_manager.CreateEntity();
+        EntityHandle handle = entity_manager.GetHandle(entity);
+
+        REQUIRE_FALSE(handle.IsNull());
+        REQUIRE(handle.GetID() == entity);
+        REQUIRE(entity_manager.IsValid(handle));
+        REQUIRE(entity_manager.IsAlive(entity));
+    }
+
+    SECTION("Handle to a dead entity is null") {
+        REQUIRE(entity_manager.GetHandle(0).IsNull());
+        REQUIRE_FALSE(entity_manager.IsValid(EntityHandle{}));
+        REQUIRE_FALSE(entity_manager.IsAlive(-1));
+    }
+
+    SECTION("Handle is stale after its ID is recycled") {
+        entity_manager.SetEntityLimit(1);
+
+        EntityID entity = entity_manager.CreateEntity();
+        EntityHandle old_handle = entity_manager.GetHandle(entity);
+        entity_manager.DestroyEntity(entity);
+
+        REQUIRE_FALSE(entity_manager.IsValid(old_handle));
+
+        EntityID recycled = entity_manager.CreateEntity();
+        EntityHandle new_handle = entity_manager.GetHandle(recycled);
+
+        REQUIRE(recycled == entity);
+        REQUIRE(new_handle != old_handle);
+        REQUIRE(entity_manager.IsValid(new_handle));
+        REQUIRE_FALSE(entity_manager.IsValid(old_handle));
+    }
+
+    SECTION("Handles are stale after destroying all entities") {
+        EntityID entity = entity_manager.CreateEntity();
+        EntityHandle old_handle = entity_manager.GetHandle(entity);
+        entity_manager.DestroyAllEntities();
+
+        REQUIRE(entity_manager.CreateEntity() == entity);
+        REQUIRE_FALSE(entity_manager.IsValid(old_handle));
+    }
+
+    SECTION("All entities lists only living entities") {
+        EntityID e1 = entity_manager.CreateEntity();
+        EntityID e2 = entity_manager.CreateEntity();
+        EntityID e3 = entity_manager.CreateEntity();
+        entity_manager.DestroyEntity(e1);
+
+        std::vector<EntityID> entities = entity_manager.GetAllEntities();
+        std::sort(entities.begin(), entities.end());
+
+        REQUIRE(entities == std::vector<EntityID>{e2, e3});
+    }
+}
\ No newline at end of file
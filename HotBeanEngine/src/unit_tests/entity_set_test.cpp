@@ -0,0 +1,104 @@
+/**
+ * @file entity_set_test.cpp
+ * @author Daniel Parker (DParker13)
+ * @brief Unit tests for the entity set data structure.
+ * Tests insertion, removal, membership, and iteration order.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include <catch2/catch_all.hpp>
+
+#include <HotBeanEngine/core/entity_set.hpp>
+
+using namespace HBE::Core;
+
+TEST_CASE("EntitySet: Insertion") {
+    EntitySet entity_set;
+
+    SECTION("Initially empty") {
+        REQUIRE(entity_set.Empty());
+        REQUIRE(entity_set.Size() == 0);
+        REQUIRE_FALSE(entity_set.Contains(0));
+    }
+
+    SECTION("Insert entities") {
+        REQUIRE(entity_set.Insert(4));
+        REQUIRE(entity_set.Insert(1000));
+        REQUIRE(entity_set.Size() == 2);
+        REQUIRE(entity_set.Contains(4));
+        REQUIRE(entity_set.Contains(1000));
+        REQUIRE_FALSE(entity_set.Contains(5));
+    }
+
+    SECTION("Insert same entity twice fails") {
+        REQUIRE(entity_set.Insert(3));
+        REQUIRE_FALSE(entity_set.Insert(3));
+        REQUIRE(entity_set.Size() == 1);
+    }
+
+    SECTION("Insert negative entity fails") {
+        REQUIRE_FALSE(entity_set.Insert(-1));
+        REQUIRE_FALSE(entity_set.Contains(-1));
+    }
+}
+
+TEST_CASE("EntitySet: Removal") {
+    EntitySet entity_set;
+    entity_set.Insert(1);
+    entity_set.Insert(2);
+    entity_set.Insert(3);
+
+    SECTION("Remove entity") {
+        REQUIRE(entity_set.Remove(2));
+        REQUIRE(entity_set.Size() == 2);
+        REQUIRE_FALSE(entity_set.Contains(2));
+        REQUIRE(entity_set.Contains(1));
+        REQUIRE(entity_set.Contains(3));
+    }
+
+    SECTION("Remove missing entity fails") {
+        REQUIRE_FALSE(entity_set.Remove(7));
+        REQUIRE_FALSE(entity_set.Remove(-1));
+        REQUIRE(entity_set.Size() == 3);
+    }
+
+    SECTION("Remove then reinsert") {
+        entity_set.Remove(1);
+        REQUIRE(entity_set.Insert(1));
+        REQUIRE(entity_set.Contains(1));
+        REQUIRE(entity_set.Size() == 3);
+    }
+
+    SECTION("Clear removes everything") {
+        entity_set.Clear();
+        REQUIRE(entity_set.Empty());
+        REQUIRE_FALSE(entity_set.Contains(1));
+    }
+}
+
+TEST_CASE("EntitySet: Iteration") {
+    EntitySet entity_set;
+
+    SECTION("Iterates in insertion order") {
+        entity_set.Insert(9);
+        entity_set.Insert(2);
+        entity_set.Insert(5);
+
+        std::vector<EntityID> entities(entity_set.begin(), entity_set.end());
+        REQUIRE(entities == std::vector<EntityID>{9, 2, 5});
+    }
+
+    SECTION("Removal moves the last entity into the gap") {
+        entity_set.Insert(1);
+        entity_set.Insert(2);
+        entity_set.Insert(3);
+        entity_set.Remove(1);
+
+        REQUIRE(entity_set[0] == 3);
+        REQUIRE(entity_set[1] == 2);
+        REQUIRE(entity_set.Data()[0] == 3);
+    }
+}
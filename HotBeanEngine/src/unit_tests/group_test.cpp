@@ -0,0 +1,228 @@
+/**
+ * @file group_test.cpp
+ * @author Daniel Parker (DParker13)
+ * @brief Unit tests for owning groups.
+ * Tests that grouped entities stay packed at the front of every owned set as components are added and removed.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include "test_component.hpp"
+#include "test_component_2.hpp"
+#include "test_system.hpp"
+#include <HotBeanEngine/application/managers/ecs_manager.hpp>
+
+using namespace HBE::Core;
+using namespace HBE::Application::Managers;
+
+namespace {
+    /**
+     * @brief Checks every entity in the group has both components, and that the component values still belong to it.
+     * Entities are given TestComponent::m_value == entity so moved components can be traced back.
+     */
+    template <typename GroupType>
+    bool GroupIsConsistent(const GroupType &group, const ComponentManager &component_manager) {
+        bool consistent = true;
+        size_t visited = 0;
+
+        group.Each([&](EntityID entity, const TestComponent &comp, const TestComponent2 &comp2) {
+            consistent &= comp.m_value == static_cast<int>(entity);
+            consistent &= comp2.m_x == static_cast<float>(entity);
+            consistent &= component_manager.HasComponent<TestComponent>(entity);
+            consistent &= component_manager.HasComponent<TestComponent2>(entity);
+            visited++;
+        });
+
+        return consistent && visited == group.Size();
+    }
+
+    void AddTestComponent(ComponentManager &component_manager, EntityID entity) {
+        TestComponent comp;
+        comp.m_value = static_cast<int>(entity);
+        component_manager.AddComponent<TestComponent>(entity, comp);
+    }
+
+    void AddTestComponent2(ComponentManager &component_manager, EntityID entity) {
+        component_manager.AddComponent<TestComponent2>(
+            entity, TestComponent2(static_cast<float>(entity), static_cast<float>(entity)));
+    }
+} // namespace
+
+TEST_CASE("Group: Sorting") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    ComponentManager component_manager = ComponentManager(logging_manager);
+
+    // Every entity has TestComponent, every third also has TestComponent2
+    for (EntityID entity = 0; entity < 30; entity++) {
+        AddTestComponent(component_manager, entity);
+        if (entity % 3 == 0) {
+            AddTestComponent2(component_manager, entity);
+        }
+    }
+
+    SECTION("Existing entities are sorted in when the group is created") {
+        auto group = component_manager.Group<const TestComponent, const TestComponent2>();
+
+        REQUIRE(group.Size() == 10);
+        REQUIRE(GroupIsConsistent(group, component_manager));
+        REQUIRE(group.Contains(3));
+        REQUIRE_FALSE(group.Contains(4));
+    }
+
+    SECTION("Group entities share dense positions in every owned set") {
+        auto group = component_manager.Group<const TestComponent, const TestComponent2>();
+        const auto view = component_manager.View<const TestComponent>();
+
+        std::vector<EntityID> order;
+        group.Each(
+            [&order](EntityID entity, const TestComponent &, const TestComponent2 &) { order.push_back(entity); });
+
+        // The first Size() entities of the TestComponent set are exactly the group, in the group's order
+        std::vector<EntityID> front_of_set;
+        for (auto [entity, comp] : view) {
+            if (front_of_set.size() == group.Size()) {
+                break;
+            }
+            front_of_set.push_back(entity);
+        }
+
+        REQUIRE(order == front_of_set);
+    }
+
+    SECTION("Adding the last missing component moves the entity into the group") {
+        auto group = component_manager.Group<const TestComponent, const TestComponent2>();
+        AddTestComponent2(component_manager, 4);
+        AddTestComponent2(component_manager, 5);
+
+        REQUIRE(group.Size() == 12);
+        REQUIRE(group.Contains(4));
+        REQUIRE(GroupIsConsistent(group, component_manager));
+    }
+
+    SECTION("Entity with only one of the components stays out") {
+        auto group = component_manager.Group<const TestComponent, const TestComponent2>();
+        AddTestComponent2(component_manager, 100);
+
+        REQUIRE(group.Size() == 10);
+        REQUIRE_FALSE(group.Contains(100));
+        REQUIRE(GroupIsConsistent(group, component_manager));
+    }
+
+    SECTION("Removing a component moves the entity out and keeps the group packed") {
+        auto group = component_manager.Group<const TestComponent, const TestComponent2>();
+        component_manager.RemoveComponent<TestComponent>(0);
+        component_manager.RemoveComponent(9, component_manager.GetComponentID<TestComponent2>());
+        component_manager.RemoveComponent<TestComponent>(1);
+
+        REQUIRE(group.Size() == 8);
+        REQUIRE_FALSE(group.Contains(0));
+        REQUIRE_FALSE(group.Contains(9));
+        REQUIRE(GroupIsConsistent(group, component_manager));
+    }
+
+    SECTION("Adding and removing in any order keeps the group consistent") {
+        auto group = component_manager.Group<const TestComponent, const TestComponent2>();
+
+        for (EntityID entity = 0; entity < 30; entity++) {
+            if (entity % 2 == 0 && component_manager.HasComponent<TestComponent2>(entity)) {
+                component_manager.RemoveComponent<TestComponent2>(entity);
+            }
+            else if (!component_manager.HasComponent<TestComponent2>(entity)) {
+                AddTestComponent2(component_manager, entity);
+            }
+        }
+
+        REQUIRE(group.Size() == 25);
+        REQUIRE(GroupIsConsistent(group, component_manager));
+    }
+
+    SECTION("Clearing all components empties the group") {
+        component_manager.Group<const TestComponent, const TestComponent2>();
+        component_manager.ClearAllComponents();
+        REQUIRE(component_manager.Group<const TestComponent, const TestComponent2>().Size() == 0);
+
+        AddTestComponent(component_manager, 1);
+        AddTestComponent2(component_manager, 1);
+        REQUIRE(component_manager.Group<const TestComponent, const TestComponent2>().Size() == 1);
+    }
+}
+
+TEST_CASE("Group: Ownership") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    ComponentManager component_manager = ComponentManager(logging_manager);
+
+    SECTION("Creating a group registers its components") {
+        auto group = component_manager.Group<TestComponent, TestComponent2>();
+
+        REQUIRE(group.Size() == 0);
+        REQUIRE(component_manager.IsComponentRegistered<TestComponent>());
+        REQUIRE(component_manager.IsComponentRegistered<TestComponent2>());
+    }
+
+    SECTION("Asking again in any order or constness returns the same group") {
+        component_manager.Group<TestComponent, TestComponent2>();
+        AddTestComponent(component_manager, 1);
+        AddTestComponent2(component_manager, 1);
+
+        REQUIRE(component_manager.Group<const TestComponent2, TestComponent>().Size() == 1);
+    }
+
+    SECTION("A set can't be owned by two different groups") {
+        component_manager.Group<TestComponent, TestComponent2>();
+
+        REQUIRE_THROWS_AS(component_manager.Group<TestComponent>(), ComponentAlreadyOwnedException);
+    }
+}
+
+TEST_CASE("Group: Iteration") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    std::shared_ptr<JobManager> job_manager = std::make_shared<JobManager>(4);
+    ECSManager ecs_manager = ECSManager(logging_manager, job_manager);
+
+    // Group first so the batch below is sorted in as it's spawned
+    ecs_manager.Group<TestComponent, TestComponent2>();
+    std::vector<EntityID> entities = ecs_manager.SpawnBatch<TestComponent, TestComponent2>(5000);
+
+    SECTION("Batch spawned entities are grouped") {
+        REQUIRE(ecs_manager.Group<TestComponent, TestComponent2>().Size() == entities.size());
+    }
+
+    SECTION("Destroyed entities leave the group") {
+        ecs_manager.DestroyEntity(entities[10]);
+        ecs_manager.DestroyEntity(entities[20]);
+        ecs_manager.Flush();
+
+        auto group = ecs_manager.Group<TestComponent, TestComponent2>();
+        REQUIRE(group.Size() == entities.size() - 2);
+        REQUIRE_FALSE(group.Contains(entities[10]));
+    }
+
+    SECTION("Mutable components are stamped as changed, const ones aren't") {
+        Tick since = ecs_manager.GetChangeTick();
+        ecs_manager.RegisterSystem<TestSystem>();
+        ecs_manager.IterateSystems(GameLoopState::OnUpdate);
+
+        ecs_manager.Group<TestComponent, const TestComponent2>().Each(
+            [](EntityID, TestComponent &comp, const TestComponent2 &) { comp.m_value++; });
+
+        REQUIRE(ecs_manager.IsChanged<TestComponent>(entities[0], since));
+        REQUIRE_FALSE(ecs_manager.IsChanged<TestComponent2>(entities[0], since));
+    }
+
+    SECTION("ParallelForEach visits every entity once") {
+        ecs_manager.Group<TestComponent, const TestComponent2>().ParallelForEach(
+            *job_manager, [](EntityID, TestComponent &comp, const TestComponent2 &) { comp.m_value++; });
+
+        size_t mismatches = 0;
+        for (EntityID entity : entities) {
+            mismatches += ecs_manager.GetComponent<const TestComponent>(entity).m_value != 1;
+        }
+        REQUIRE(mismatches == 0);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+/**
+ * @file job_manager_benchmark.cpp
+ * @author Daniel Parker (DParker13)
+ * @brief Benchmarks for spreading work across the job manager's workers.
+ * Runs the same ParallelFor with an increasing number of workers to show how it scales. Hidden from the default test
+ * run, use the [benchmark] tag to run.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include <cmath>
+
+#include <catch2/catch_all.hpp>
+
+#include <HotBeanEngine/application/managers/job_manager.hpp>
+
+using namespace HBE::Application::Managers;
+
+TEST_CASE("Benchmark: JobManager ParallelFor scaling", "[.][benchmark]") {
+    const size_t value_count = 1000000;
+    std::vector<float> values(value_count, 1.0f);
+
+    BENCHMARK("Sequential loop") {
+        for (float &value : values) {
+            value = std::sqrt(value * value + 1.0f);
+        }
+        return values.front();
+    };
+
+    for (size_t worker_count : {1, 2, 4, 8}) {
+        JobManager job_manager = JobManager(worker_count);
+
+        BENCHMARK("ParallelFor (" + std::to_string(worker_count) + " workers)") {
+            job_manager.ParallelFor(0, values.size(), [&values](size_t chunk_begin, size_t chunk_end) {
+                for (size_t i = chunk_begin; i < chunk_end; i++) {
+                    values[i] = std::sqrt(values[i] * values[i] + 1.0f);
+                }
+            });
+            return values.front();
+        };
+    }
+
+    JobManager job_manager = JobManager();
+
+    BENCHMARK("Schedule and wait 1000 empty jobs") {
+        std::vector<JobHandle> handles;
+        handles.reserve(1000);
+
+        for (int i = 0; i < 1000; i++) {
+            handles.push_back(job_manager.Schedule([]() {}));
+        }
+
+        job_manager.Wait(handles);
+        return handles.size();
+    };
+}
@@ -0,0 +1,265 @@
+/**
+ * @file job_manager_test.cpp
+ * @author Daniel Parker (DParker13)
+ * @brief Unit tests for the job manager.
+ * Tests scheduling, dependencies, waiting, exceptions, and parallel for loops.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+
+#include <catch2/catch_all.hpp>
+
+#include <HotBeanEngine/application/managers/job_manager.hpp>
+
+using namespace HBE::Application::Managers;
+
+TEST_CASE("JobManager: Scheduling") {
+    JobManager job_manager = JobManager(4);
+
+    REQUIRE(job_manager.GetWorkerCount() == 4);
+    REQUIRE_FALSE(job_manager.IsWorkerThread());
+
+    SECTION("Scheduled job runs") {
+        std::atomic<int> runs = 0;
+        JobHandle handle = job_manager.Schedule([&runs]() { runs++; });
+
+        job_manager.Wait(handle);
+
+        REQUIRE(handle.IsValid());
+        REQUIRE(handle.IsComplete());
+        REQUIRE(runs == 1);
+    }
+
+    SECTION("Empty handles are complete") {
+        JobHandle handle;
+
+        REQUIRE_FALSE(handle.IsValid());
+        REQUIRE(handle.IsComplete());
+        REQUIRE_NOTHROW(job_manager.Wait(handle));
+    }
+
+    SECTION("Jobs run on worker threads") {
+        std::atomic<bool> ran_on_worker = false;
+        JobHandle handle = job_manager.Schedule(
+            [&job_manager, &ran_on_worker]() { ran_on_worker = job_manager.IsWorkerThread(); });
+
+        // Waiting from the main thread may run the job itself, so give the workers a chance to pick it up first
+        while (!handle.IsComplete()) {
+            std::this_thread::yield();
+        }
+
+        REQUIRE(ran_on_worker);
+    }
+
+    SECTION("Many jobs all run") {
+        std::atomic<int> runs = 0;
+        std::vector<JobHandle> handles;
+
+        for (int i = 0; i < 1000; i++) {
+            handles.push_back(job_manager.Schedule([&runs]() { runs++; }));
+        }
+
+        job_manager.Wait(handles);
+
+        REQUIRE(runs == 1000);
+    }
+
+    SECTION("Jobs can schedule and wait on other jobs") {
+        std::atomic<int> runs = 0;
+
+        JobHandle parent = job_manager.Schedule([&job_manager, &runs]() {
+            std::vector<JobHandle> children;
+            for (int i = 0; i < 16; i++) {
+                children.push_back(job_manager.Schedule([&runs]() { runs++; }));
+            }
+            job_manager.Wait(children);
+        });
+
+        job_manager.Wait(parent);
+
+        REQUIRE(runs == 16);
+    }
+}
+
+TEST_CASE("JobManager: Dependencies") {
+    JobManager job_manager = JobManager(4);
+
+    SECTION("Continuation runs after its dependency") {
+        std::atomic<int> step = 0;
+        std::atomic<int> step_seen_by_continuation = -1;
+
+        JobHandle first = job_manager.Schedule([&step]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            step = 1;
+        });
+        JobHandle second = job_manager.Then(first, [&step, &step_seen_by_continuation]() {
+            step_seen_by_continuation = step.load();
+        });
+
+        job_manager.Wait(second);
+
+        REQUIRE(first.IsComplete());
+        REQUIRE(step_seen_by_continuation == 1);
+    }
+
+    SECTION("Job waits for every dependency") {
+        std::atomic<int> finished_dependencies = 0;
+        std::atomic<int> seen = -1;
+        std::vector<JobHandle> dependencies;
+
+        for (int i = 0; i < 8; i++) {
+            dependencies.push_back(job_manager.Schedule([&finished_dependencies, i]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(i));
+                finished_dependencies++;
+            }));
+        }
+
+        auto read_finished = [&finished_dependencies, &seen]() { seen = finished_dependencies.load(); };
+        JobHandle joined = job_manager.Schedule(read_finished, dependencies);
+        job_manager.Wait(joined);
+
+        REQUIRE(seen == 8);
+    }
+
+    SECTION("Dependency that already finished doesn't hold the job back") {
+        JobHandle first = job_manager.Schedule([]() {});
+        job_manager.Wait(first);
+
+        std::atomic<bool> ran = false;
+        JobHandle second = job_manager.Then(first, [&ran]() { ran = true; });
+        job_manager.Wait(second);
+
+        REQUIRE(ran);
+    }
+
+    SECTION("Chain of continuations runs in order") {
+        std::vector<int> order;
+        JobHandle previous;
+
+        for (int i = 0; i < 10; i++) {
+            previous = job_manager.Then(previous, [&order, i]() { order.push_back(i); });
+        }
+        job_manager.Wait(previous);
+
+        std::vector<int> expected(10);
+        std::iota(expected.begin(), expected.end(), 0);
+        REQUIRE(order == expected);
+    }
+}
+
+TEST_CASE("JobManager: Exceptions") {
+    JobManager job_manager = JobManager(2);
+
+    SECTION("Wait rethrows the job's exception") {
+        JobHandle handle = job_manager.Schedule([]() { throw std::runtime_error("job failed"); });
+
+        REQUIRE_THROWS_WITH(job_manager.Wait(handle), "job failed");
+        REQUIRE(handle.IsComplete());
+    }
+
+    SECTION("Continuations of a failed job still run") {
+        std::atomic<bool> ran = false;
+        JobHandle failed = job_manager.Schedule([]() { throw std::runtime_error("job failed"); });
+        JobHandle continuation = job_manager.Then(failed, [&ran]() { ran = true; });
+
+        REQUIRE_NOTHROW(job_manager.Wait(continuation));
+        REQUIRE(ran);
+    }
+
+    SECTION("ParallelFor rethrows after every chunk finished") {
+        std::atomic<int> runs = 0;
+
+        REQUIRE_THROWS_AS(job_manager.ParallelFor(0, 100,
+                                                  [&runs](size_t index) {
+                                                      runs++;
+                                                      if (index == 50) {
+                                                          throw std::runtime_error("index failed");
+                                                      }
+                                                  },
+                                                  10),
+                          std::runtime_error);
+
+        // Only the chunk that threw stops early
+        REQUIRE(runs == 91);
+    }
+}
+
+TEST_CASE("JobManager: ParallelFor") {
+    JobManager job_manager = JobManager(4);
+
+    SECTION("Every index is visited exactly once") {
+        std::vector<std::atomic<int>> visits(10000);
+
+        job_manager.ParallelFor(0, visits.size(), [&visits](size_t index) { visits[index]++; });
+
+        REQUIRE(std::all_of(visits.begin(), visits.end(), [](const std::atomic<int> &count) { return count == 1; }));
+    }
+
+    SECTION("Chunk callbacks cover the range without overlap") {
+        std::atomic<size_t> total = 0;
+        std::atomic<int> chunks = 0;
+        std::atomic<size_t> largest_chunk = 0;
+
+        job_manager.ParallelFor(
+            10, 1010,
+            [&](size_t chunk_begin, size_t chunk_end) {
+                total += chunk_end - chunk_begin;
+                chunks++;
+
+                size_t chunk_size = chunk_end - chunk_begin;
+                size_t largest = largest_chunk.load();
+                while (chunk_size > largest && !largest_chunk.compare_exchange_weak(largest, chunk_size)) {
+                }
+            },
+            100);
+
+        REQUIRE(total == 1000);
+        REQUIRE(chunks == 10);
+        REQUIRE(largest_chunk == 100);
+    }
+
+    SECTION("Empty range does nothing") {
+        bool ran = false;
+        job_manager.ParallelFor(5, 5, [&ran](size_t) { ran = true; });
+
+        REQUIRE_FALSE(ran);
+    }
+
+    SECTION("Small ranges run on the calling thread") {
+        bool ran_on_worker = true;
+        job_manager.ParallelFor(0, 4, [&](size_t) { ran_on_worker = job_manager.IsWorkerThread(); }, 8);
+
+        REQUIRE_FALSE(ran_on_worker);
+    }
+
+    SECTION("Nested ParallelFor from inside a job") {
+        std::atomic<int> sum = 0;
+
+        job_manager.ParallelFor(0, 8, [&](size_t) {
+            job_manager.ParallelFor(0, 100, [&sum](size_t) { sum++; }, 10);
+        }, 1);
+
+        REQUIRE(sum == 800);
+    }
+}
+
+TEST_CASE("JobManager: Shutdown") {
+    std::atomic<int> runs = 0;
+
+    {
+        JobManager job_manager = JobManager(2);
+        for (int i = 0; i < 100; i++) {
+            job_manager.Schedule([&runs]() { runs++; });
+        }
+    }
+
+    // Queued jobs are finished before the workers are joined
+    REQUIRE(runs == 100);
+}
@@ -0,0 +1,107 @@
+/**
+ * @file signature_benchmark.cpp
+ * @author Daniel Parker (DParker13)
+ * @brief Benchmarks for matching entity signatures against system signatures.
+ * The subset test runs at every supported width. EntitySignatureChanged runs at the width the engine was built with,
+ * configure with -DHBE_MAX_COMPONENTS=64/128/256/512 to compare it across widths.
+ * Hidden from the default test run, use the [benchmark] tag to run.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include <array>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <HotBeanEngine/application/managers/system_manager.hpp>
+#include <HotBeanEngine/core/signature.hpp>
+
+using namespace HBE::Core;
+using namespace HBE::Application::Managers;
+
+namespace {
+    constexpr size_t SYSTEM_COUNT = 16;
+    constexpr size_t ENTITY_COUNT = 10000;
+
+    /**
+     * @brief Builds signatures that use bits spread across the whole width, like a game with many component types.
+     * Signature i has three bits set, spaced 31 bits apart from signature i - 1's and wrapped to the width.
+     */
+    template <typename SignatureType>
+    SignatureType SpreadSignature(size_t i) {
+        SignatureType signature;
+        signature.set((i * 31) % SignatureType::size());
+        signature.set((i * 31 + 7) % SignatureType::size());
+        signature.set((i * 31 + 13) % SignatureType::size());
+        return signature;
+    }
+
+    /**
+     * @brief System with no components of its own, the benchmark gives each one a signature.
+     */
+    template <size_t N>
+    struct BenchmarkSystem : public GameSystem<> {
+        static std::string_view StaticGetName() {
+            static const std::string name = "BenchmarkSystem" + std::to_string(N);
+            return name;
+        }
+
+        std::string_view GetName() const override { return StaticGetName(); }
+    };
+
+    template <size_t... N>
+    void RegisterBenchmarkSystems(SystemManager &system_manager, std::index_sequence<N...>) {
+        (system_manager.RegisterSystem<BenchmarkSystem<N>>(), ...);
+        (system_manager.SetSignature<BenchmarkSystem<N>>(SpreadSignature<Signature>(N)), ...);
+    }
+} // namespace
+
+TEMPLATE_TEST_CASE("Benchmark: Signature subset test", "[.][benchmark]", BasicSignature<64>, BasicSignature<128>,
+                   BasicSignature<256>, BasicSignature<512>) {
+    std::vector<TestType> system_signatures;
+    for (size_t i = 0; i < SYSTEM_COUNT; i++) {
+        system_signatures.push_back(SpreadSignature<TestType>(i));
+    }
+
+    // Every entity has a couple of systems' components, so some tests pass and some fail
+    std::vector<TestType> entity_signatures;
+    for (size_t i = 0; i < ENTITY_COUNT; i++) {
+        entity_signatures.push_back(SpreadSignature<TestType>(i % SYSTEM_COUNT) |
+                                    SpreadSignature<TestType>((i + 3) % SYSTEM_COUNT));
+    }
+
+    BENCHMARK(std::to_string(TestType::size()) + "-bit (10000 entities x 16 systems)") {
+        size_t matches = 0;
+        for (const TestType &entity_signature : entity_signatures) {
+            for (const TestType &system_signature : system_signatures) {
+                matches += system_signature.IsSubsetOf(entity_signature);
+            }
+        }
+        return matches;
+    };
+}
+
+TEST_CASE("Benchmark: EntitySignatureChanged", "[.][benchmark]") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    std::shared_ptr<ComponentManager> component_manager = std::make_shared<ComponentManager>(logging_manager);
+    SystemManager system_manager = SystemManager(component_manager, logging_manager);
+    RegisterBenchmarkSystems(system_manager, std::make_index_sequence<SYSTEM_COUNT>());
+
+    std::array<Signature, 2> entity_signatures = {SpreadSignature<Signature>(0) | SpreadSignature<Signature>(1),
+                                                  SpreadSignature<Signature>(2)};
+
+    // Flips every entity between two signatures, so each call adds to and removes from some systems
+    size_t round = 0;
+    BENCHMARK(std::to_string(MAX_COMPONENTS) + "-bit signatures (10000 entities x 16 systems)") {
+        round++;
+        for (EntityID entity = 0; entity < static_cast<EntityID>(ENTITY_COUNT); entity++) {
+            system_manager.EntitySignatureChanged(entity, entity_signatures[(entity + round) % 2]);
+        }
+        return round;
+    };
+}
\ No newline at end of file
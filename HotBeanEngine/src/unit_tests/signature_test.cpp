@@ -0,0 +1,150 @@
+/**
+ * @file signature_test.cpp
+ * @author Daniel Parker (DParker13)
+ * @brief Unit tests for entity signatures.
+ * Tests every supported width: bit access, subset matching, string and YAML round trips, and the configured width
+ * through the system manager.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include <catch2/catch_all.hpp>
+
+#include "test_system.hpp"
+#include <HotBeanEngine/application/managers/system_manager.hpp>
+#include <HotBeanEngine/core/signature.hpp>
+#include <HotBeanEngine/serializers/yaml/yaml_extensions.hpp>
+
+using namespace HBE::Core;
+using namespace HBE::Application::Managers;
+
+TEMPLATE_TEST_CASE("Signature: Bit Access", "", BasicSignature<64>, BasicSignature<128>, BasicSignature<256>,
+                   BasicSignature<512>) {
+    TestType signature;
+    const size_t last = TestType::size() - 1;
+
+    SECTION("Starts empty") {
+        REQUIRE(signature.none());
+        REQUIRE(signature.count() == 0);
+        REQUIRE(alignof(TestType) == std::min<size_t>(TestType::size() / 8, 64));
+    }
+
+    SECTION("Set, test and reset bits in every word") {
+        signature.set(0).set(63).set(last);
+
+        REQUIRE(signature.test(0));
+        REQUIRE(signature.test(63));
+        REQUIRE(signature.test(last));
+        REQUIRE_FALSE(signature.test(1));
+        REQUIRE(signature.count() == (last == 63 ? 2 : 3));
+
+        signature.reset(63);
+        REQUIRE_FALSE(signature[63]);
+        signature.set(last, false);
+        REQUIRE_FALSE(signature[last]);
+    }
+
+    SECTION("Bits past the width are out of range") {
+        REQUIRE_THROWS_AS(signature.set(TestType::size()), std::out_of_range);
+        REQUIRE_THROWS_AS(signature.test(TestType::size()), std::out_of_range);
+    }
+
+    SECTION("Set and reset everything") {
+        signature.set();
+        REQUIRE(signature.count() == TestType::size());
+
+        signature.reset();
+        REQUIRE(signature.none());
+    }
+}
+
+TEMPLATE_TEST_CASE("Signature: Matching", "", BasicSignature<64>, BasicSignature<128>, BasicSignature<256>,
+                   BasicSignature<512>) {
+    const size_t last = TestType::size() - 1;
+
+    TestType system_signature;
+    system_signature.set(1).set(last);
+
+    TestType entity_signature;
+    entity_signature.set(1).set(2).set(last);
+
+    SECTION("Subsets match") {
+        REQUIRE(system_signature.IsSubsetOf(entity_signature));
+        REQUIRE(TestType().IsSubsetOf(entity_signature));
+        REQUIRE_FALSE(entity_signature.IsSubsetOf(system_signature));
+    }
+
+    SECTION("A missing bit in the last word doesn't match") {
+        entity_signature.reset(last);
+        REQUIRE_FALSE(system_signature.IsSubsetOf(entity_signature));
+    }
+
+    SECTION("Operators agree with subset matching") {
+        REQUIRE((entity_signature & system_signature) == system_signature);
+        REQUIRE((entity_signature | system_signature) == entity_signature);
+        REQUIRE((entity_signature ^ system_signature).count() == 1);
+        REQUIRE((~entity_signature).count() == TestType::size() - 3);
+        REQUIRE(entity_signature != system_signature);
+    }
+}
+
+TEMPLATE_TEST_CASE("Signature: Serialization", "", BasicSignature<64>, BasicSignature<128>, BasicSignature<256>,
+                   BasicSignature<512>) {
+    const size_t last = TestType::size() - 1;
+
+    TestType signature;
+    signature.set(0).set(5).set(last);
+
+    SECTION("Strings are written highest bit first") {
+        const std::string bits = signature.to_string();
+
+        REQUIRE(bits.size() == TestType::size());
+        REQUIRE(bits.front() == '1');
+        REQUIRE(bits[bits.size() - 6] == '1');
+        REQUIRE(TestType(bits) == signature);
+    }
+
+    SECTION("Short strings fill the lowest bits") {
+        REQUIRE(TestType("101") == TestType().set(0).set(2));
+        REQUIRE_THROWS_AS(TestType("12"), std::invalid_argument);
+    }
+
+    SECTION("Strings load at a wider width") {
+        BasicSignature<1024> wider(signature.to_string());
+
+        REQUIRE(wider.count() == 3);
+        REQUIRE(wider.test(last));
+        REQUIRE_THROWS_AS(TestType(wider.set(TestType::size()).to_string()), std::out_of_range);
+    }
+
+    SECTION("YAML round trip") {
+        YAML::Emitter out;
+        out << YAML::BeginMap << YAML::Key << "signature" << YAML::Value << signature << YAML::EndMap;
+
+        YAML::Node node = YAML::Load(out.c_str());
+        REQUIRE(node["signature"].as<TestType>() == signature);
+    }
+}
+
+TEST_CASE("Signature: Configured Width") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    std::shared_ptr<ComponentManager> component_manager = std::make_shared<ComponentManager>(logging_manager);
+    SystemManager system_manager = SystemManager(component_manager, logging_manager);
+    TestSystem &system = system_manager.RegisterSystem<TestSystem>();
+
+    // The highest ComponentID at the configured width lands in the last word of the signature
+    Signature system_signature;
+    system_signature.set(MAX_COMPONENTS - 1);
+    system_manager.SetSignature<TestSystem>(system_signature);
+
+    Signature entity_signature = system_signature;
+    entity_signature.set(0);
+
+    system_manager.EntitySignatureChanged(7, entity_signature);
+    REQUIRE(system.m_entities.Contains(7));
+
+    system_manager.EntitySignatureChanged(7, Signature().set(0));
+    REQUIRE_FALSE(system.m_entities.Contains(7));
+}
\ No newline at end of file
@@ -0,0 +1,159 @@
+/**
+ * @file snapshot_benchmark.cpp
+ * @author Daniel Parker (DParker13)
+ * @brief Benchmarks for putting a world back to how it was when Play was pressed.
+ * Compares restoring a world snapshot against reloading the scene from YAML, which is what Stop used to do.
+ * Hidden from the default test run, use the [benchmark] tag to run.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include <string>
+#include <utility>
+
+#include <catch2/catch_all.hpp>
+
+#include <HotBeanEngine/application/managers/ecs_manager.hpp>
+#include <HotBeanEngine/serializers/yaml/yaml_serialization_reader.hpp>
+#include <HotBeanEngine/serializers/yaml/yaml_serialization_writer.hpp>
+
+using namespace HBE::Core;
+using namespace HBE::Application::Managers;
+using namespace HBE::Serializers;
+
+namespace {
+    /**
+     * @brief Component with a few serialized fields, roughly the size of a transform.
+     */
+    struct BenchmarkBody : public IComponent {
+        glm::vec2 m_position = glm::vec2(0.0f);
+        float m_rotation = 0.0f;
+        int m_layer = 0;
+
+        DEFINE_NAME("BenchmarkBody")
+        BenchmarkBody() = default;
+
+        void Serialize(ISerializationWriter &out) const override {
+            out.Write("Position", m_position);
+            out.Write("Rotation", m_rotation);
+            out.Write("Layer", m_layer);
+        }
+
+        void Deserialize(ISerializationReader &in) override {
+            in.Read("Position", m_position);
+            in.Read("Rotation", m_rotation);
+            in.Read("Layer", m_layer);
+        }
+    };
+
+    /**
+     * @brief Component holding a string, like a texture or audio path.
+     */
+    struct BenchmarkLabel : public IComponent {
+        std::string m_text;
+
+        DEFINE_NAME("BenchmarkLabel")
+        BenchmarkLabel() = default;
+
+        void Serialize(ISerializationWriter &out) const override { out.Write("Text", m_text); }
+        void Deserialize(ISerializationReader &in) override { in.Read("Text", m_text); }
+    };
+
+    void PopulateEntities(ECSManager &ecs_manager, int entity_count) {
+        for (int i = 0; i < entity_count; i++) {
+            EntityID entity = ecs_manager.CreateEntity();
+
+            BenchmarkBody body;
+            body.m_position = glm::vec2(static_cast<float>(i), static_cast<float>(i));
+            body.m_layer = i % 4;
+            ecs_manager.AddComponent<BenchmarkBody>(entity, body);
+
+            if (i % 2 == 0) {
+                BenchmarkLabel label;
+                label.m_text = "assets/sprites/entity.png";
+                ecs_manager.AddComponent<BenchmarkLabel>(entity, label);
+            }
+        }
+    }
+
+    /**
+     * @brief Writes every entity the same way YamlSceneSerializer does, so the reload below parses a real scene.
+     */
+    std::string SerializeEntities(ECSManager &ecs_manager) {
+        YAML::Emitter out;
+        out << YAML::BeginMap << YAML::Key << "Entities" << YAML::Value << YAML::BeginSeq;
+
+        for (EntityID entity : ecs_manager.GetAllEntities()) {
+            out << YAML::BeginMap << YAML::Key << "Entity" << YAML::Value << YAML::BeginMap;
+
+            for (IComponent *component : ecs_manager.GetAllComponents(entity)) {
+                out << YAML::Key << component->GetName().data() << YAML::Value << YAML::BeginMap;
+                YamlComponentWriter writer(out);
+                component->Serialize(writer);
+                out << YAML::EndMap;
+            }
+
+            out << YAML::EndMap << YAML::EndMap;
+        }
+
+        out << YAML::EndSeq << YAML::EndMap;
+        return out.c_str();
+    }
+
+    template <typename T>
+    void DeserializeComponent(ECSManager &ecs_manager, EntityID entity, const YAML::Node &node) {
+        YamlComponentReader reader(node);
+        T component;
+        component.Deserialize(reader);
+        ecs_manager.AddComponent<T>(entity, std::move(component));
+    }
+
+    /**
+     * @brief Destroys every entity and loads them back from YAML, like the old Stop did through
+     * YamlSceneSerializer and the component factory.
+     */
+    void ReloadEntities(ECSManager &ecs_manager, const std::string &scene_text) {
+        ecs_manager.DestroyAllEntities();
+
+        YAML::Node scene = YAML::Load(scene_text);
+        for (const YAML::Node &entity_node : scene["Entities"]) {
+            EntityID entity = ecs_manager.CreateEntity();
+
+            for (const auto &component : entity_node["Entity"]) {
+                const std::string component_name = component.first.as<std::string>();
+
+                if (component_name == BenchmarkBody::StaticGetName()) {
+                    DeserializeComponent<BenchmarkBody>(ecs_manager, entity, component.second);
+                }
+                else if (component_name == BenchmarkLabel::StaticGetName()) {
+                    DeserializeComponent<BenchmarkLabel>(ecs_manager, entity, component.second);
+                }
+            }
+        }
+    }
+} // namespace
+
+TEST_CASE("Benchmark: Snapshot restore vs YAML reload", "[.][benchmark]") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    const int entity_count = 10000;
+
+    ECSManager ecs_manager = ECSManager(logging_manager);
+    PopulateEntities(ecs_manager, entity_count);
+
+    const WorldSnapshot snapshot = ecs_manager.CaptureSnapshot();
+    const std::string scene_text = SerializeEntities(ecs_manager);
+
+    BENCHMARK("Capture snapshot (10000 entities)") { return ecs_manager.CaptureSnapshot().EntityCount(); };
+
+    BENCHMARK("Restore snapshot (10000 entities)") {
+        ecs_manager.RestoreSnapshot(snapshot);
+        return ecs_manager.EntityCount();
+    };
+
+    BENCHMARK("Reload from YAML (10000 entities)") {
+        ReloadEntities(ecs_manager, scene_text);
+        return ecs_manager.EntityCount();
+    };
+}
\ No newline at end of file
@@ -9,15 +9,52 @@
  * @copyright Copyright (c) 2025
  */
 
+#include <memory>
+#include <vector>
+
 #include <catch2/catch_all.hpp>
 
+#include "test_child.hpp"
 #include "test_component.hpp"
+#include "test_component_2.hpp"
+#include "test_tag.hpp"
+#include <HotBeanEngine/application/managers/job_manager.hpp>
 #include <HotBeanEngine/core/sparse_set.hpp>
 
 using namespace HBE::Core;
 
 constexpr size_t TEST_MAX_ITEMS = 10;
 
+namespace {
+    /**
+     * @brief Move-only component that owns a resource and counts how many instances are alive.
+     */
+    struct OwningComponent : public IComponent {
+        static inline int s_alive = 0;
+        std::unique_ptr<int> m_resource;
+
+        DEFINE_NAME("OwningComponent")
+        OwningComponent() { s_alive++; }
+        explicit OwningComponent(int value) : m_resource(std::make_unique<int>(value)) { s_alive++; }
+        OwningComponent(OwningComponent &&other) noexcept : m_resource(std::move(other.m_resource)) { s_alive++; }
+        ~OwningComponent() override { s_alive--; }
+    };
+
+    /**
+     * @brief Move-only component that copies its resource through a Clone() hook.
+     */
+    struct CloneableComponent : public IComponent {
+        std::unique_ptr<int> m_resource;
+
+        DEFINE_NAME("CloneableComponent")
+        CloneableComponent() = default;
+        explicit CloneableComponent(int value) : m_resource(std::make_unique<int>(value)) {}
+        CloneableComponent(CloneableComponent &&) noexcept = default;
+
+        CloneableComponent Clone() const { return CloneableComponent(m_resource ? *m_resource : 0); }
+    };
+} // namespace
+
 TEST_CASE("SparseSet: Initialization") {
     SparseSet<TestComponent, TEST_MAX_ITEMS> sparse_set;
 
@@ -336,39 +373,318 @@ TEST_CASE("SparseSet: Copy and Move") {
     }
 }
 
+TEST_CASE("SparseSet: Move-Only Elements") {
+    OwningComponent::s_alive = 0;
+
+    {
+        SparseSet<OwningComponent, TEST_MAX_ITEMS> sparse_set;
+
+        SECTION("Reserve doesn't construct elements") {
+            sparse_set.Reserve(TEST_MAX_ITEMS);
+            REQUIRE(OwningComponent::s_alive == 0);
+        }
+
+        SECTION("Emplace constructs in place") {
+            REQUIRE(sparse_set.Emplace(3, 7));
+            REQUIRE_FALSE(sparse_set.Emplace(3, 8));
+
+            REQUIRE(*sparse_set.GetElementAsRef(3).m_resource == 7);
+            REQUIRE(OwningComponent::s_alive == 1);
+        }
+
+        SECTION("Insert by move") {
+            OwningComponent comp(5);
+            REQUIRE(sparse_set.Insert(2, std::move(comp)));
+
+            REQUIRE(comp.m_resource == nullptr);
+            REQUIRE(*sparse_set.GetElementAsRef(2).m_resource == 5);
+        }
+
+        SECTION("Insert by copy is refused") {
+            OwningComponent comp(5);
+            ISparseSet &interface = sparse_set;
+
+            REQUIRE_FALSE(interface.InsertCopy(2, comp));
+            REQUIRE(interface.InsertMove(2, std::move(comp)));
+        }
+
+        SECTION("Remove destroys the element and moves the last one into its slot") {
+            for (int i = 0; i < 5; i++) {
+                sparse_set.Emplace(i, i * 10);
+            }
+
+            int *last_resource = sparse_set.GetElementAsRef(4).m_resource.get();
+            REQUIRE(sparse_set.Remove(1));
+
+            REQUIRE(OwningComponent::s_alive == 4);
+            REQUIRE(sparse_set.GetElementAsRef(4).m_resource.get() == last_resource);
+            REQUIRE(*sparse_set.GetElementAsRef(4).m_resource == 40);
+            REQUIRE(*sparse_set.GetElementAsRef(0).m_resource == 0);
+
+            REQUIRE(sparse_set.Remove(4));
+            REQUIRE(OwningComponent::s_alive == 3);
+        }
+
+        SECTION("Moving the set keeps elements alive once") {
+            sparse_set.Emplace(1, 1);
+            sparse_set.Emplace(2, 2);
+
+            SparseSet<OwningComponent, TEST_MAX_ITEMS> moved(std::move(sparse_set));
+
+            REQUIRE(OwningComponent::s_alive == 2);
+            REQUIRE(*moved.GetElementAsRef(2).m_resource == 2);
+        }
+    }
+
+    // Destroying the set destroys every element it still holds
+    REQUIRE(OwningComponent::s_alive == 0);
+}
+
+TEST_CASE("SparseSet: Clone") {
+    SECTION("Copyable elements are copied with their indices and ticks") {
+        Tick tick = 3;
+        SparseSet<TestComponent, TEST_MAX_ITEMS> sparse_set;
+        sparse_set.SetTickSource(&tick);
+
+        TestComponent comp;
+        comp.m_value = 12;
+        sparse_set.Insert(5, comp);
+        sparse_set.Insert(2, comp);
+
+        std::unique_ptr<ISparseSet> clone = sparse_set.Clone();
+        sparse_set.GetElementAsRef(5).m_value = 13;
+
+        REQUIRE(clone->Size() == 2);
+        REQUIRE(clone->GetIndices()[0] == 5);
+        REQUIRE(static_cast<TestComponent *>(clone->GetComponent(5))->m_value == 12);
+        REQUIRE(clone->GetTicks(2)->added == 3);
+
+        tick = 9;
+        clone->MarkAllAdded();
+        REQUIRE(clone->GetTicks(2)->added == 9);
+        REQUIRE(clone->GetTicks(5)->changed == 9);
+        REQUIRE(sparse_set.GetTicks(2)->added == 3);
+    }
+
+    SECTION("Clone() hook copies move-only elements") {
+        SparseSet<CloneableComponent, TEST_MAX_ITEMS> sparse_set;
+        sparse_set.Emplace(1, 4);
+        sparse_set.Emplace(3, 6);
+
+        std::unique_ptr<ISparseSet> clone = sparse_set.Clone();
+        auto *copy = static_cast<CloneableComponent *>(clone->GetComponent(3));
+
+        REQUIRE(sparse_set.GetComponentOps().copy != nullptr);
+        REQUIRE(*copy->m_resource == 6);
+        REQUIRE(copy->m_resource != sparse_set.GetElementAsRef(3).m_resource);
+    }
+
+    SECTION("Elements that can't be copied are default constructed") {
+        OwningComponent::s_alive = 0;
+        SparseSet<OwningComponent, TEST_MAX_ITEMS> sparse_set;
+        sparse_set.Emplace(1, 4);
+        sparse_set.Emplace(3, 6);
+
+        std::unique_ptr<ISparseSet> clone = sparse_set.Clone();
+
+        REQUIRE(sparse_set.GetComponentOps().copy == nullptr);
+        REQUIRE(clone->HasElement(3));
+        REQUIRE(static_cast<OwningComponent *>(clone->GetComponent(3))->m_resource == nullptr);
+        REQUIRE(OwningComponent::s_alive == 4);
+
+        clone.reset();
+        REQUIRE(OwningComponent::s_alive == 2);
+    }
+
+    SECTION("Copies of one element are inserted at every free index") {
+        SparseSet<TestComponent, TEST_MAX_ITEMS> sparse_set;
+        TestComponent comp;
+        comp.m_value = 21;
+        sparse_set.Insert(0, comp);
+        sparse_set.Insert(4, TestComponent());
+
+        const std::vector<size_t> indices = {1, 4, 6, TEST_MAX_ITEMS};
+        REQUIRE(sparse_set.InsertCopies(0, indices) == 2);
+
+        REQUIRE(sparse_set.Size() == 4);
+        REQUIRE(sparse_set.GetElementAsRef(1).m_value == 21);
+        REQUIRE(sparse_set.GetElementAsRef(6).m_value == 21);
+        REQUIRE(sparse_set.GetElementAsRef(4).m_value == 0);
+        REQUIRE(sparse_set.InsertCopies(2, indices) == 0);
+    }
+
+    SECTION("Copies of a move-only element go through its Clone() hook") {
+        SparseSet<CloneableComponent, TEST_MAX_ITEMS> sparse_set;
+        sparse_set.Emplace(0, 8);
+
+        const std::vector<size_t> indices = {1, 2};
+        sparse_set.InsertCopies(0, indices);
+
+        REQUIRE(*sparse_set.GetElementAsRef(2).m_resource == 8);
+        REQUIRE(sparse_set.GetElementAsRef(2).m_resource != sparse_set.GetElementAsRef(0).m_resource);
+    }
+
+    SECTION("Copies of an element that can't be copied are default constructed") {
+        SparseSet<OwningComponent, TEST_MAX_ITEMS> sparse_set;
+        sparse_set.Emplace(0, 8);
+
+        const std::vector<size_t> indices = {1};
+        REQUIRE(sparse_set.InsertCopies(0, indices) == 1);
+        REQUIRE(sparse_set.GetElementAsRef(1).m_resource == nullptr);
+    }
+}
+
+TEST_CASE("SparseSet: Tag Components") {
+    STATIC_REQUIRE(IS_TAG_COMPONENT<TestTag>);
+    STATIC_REQUIRE_FALSE(IS_TAG_COMPONENT<TestComponent>);
+
+    using TagSet = SparseSet<TestTag, 100000>;
+    TagSet sparse_set;
+    const size_t count = TagSet::DENSE_PAGE_SIZE * 2 + 3;
+
+    for (size_t i = 0; i < count; i++) {
+        sparse_set.InsertEmpty(i * 3);
+    }
+
+    SECTION("Membership is tracked like any other set") {
+        REQUIRE(sparse_set.Size() == count);
+        REQUIRE(sparse_set.HasElement(3));
+        REQUIRE_FALSE(sparse_set.HasElement(4));
+        REQUIRE(sparse_set.GetIndices()[1] == 3);
+        REQUIRE(sparse_set.GetTicks(3) != nullptr);
+    }
+
+    SECTION("Every element is the same shared instance") {
+        REQUIRE(sparse_set.GetElement(0) == sparse_set.GetElement(3));
+        REQUIRE(sparse_set.GetComponent(0) == sparse_set.GetComponent(3));
+
+        size_t iterated = 0;
+        for (const TestTag &tag : sparse_set) {
+            iterated += &tag == sparse_set.GetElement(0);
+        }
+        REQUIRE(iterated == count);
+    }
+
+    SECTION("Removing and swapping keep the indices packed") {
+        sparse_set.Remove(0);
+        sparse_set.Remove(9);
+        sparse_set.SwapDense(0, 1);
+
+        REQUIRE(sparse_set.Size() == count - 2);
+        REQUIRE_FALSE(sparse_set.HasElement(0));
+        REQUIRE_FALSE(sparse_set.HasElement(9));
+        for (size_t dense_index = 0; dense_index < sparse_set.Size(); dense_index++) {
+            REQUIRE(sparse_set.GetDenseIndex(sparse_set.GetIndices()[dense_index]) == static_cast<int>(dense_index));
+        }
+    }
+
+    SECTION("Cloning copies the membership") {
+        std::unique_ptr<ISparseSet> clone = sparse_set.Clone();
+
+        REQUIRE(clone->Size() == count);
+        REQUIRE(clone->HasElement(3));
+        REQUIRE(clone->GetComponentOps().is_tag);
+        REQUIRE_FALSE(COMPONENT_OPS<TestComponent>.is_tag);
+    }
+}
+
 TEST_CASE("SparseSet: ISparseSet Interface") {
     SparseSet<TestComponent, TEST_MAX_ITEMS> sparse_set;
+    ISparseSet &interface = sparse_set;
 
-    SECTION("GetElementPtrAsAny") {
+    SECTION("GetComponent") {
         TestComponent comp;
         comp.m_value = 999;
         sparse_set.Insert(0, comp);
 
-        std::any result = sparse_set.GetElementPtrAsAny(0);
-        REQUIRE_FALSE(result.has_value() == false);
-
-        IComponent *comp_ptr = std::any_cast<IComponent *>(result);
-        REQUIRE(comp_ptr != nullptr);
+        IComponent *comp_ptr = interface.GetComponent(0);
+        REQUIRE(comp_ptr == &sparse_set.GetElementAsRef(0));
 
         TestComponent *typed_ptr = dynamic_cast<TestComponent *>(comp_ptr);
         REQUIRE(typed_ptr != nullptr);
         REQUIRE(typed_ptr->m_value == 999);
     }
 
-    SECTION("GetElementPtrAsAny for non-existent element") {
-        std::any result = sparse_set.GetElementPtrAsAny(5);
-        REQUIRE_FALSE(result.has_value());
+    SECTION("GetComponent for non-existent element") {
+        REQUIRE(interface.GetComponent(5) == nullptr);
+        REQUIRE(interface.GetComponent(TEST_MAX_ITEMS) == nullptr);
     }
 
-    SECTION("Insert via std::any") {
+    SECTION("Insert by copy") {
         TestComponent comp;
         comp.m_value = 111;
-        std::any any_comp = comp;
 
-        bool result = sparse_set.Insert(3, any_comp);
-        REQUIRE(result);
+        REQUIRE(interface.InsertCopy(3, comp));
         REQUIRE(sparse_set.HasElement(3));
         REQUIRE(sparse_set.GetElementAsRef(3).m_value == 111);
+        REQUIRE_FALSE(interface.InsertCopy(3, comp));
+    }
+
+    SECTION("Insert by move") {
+        TestComponent comp;
+        comp.m_value = 222;
+
+        REQUIRE(interface.InsertMove(4, std::move(comp)));
+        REQUIRE(sparse_set.GetElementAsRef(4).m_value == 222);
+    }
+
+    SECTION("Insert rejects other component types") {
+        TestComponent2 other;
+
+        REQUIRE_FALSE(interface.InsertCopy(3, other));
+        REQUIRE_FALSE(interface.InsertMove(3, std::move(other)));
+        REQUIRE_FALSE(sparse_set.HasElement(3));
+    }
+
+    SECTION("Insert copies of a component from outside the set") {
+        TestComponent comp;
+        comp.m_value = 333;
+        sparse_set.Insert(2, comp);
+        const std::vector<size_t> indices = {1, 2, 3};
+
+        REQUIRE(interface.InsertCopies(comp, indices) == 2);
+        REQUIRE(sparse_set.GetElementAsRef(3).m_value == 333);
+        REQUIRE(interface.InsertCopies(TestComponent2(), std::vector<size_t>{4}) == 0);
+        REQUIRE_FALSE(sparse_set.HasElement(4));
+    }
+
+    SECTION("Component ops are shared per type") {
+        const ComponentOps &ops = interface.GetComponentOps();
+        SparseSet<TestComponent, TEST_MAX_ITEMS * 2> other_set;
+
+        REQUIRE(&ops == &COMPONENT_OPS<TestComponent>);
+        REQUIRE(&other_set.GetComponentOps() == &ops);
+        REQUIRE(ops.size == sizeof(TestComponent));
+        REQUIRE(ops.alignment == alignof(TestComponent));
+    }
+
+    SECTION("Component ops link parents of types that have them") {
+        TestChild child;
+
+        REQUIRE(interface.GetComponentOps().set_parent == nullptr);
+        REQUIRE(COMPONENT_OPS<TestChild>.set_parent != nullptr);
+        COMPONENT_OPS<TestChild>.set_parent(&child, 12);
+        REQUIRE(child.m_parent == 12);
+    }
+
+    SECTION("Component ops construct, move, copy and destroy") {
+        const ComponentOps &ops = interface.GetComponentOps();
+        alignas(TestComponent) unsigned char source[sizeof(TestComponent)];
+        alignas(TestComponent) unsigned char destination[sizeof(TestComponent)];
+
+        ops.construct(source);
+        REQUIRE(ops.as_component(source)->GetName() == "TestComponent");
+        reinterpret_cast<TestComponent *>(source)->m_value = 42;
+
+        ops.move(destination, source);
+        REQUIRE(static_cast<TestComponent *>(ops.as_component(destination))->m_value == 42);
+        ops.destroy(source);
+
+        ops.copy(source, destination);
+        REQUIRE(static_cast<TestComponent *>(ops.as_component(source))->m_value == 42);
+
+        ops.destroy(source);
+        ops.destroy(destination);
     }
 }
 
@@ -436,3 +752,312 @@ TEST_CASE("SparseSet: Edge Cases") {
         REQUIRE(sparse_set.Size() == 0);
     }
 }
+
+TEST_CASE("SparseSet: Paged Storage") {
+    using LargeSet = SparseSet<TestComponent, 100000>;
+    LargeSet sparse_set;
+
+    SECTION("Elements across sparse pages") {
+        TestComponent comp;
+        for (size_t i = 0; i < 5; i++) {
+            comp.m_value = static_cast<int>(i);
+            sparse_set.Insert(i * LargeSet::SPARSE_PAGE_SIZE + 1, comp);
+        }
+
+        REQUIRE(sparse_set.Size() == 5);
+        for (size_t i = 0; i < 5; i++) {
+            REQUIRE(sparse_set.HasElement(i * LargeSet::SPARSE_PAGE_SIZE + 1));
+            REQUIRE(sparse_set.GetElementAsRef(i * LargeSet::SPARSE_PAGE_SIZE + 1).m_value == static_cast<int>(i));
+            REQUIRE_FALSE(sparse_set.HasElement(i * LargeSet::SPARSE_PAGE_SIZE));
+        }
+    }
+
+    SECTION("Elements across dense pages") {
+        TestComponent comp;
+        const size_t count = LargeSet::DENSE_PAGE_SIZE * 3 + 7;
+
+        for (size_t i = 0; i < count; i++) {
+            comp.m_value = static_cast<int>(i);
+            sparse_set.Insert(i, comp);
+        }
+
+        int sum = 0;
+        size_t iterated = 0;
+        for (const auto &elem : sparse_set) {
+            sum += elem.m_value;
+            iterated++;
+        }
+
+        REQUIRE(iterated == count);
+        REQUIRE(sum == static_cast<int>(count * (count - 1) / 2));
+
+        for (size_t i = 0; i < count; i += 2) {
+            sparse_set.Remove(i);
+        }
+
+        REQUIRE(sparse_set.Size() == count / 2);
+        for (size_t i = 1; i < count; i += 2) {
+            REQUIRE(sparse_set.GetElementAsRef(i).m_value == static_cast<int>(i));
+        }
+    }
+
+    SECTION("Element addresses are stable while the set grows") {
+        TestComponent comp;
+        comp.m_value = 1;
+        sparse_set.Insert(0, comp);
+        TestComponent *first = sparse_set.GetElement(0);
+
+        for (size_t i = 1; i < LargeSet::DENSE_PAGE_SIZE * 4; i++) {
+            sparse_set.Insert(i, comp);
+        }
+
+        REQUIRE(sparse_set.GetElement(0) == first);
+    }
+
+    SECTION("Copy keeps elements across pages") {
+        TestComponent comp;
+        comp.m_value = 3;
+        sparse_set.Insert(LargeSet::SPARSE_PAGE_SIZE * 2, comp);
+
+        LargeSet copy(sparse_set);
+        sparse_set.Remove(LargeSet::SPARSE_PAGE_SIZE * 2);
+
+        REQUIRE(copy.HasElement(LargeSet::SPARSE_PAGE_SIZE * 2));
+        REQUIRE(copy.GetElementAsRef(LargeSet::SPARSE_PAGE_SIZE * 2).m_value == 3);
+    }
+
+    SECTION("Removing every element keeps the pages") {
+        TestComponent comp;
+        for (size_t i = 0; i < LargeSet::DENSE_PAGE_SIZE * 2; i++) {
+            sparse_set.Insert(i, comp);
+        }
+        TestComponent *first = sparse_set.GetElement(0);
+        const size_t capacity = sparse_set.Capacity();
+
+        for (size_t i = 0; i < LargeSet::DENSE_PAGE_SIZE * 2; i++) {
+            sparse_set.Remove(i);
+        }
+        sparse_set.Insert(5, comp);
+
+        REQUIRE(sparse_set.Capacity() == capacity);
+        REQUIRE(sparse_set.GetElement(5) == first);
+    }
+
+    SECTION("Clear destroys elements and keeps the pages") {
+        OwningComponent::s_alive = 0;
+        SparseSet<OwningComponent, 100000> owning_set;
+        for (size_t i = 0; i < 300; i++) {
+            owning_set.Emplace(i * 100, static_cast<int>(i));
+        }
+        const size_t capacity = owning_set.Capacity();
+
+        owning_set.Clear();
+
+        REQUIRE(owning_set.Size() == 0);
+        REQUIRE(OwningComponent::s_alive == 0);
+        REQUIRE_FALSE(owning_set.HasElement(200));
+        REQUIRE(owning_set.Capacity() == capacity);
+
+        owning_set.Emplace(200, 9);
+        REQUIRE(owning_set.Size() == 1);
+        REQUIRE(*owning_set.GetElementAsRef(200).m_resource == 9);
+    }
+
+    SECTION("ShrinkToFit frees unused pages and keeps elements in place") {
+        TestComponent comp;
+        for (size_t i = 0; i < LargeSet::DENSE_PAGE_SIZE * 3; i++) {
+            comp.m_value = static_cast<int>(i);
+            sparse_set.Insert(i * 20, comp);
+        }
+
+        for (size_t i = 10; i < LargeSet::DENSE_PAGE_SIZE * 3; i++) {
+            sparse_set.Remove(i * 20);
+        }
+        TestComponent *kept = sparse_set.GetElement(180);
+
+        sparse_set.ShrinkToFit();
+
+        REQUIRE(sparse_set.Capacity() == LargeSet::DENSE_PAGE_SIZE);
+        REQUIRE(sparse_set.Size() == 10);
+        REQUIRE(sparse_set.GetElement(180) == kept);
+        REQUIRE(kept->m_value == 9);
+        REQUIRE_FALSE(sparse_set.HasElement(LargeSet::SPARSE_PAGE_SIZE * 2));
+
+        comp.m_value = 42;
+        REQUIRE(sparse_set.Insert(LargeSet::SPARSE_PAGE_SIZE * 2, comp));
+        REQUIRE(sparse_set.GetElementAsRef(LargeSet::SPARSE_PAGE_SIZE * 2).m_value == 42);
+    }
+
+    SECTION("ShrinkToFit on an empty set frees every page") {
+        TestComponent comp;
+        sparse_set.Insert(LargeSet::SPARSE_PAGE_SIZE * 3, comp);
+        sparse_set.Remove(LargeSet::SPARSE_PAGE_SIZE * 3);
+
+        sparse_set.ShrinkToFit();
+
+        REQUIRE(sparse_set.Capacity() == 0);
+        REQUIRE_FALSE(sparse_set.HasElement(LargeSet::SPARSE_PAGE_SIZE * 3));
+        REQUIRE(sparse_set.Insert(1, comp));
+    }
+}
+
+TEST_CASE("SparseSet: Max Items") {
+    SparseSet<TestComponent, TEST_MAX_ITEMS> sparse_set;
+    TestComponent comp;
+
+    SECTION("Default max items comes from the template parameter") {
+        REQUIRE(sparse_set.GetMaxItems() == TEST_MAX_ITEMS);
+    }
+
+    SECTION("Raise max items") {
+        REQUIRE(sparse_set.SetMaxItems(TEST_MAX_ITEMS * 10));
+        REQUIRE(sparse_set.Insert(TEST_MAX_ITEMS * 5, comp));
+        REQUIRE(sparse_set.HasElement(TEST_MAX_ITEMS * 5));
+    }
+
+    SECTION("Lower max items") {
+        sparse_set.Insert(2, comp);
+
+        REQUIRE(sparse_set.SetMaxItems(5));
+        REQUIRE_FALSE(sparse_set.Insert(6, comp));
+        REQUIRE(sparse_set.HasElement(2));
+    }
+
+    SECTION("Lowering below an existing element fails") {
+        sparse_set.Insert(8, comp);
+
+        REQUIRE_FALSE(sparse_set.SetMaxItems(5));
+        REQUIRE(sparse_set.GetMaxItems() == TEST_MAX_ITEMS);
+        REQUIRE(sparse_set.HasElement(8));
+    }
+}
+
+TEST_CASE("SparseSet: Change Ticks") {
+    SparseSet<TestComponent, TEST_MAX_ITEMS> sparse_set;
+    Tick tick = 5;
+    sparse_set.SetTickSource(&tick);
+
+    sparse_set.Insert(1, TestComponent());
+    sparse_set.Insert(2, TestComponent());
+    tick = 6;
+
+    SECTION("Insert stamps added and changed") {
+        const ComponentTicks *ticks = sparse_set.GetTicks(1);
+
+        REQUIRE(ticks != nullptr);
+        REQUIRE(ticks->added == 5);
+        REQUIRE(ticks->changed == 5);
+        REQUIRE(ticks->IsAdded(4));
+        REQUIRE_FALSE(ticks->IsAdded(5));
+    }
+
+    SECTION("Missing element has no ticks") { REQUIRE(sparse_set.GetTicks(3) == nullptr); }
+
+    SECTION("Mutable access stamps changed") {
+        sparse_set.GetElementAsRef(1).m_value = 10;
+
+        REQUIRE(sparse_set.GetTicks(1)->changed == 6);
+        REQUIRE(sparse_set.GetTicks(1)->added == 5);
+        REQUIRE(sparse_set.GetTicks(2)->changed == 5);
+    }
+
+    SECTION("Const access doesn't stamp") {
+        const auto &const_set = sparse_set;
+        REQUIRE(const_set.GetElementAsRef(1).m_value == 0);
+        REQUIRE(const_set.GetElement(2) != nullptr);
+
+        for (const TestComponent &comp : const_set) {
+            REQUIRE(comp.m_value == 0);
+        }
+
+        REQUIRE(sparse_set.GetTicks(1)->changed == 5);
+        REQUIRE(sparse_set.GetTicks(2)->changed == 5);
+    }
+
+    SECTION("Mutable iteration stamps every element") {
+        for (TestComponent &comp : sparse_set) {
+            comp.m_value++;
+        }
+
+        REQUIRE(sparse_set.GetTicks(1)->changed == 6);
+        REQUIRE(sparse_set.GetTicks(2)->changed == 6);
+    }
+
+    SECTION("MarkChanged stamps without accessing the element") {
+        sparse_set.MarkChanged(2);
+
+        REQUIRE(sparse_set.GetTicks(1)->changed == 5);
+        REQUIRE(sparse_set.GetTicks(2)->changed == 6);
+    }
+
+    SECTION("Ticks move with the element swapped in on removal") {
+        sparse_set.MarkChanged(2);
+        sparse_set.Remove(1);
+
+        REQUIRE(sparse_set.GetTicks(1) == nullptr);
+        REQUIRE(sparse_set.GetTicks(2)->added == 5);
+        REQUIRE(sparse_set.GetTicks(2)->changed == 6);
+    }
+}
+
+TEST_CASE("SparseSet: Parallel Iteration") {
+    using LargeSet = SparseSet<TestComponent, 100000>;
+    HBE::Application::Managers::JobManager job_manager = HBE::Application::Managers::JobManager(4);
+    LargeSet sparse_set;
+
+    // Spread over several dense pages and leave gaps in the indices
+    for (size_t i = 0; i < 20000; i++) {
+        TestComponent comp;
+        comp.m_value = static_cast<int>(i);
+        sparse_set.Insert(i * 3, comp);
+    }
+
+    SECTION("Every element is visited once") {
+        sparse_set.ParallelForEach(job_manager, [](TestComponent &comp) { comp.m_value++; });
+
+        size_t mismatches = 0;
+        for (size_t i = 0; i < 20000; i++) {
+            mismatches += sparse_set.GetElementAsRef(i * 3).m_value != static_cast<int>(i) + 1;
+        }
+        REQUIRE(mismatches == 0);
+    }
+
+    SECTION("Callback can take the element's index") {
+        sparse_set.ParallelForEach(job_manager,
+                                   [](size_t index, TestComponent &comp) { comp.m_value = static_cast<int>(index); });
+
+        size_t mismatches = 0;
+        for (size_t i = 0; i < 20000; i++) {
+            mismatches += sparse_set.GetElementAsRef(i * 3).m_value != static_cast<int>(i * 3);
+        }
+        REQUIRE(mismatches == 0);
+    }
+
+    SECTION("Empty set does nothing") {
+        LargeSet empty_set;
+        bool ran = false;
+        empty_set.ParallelForEach(job_manager, [&ran](TestComponent &) { ran = true; });
+
+        REQUIRE_FALSE(ran);
+    }
+}
+
+TEST_CASE("SparseSet: Parallel Chunk Size") {
+    SECTION("Chunks cover whole cache lines") {
+        REQUIRE(ParallelChunkSize(1000000, 12, 4) % ElementsPerCacheLine(12) == 0);
+        REQUIRE(ParallelChunkSize(1000000, 16, 4) % (CACHE_LINE_SIZE / 16) == 0);
+    }
+
+    SECTION("Chunks never drop below the minimum size") {
+        REQUIRE(ParallelChunkSize(100, 4, 8) * 4 >= MIN_PARALLEL_CHUNK_BYTES);
+    }
+
+    SECTION("Large ranges give each thread several chunks") {
+        size_t chunk_size = ParallelChunkSize(10000000, 4, 8);
+        REQUIRE(10000000 / chunk_size >= 8);
+    }
+
+    SECTION("Elements larger than a cache line get their own line") {
+        REQUIRE(ElementsPerCacheLine(CACHE_LINE_SIZE * 2) == 1);
+    }
+}
\ No newline at end of file
@@ -9,9 +9,12 @@
  * @copyright Copyright (c) 2025
  */
 
+#include <atomic>
+
 #include <catch2/catch_all.hpp>
 
 #include "test_component.hpp"
+#include "test_component_2.hpp"
 #include "test_system.hpp"
 #include "test_system_2.hpp"
 #include <HotBeanEngine/application/managers/system_manager.hpp>
@@ -19,6 +22,38 @@
 using namespace HBE::Core;
 using namespace HBE::Application::Managers;
 
+namespace {
+    std::atomic<int> g_parallel_updates{0};
+
+    struct ReaderSystem : public GameSystem<const TestComponent> {
+        DEFINE_NAME("ReaderSystem");
+        bool RunsInParallel() const override { return true; }
+        void OnUpdate() override { g_parallel_updates++; }
+    };
+
+    struct OtherReaderSystem : public GameSystem<const TestComponent, TestComponent2> {
+        DEFINE_NAME("OtherReaderSystem");
+        bool RunsInParallel() const override { return true; }
+        void OnUpdate() override { g_parallel_updates++; }
+    };
+
+    struct WriterSystem : public GameSystem<TestComponent> {
+        DEFINE_NAME("WriterSystem");
+        bool RunsInParallel() const override { return true; }
+        void OnUpdate() override { g_parallel_updates++; }
+    };
+
+    // Changes an entity's signature from OnEntityAdded(), like a system that adds a component to it
+    struct SignatureChangingSystem : public GameSystem<> {
+        DEFINE_NAME("SignatureChangingSystem");
+        SystemManager *m_system_manager = nullptr;
+        EntityID m_entity = 0;
+        Signature m_signature;
+
+        void OnEntityAdded(EntityID) override { m_system_manager->EntitySignatureChanged(m_entity, m_signature); }
+    };
+} // namespace
+
 TEST_CASE("SystemManager: System Registration") {
     std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
     std::shared_ptr<ComponentManager> component_manager = std::make_shared<ComponentManager>(logging_manager);
@@ -138,6 +173,36 @@ TEST_CASE("SystemManager: System Signatures") {
         // Both systems should still be accessible
         REQUIRE(system_manager.GetSystem<TestSystem>() != nullptr);
         REQUIRE(system_manager.GetSystem<TestSystem2>() != nullptr);
+        REQUIRE(system_manager.GetSignature<TestSystem>() == sig1);
+        REQUIRE(system_manager.GetSignature<TestSystem2>() == sig2);
+    }
+
+    SECTION("Setting a signature again replaces it") {
+        system_manager.RegisterSystem<TestSystem>();
+
+        Signature first;
+        first.set(0);
+        Signature second;
+        second.set(3);
+
+        system_manager.SetSignature<TestSystem>(first);
+        system_manager.SetSignature<TestSystem>(second);
+
+        REQUIRE(system_manager.GetSignature<TestSystem>() == second);
+    }
+
+    SECTION("Signatures survive unregistering an earlier system") {
+        system_manager.RegisterSystem<TestSystem>();
+        system_manager.RegisterSystem<TestSystem2>();
+
+        Signature sig;
+        sig.set(4);
+        system_manager.SetSignature<TestSystem2>(sig);
+
+        system_manager.UnregisterSystem<TestSystem>();
+
+        REQUIRE(system_manager.GetSignature<TestSystem2>() == sig);
+        REQUIRE(system_manager.GetAllSystems().size() == 1);
     }
 }
 
@@ -179,6 +244,127 @@ TEST_CASE("SystemManager: Entity Signature Changes") {
         EntityID entity = 0;
         REQUIRE_NOTHROW(system_manager.EntityDestroyed(entity));
     }
+
+    SECTION("Matching entities are tracked by the system") {
+        TestSystem &system = system_manager.RegisterSystem<TestSystem>();
+        system_manager.GetSignature<TestSystem>().set(0);
+
+        Signature matching_sig;
+        matching_sig.set(0);
+        Signature other_sig;
+        other_sig.set(1);
+
+        system_manager.EntitySignatureChanged(2, matching_sig);
+        system_manager.EntitySignatureChanged(5, other_sig);
+        system_manager.EntitySignatureChanged(7, matching_sig);
+
+        REQUIRE(system.m_entities.Size() == 2);
+        REQUIRE(system.m_entities.Contains(2));
+        REQUIRE_FALSE(system.m_entities.Contains(5));
+        REQUIRE(system.m_entities.Contains(7));
+
+        // Losing the component removes the entity
+        system_manager.EntitySignatureChanged(2, other_sig);
+        REQUIRE_FALSE(system.m_entities.Contains(2));
+
+        system_manager.EntityDestroyed(7);
+        REQUIRE(system.m_entities.Empty());
+    }
+
+    SECTION("Components above bit 31 are matched") {
+        TestSystem &system = system_manager.RegisterSystem<TestSystem>();
+        system_manager.GetSignature<TestSystem>().set(MAX_COMPONENTS - 1);
+
+        Signature low_sig;
+        low_sig.set(31);
+        Signature high_sig;
+        high_sig.set(MAX_COMPONENTS - 1);
+
+        system_manager.EntitySignatureChanged(1, low_sig);
+        system_manager.EntitySignatureChanged(2, high_sig);
+
+        REQUIRE_FALSE(system.m_entities.Contains(1));
+        REQUIRE(system.m_entities.Contains(2));
+    }
+
+    SECTION("Rematching only changes systems whose signature match flipped") {
+        TestSystem &system = system_manager.RegisterSystem<TestSystem>();
+        TestSystem2 &system_2 = system_manager.RegisterSystem<TestSystem2>();
+        system_manager.GetSignature<TestSystem>().set(0);
+        system_manager.GetSignature<TestSystem2>().set(1);
+
+        Signature first_sig;
+        first_sig.set(0);
+        Signature both_sig = first_sig;
+        both_sig.set(1);
+
+        system_manager.EntitySignatureChanged(3, first_sig);
+        system_manager.EntitySignatureChanged(3, both_sig);
+
+        REQUIRE(system.m_entities.Size() == 1);
+        REQUIRE(system_2.m_entities.Size() == 1);
+
+        system_manager.EntitySignatureChanged(3, first_sig);
+
+        REQUIRE(system.m_entities.Contains(3));
+        REQUIRE_FALSE(system_2.m_entities.Contains(3));
+    }
+}
+
+TEST_CASE("SystemManager: Signature Changes From Callbacks") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    std::shared_ptr<ComponentManager> component_manager = std::make_shared<ComponentManager>(logging_manager);
+    SystemManager system_manager = SystemManager(component_manager, logging_manager);
+
+    // Registered first so its callback runs before the other systems are matched
+    SignatureChangingSystem &changing_system = system_manager.RegisterSystem<SignatureChangingSystem>();
+    TestSystem &second_system = system_manager.RegisterSystem<TestSystem>();
+    TestSystem2 &first_system = system_manager.RegisterSystem<TestSystem2>();
+    changing_system.m_system_manager = &system_manager;
+    system_manager.GetSignature<SignatureChangingSystem>().set(0);
+    system_manager.GetSignature<TestSystem>().set(1);
+    system_manager.GetSignature<TestSystem2>().set(0);
+
+    Signature first_sig;
+    first_sig.set(0);
+    Signature second_sig;
+    second_sig.set(1);
+
+    SECTION("Adding a component to another entity doesn't change how this one is matched") {
+        changing_system.m_entity = 9;
+        changing_system.m_signature = second_sig;
+
+        system_manager.EntitySignatureChanged(4, first_sig);
+
+        REQUIRE(changing_system.m_entities.Contains(4));
+        REQUIRE(first_system.m_entities.Contains(4));
+        REQUIRE_FALSE(second_system.m_entities.Contains(4));
+        REQUIRE(second_system.m_entities.Contains(9));
+        REQUIRE_FALSE(first_system.m_entities.Contains(9));
+    }
+
+    SECTION("Adding a component to the same entity keeps the systems it now matches") {
+        changing_system.m_entity = 4;
+        changing_system.m_signature = first_sig | second_sig;
+
+        system_manager.EntitySignatureChanged(4, first_sig);
+
+        REQUIRE(changing_system.m_entities.Contains(4));
+        REQUIRE(first_system.m_entities.Contains(4));
+        REQUIRE(second_system.m_entities.Contains(4));
+    }
+
+    SECTION("Batches are matched by their own signature") {
+        changing_system.m_entity = 9;
+        changing_system.m_signature = second_sig;
+
+        std::vector<EntityID> entities = {2, 4};
+        system_manager.EntitiesSignatureChanged(entities, first_sig);
+
+        REQUIRE(first_system.m_entities.Size() == 2);
+        REQUIRE(second_system.m_entities.Size() == 1);
+        REQUIRE(second_system.m_entities.Contains(9));
+    }
 }
 
 TEST_CASE("SystemManager: System Lifecycle") {
@@ -228,6 +414,36 @@ TEST_CASE("SystemManager: System Lifecycle") {
     }
 }
 
+TEST_CASE("SystemManager: Change Ticks") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    std::shared_ptr<ComponentManager> component_manager = std::make_shared<ComponentManager>(logging_manager);
+    SystemManager system_manager = SystemManager(component_manager, logging_manager);
+
+    system_manager.RegisterSystem<TestSystem>();
+    TestSystem *system = system_manager.GetSystem<TestSystem>();
+
+    SECTION("Tick advances after every system runs") {
+        Tick before = component_manager->GetChangeTick();
+        system_manager.IterateSystems(GameLoopState::OnUpdate);
+
+        REQUIRE(component_manager->GetChangeTick() > before);
+    }
+
+    SECTION("Last run tick is from the previous run of the same method") {
+        REQUIRE(system->GetLastRunTick() == 0);
+
+        Tick first_update = component_manager->GetChangeTick();
+        system_manager.IterateSystems(GameLoopState::OnUpdate);
+        system_manager.IterateSystems(GameLoopState::OnRender);
+
+        // OnRender hasn't run before, so it sees everything
+        REQUIRE(system->GetLastRunTick() == 0);
+
+        system_manager.IterateSystems(GameLoopState::OnUpdate);
+        REQUIRE(system->GetLastRunTick() == first_update);
+    }
+}
+
 TEST_CASE("SystemManager: System Ordering") {
     std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
     std::shared_ptr<ComponentManager> component_manager = std::make_shared<ComponentManager>(logging_manager);
@@ -252,3 +468,76 @@ TEST_CASE("SystemManager: System Ordering") {
         REQUIRE(system_manager.GetSystem<TestSystem2>() != nullptr);
     }
 }
+
+TEST_CASE("SystemManager: Parallel Stages") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    std::shared_ptr<ComponentManager> component_manager = std::make_shared<ComponentManager>(logging_manager);
+    std::shared_ptr<JobManager> job_manager = std::make_shared<JobManager>(2);
+    SystemManager system_manager = SystemManager(component_manager, logging_manager, job_manager);
+
+    // Systems look up their component IDs when they are registered
+    component_manager->RegisterComponentID<TestComponent>();
+    component_manager->RegisterComponentID<TestComponent2>();
+
+    SECTION("Const components are reads") {
+        ReaderSystem reader;
+        SystemAccess access = reader.GetComponentAccess();
+
+        REQUIRE_FALSE(access.exclusive);
+        REQUIRE(access.reads == std::vector<std::string_view>{"TestComponent"});
+        REQUIRE(access.writes.empty());
+    }
+
+    SECTION("Systems are exclusive by default") {
+        TestSystem system;
+        REQUIRE(system.GetComponentAccess().exclusive);
+    }
+
+    SECTION("Readers share a stage and writers wait for them") {
+        ReaderSystem &reader = system_manager.RegisterSystem<ReaderSystem>();
+        OtherReaderSystem &other_reader = system_manager.RegisterSystem<OtherReaderSystem>();
+        WriterSystem &writer = system_manager.RegisterSystem<WriterSystem>();
+
+        const auto &stages = system_manager.GetSystemStages();
+
+        REQUIRE(stages.size() == 2);
+        REQUIRE(stages[0] == std::vector<SystemBase *>{&reader, &other_reader});
+        REQUIRE(stages[1] == std::vector<SystemBase *>{&writer});
+    }
+
+    SECTION("Exclusive systems run alone in registration order") {
+        ReaderSystem &reader = system_manager.RegisterSystem<ReaderSystem>();
+        TestSystem &exclusive = system_manager.RegisterSystem<TestSystem>();
+        OtherReaderSystem &other_reader = system_manager.RegisterSystem<OtherReaderSystem>();
+
+        const auto &stages = system_manager.GetSystemStages();
+
+        REQUIRE(stages.size() == 3);
+        REQUIRE(stages[0] == std::vector<SystemBase *>{&reader});
+        REQUIRE(stages[1] == std::vector<SystemBase *>{&exclusive});
+        REQUIRE(stages[2] == std::vector<SystemBase *>{&other_reader});
+    }
+
+    SECTION("Stages are rebuilt when systems change") {
+        system_manager.RegisterSystem<ReaderSystem>();
+        system_manager.RegisterSystem<WriterSystem>();
+        REQUIRE(system_manager.GetSystemStages().size() == 2);
+
+        system_manager.UnregisterSystem<WriterSystem>();
+        REQUIRE(system_manager.GetSystemStages().size() == 1);
+    }
+
+    SECTION("Every system runs once per update") {
+        system_manager.RegisterSystem<ReaderSystem>();
+        system_manager.RegisterSystem<OtherReaderSystem>();
+        system_manager.RegisterSystem<WriterSystem>();
+
+        g_parallel_updates = 0;
+        system_manager.IterateSystems(GameLoopState::OnUpdate);
+        REQUIRE(g_parallel_updates == 3);
+
+        system_manager.SetParallelExecution(false);
+        system_manager.IterateSystems(GameLoopState::OnUpdate);
+        REQUIRE(g_parallel_updates == 6);
+    }
+}
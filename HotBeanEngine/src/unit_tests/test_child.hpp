@@ -0,0 +1,11 @@
+#pragma once
+
+#include <HotBeanEngine/application/application.hpp>
+
+struct TestChild : public HBE::Core::IComponent {
+    HBE::Core::EntityID m_parent = -1;
+    int m_value = 0;
+
+    DEFINE_NAME("TestChild")
+    TestChild() = default;
+};
\ No newline at end of file
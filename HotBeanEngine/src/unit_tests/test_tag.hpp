@@ -0,0 +1,8 @@
+#pragma once
+
+#include <HotBeanEngine/application/application.hpp>
+
+struct TestTag : public HBE::Core::IComponent {
+    DEFINE_NAME("TestTag")
+    TestTag() = default;
+};
\ No newline at end of file
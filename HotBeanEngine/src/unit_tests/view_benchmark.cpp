@@ -0,0 +1,132 @@
+/**
+ * @file view_benchmark.cpp
+ * @author Daniel Parker (DParker13)
+ * @brief Benchmarks for iterating entities by component.
+ * Compares View against cached queries, GetEntitiesWithComponents and owning groups, and sequential against parallel
+ * iteration.
+ * Hidden from the default test run, use the [benchmark] tag to run.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include <catch2/catch_all.hpp>
+
+#include "test_component.hpp"
+#include "test_component_2.hpp"
+#include <HotBeanEngine/application/managers/ecs_manager.hpp>
+
+using namespace HBE::Core;
+using namespace HBE::Application::Managers;
+
+namespace {
+    /**
+     * @brief Fills the ECS with entity_count entities that all have TestComponent.
+     * Every other entity also has TestComponent2.
+     */
+    void PopulateEntities(ECSManager &ecs_manager, int entity_count) {
+        for (int i = 0; i < entity_count; i++) {
+            EntityID entity = ecs_manager.CreateEntity();
+            ecs_manager.AddComponent<TestComponent>(entity);
+
+            if (i % 2 == 0) {
+                ecs_manager.AddComponent<TestComponent2>(entity, TestComponent2(1.0f, 1.0f));
+            }
+        }
+    }
+} // namespace
+
+TEST_CASE("Benchmark: View vs Queries", "[.][benchmark]") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+    std::shared_ptr<JobManager> job_manager = std::make_shared<JobManager>();
+
+    for (int entity_count : {1000, 10000, 50000}) {
+        ECSManager ecs_manager = ECSManager(logging_manager, job_manager);
+        PopulateEntities(ecs_manager, entity_count);
+
+        std::string suffix = " (" + std::to_string(entity_count) + " entities)";
+
+        BENCHMARK("GetEntitiesWithComponents" + suffix) {
+            float sum = 0.0f;
+            for (EntityID entity : ecs_manager.GetEntitiesWithComponents<TestComponent, TestComponent2>()) {
+                TestComponent &comp = ecs_manager.GetComponent<TestComponent>(entity);
+                TestComponent2 &comp2 = ecs_manager.GetComponent<TestComponent2>(entity);
+                comp.m_value++;
+                sum += comp2.m_x;
+            }
+            return sum;
+        };
+
+        BENCHMARK("Query" + suffix) {
+            float sum = 0.0f;
+            for (EntityID entity : ecs_manager.Query<TestComponent, TestComponent2>()) {
+                TestComponent &comp = ecs_manager.GetComponent<TestComponent>(entity);
+                TestComponent2 &comp2 = ecs_manager.GetComponent<TestComponent2>(entity);
+                comp.m_value++;
+                sum += comp2.m_x;
+            }
+            return sum;
+        };
+
+        BENCHMARK("View range-for" + suffix) {
+            float sum = 0.0f;
+            for (auto [entity, comp, comp2] : ecs_manager.View<TestComponent, TestComponent2>()) {
+                comp.m_value++;
+                sum += comp2.m_x;
+            }
+            return sum;
+        };
+
+        BENCHMARK("View Each" + suffix) {
+            float sum = 0.0f;
+            ecs_manager.View<TestComponent, TestComponent2>().Each(
+                [&sum](EntityID, TestComponent &comp, TestComponent2 &comp2) {
+                    comp.m_value++;
+                    sum += comp2.m_x;
+                });
+            return sum;
+        };
+
+        BENCHMARK("View ParallelForEach" + suffix) {
+            ecs_manager.ParallelForEach<TestComponent, const TestComponent2>(
+                [](EntityID, TestComponent &comp, const TestComponent2 &comp2) {
+                    comp.m_value += static_cast<int>(comp2.m_x);
+                });
+            return ecs_manager.GetComponent<TestComponent>(0).m_value;
+        };
+    }
+}
+
+TEST_CASE("Benchmark: Group vs View", "[.][benchmark]") {
+    std::shared_ptr<LoggingManager> logging_manager = std::make_shared<LoggingManager>();
+
+    for (int entity_count : {1000, 10000, 50000}) {
+        ECSManager ecs_manager = ECSManager(logging_manager);
+        PopulateEntities(ecs_manager, entity_count);
+
+        std::string suffix = " (" + std::to_string(entity_count) + " entities)";
+
+        BENCHMARK("View Each" + suffix) {
+            float sum = 0.0f;
+            ecs_manager.View<TestComponent, const TestComponent2>().Each(
+                [&sum](EntityID, TestComponent &comp, const TestComponent2 &comp2) {
+                    comp.m_value++;
+                    sum += comp2.m_x;
+                });
+            return sum;
+        };
+
+        ecs_manager.Group<TestComponent, TestComponent2>();
+
+        BENCHMARK("Group Each" + suffix) {
+            float sum = 0.0f;
+            ecs_manager.Group<TestComponent, const TestComponent2>().Each(
+                [&sum](EntityID, TestComponent &comp, const TestComponent2 &comp2) {
+                    comp.m_value++;
+                    sum += comp2.m_x;
+                });
+            return sum;
+        };
+    }
+}